@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+
+#include "include/Benchmark.h"
+
+/**********************************************************************/
+/**  BATCH SERVICE HOST SELECTION UNDER N QUEUED JOBS                **/
+/**********************************************************************/
+
+/**
+ * @brief A WMS that submits many one-node jobs at once to a batch service,
+ *        so that most of them sit in the queue, and waits for all of them
+ */
+class BatchServiceBenchmarkWMS : public wrench::WMS {
+
+public:
+    BatchServiceBenchmarkWMS(BenchmarkResult *result, unsigned long num_jobs,
+                             const std::set<wrench::ComputeService *> &compute_services,
+                             std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "benchmark") {
+      this->result = result;
+      this->num_jobs = num_jobs;
+    }
+
+private:
+
+    BenchmarkResult *result;
+    unsigned long num_jobs;
+
+    int main() {
+
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+      wrench::ComputeService *batch_service = *(this->getAvailableComputeServices().begin());
+
+      std::vector<wrench::StandardJob *> jobs;
+      for (unsigned long i = 0; i < this->num_jobs; i++) {
+        wrench::WorkflowTask *task = this->workflow->addTask("task_" + std::to_string(i), 60.0, 1, 1, 1.0);
+        jobs.push_back(job_manager->createStandardJob(task, {}));
+      }
+
+      std::map<std::string, std::string> batch_job_args;
+      batch_job_args["-N"] = "1";
+      batch_job_args["-t"] = "2"; //time in minutes
+      batch_job_args["-c"] = "1"; //number of cores per node
+
+      double simulated_start = wrench::S4U_Simulation::getClock();
+      double start = Benchmark::now();
+      for (auto job : jobs) {
+        job_manager->submitJob(job, batch_service, batch_job_args);
+      }
+      double submission_end = Benchmark::now();
+
+      for (unsigned long i = 0; i < this->num_jobs; i++) {
+        std::unique_ptr<wrench::WorkflowExecutionEvent> event = this->workflow->waitForNextExecutionEvent();
+        if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+          throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+        }
+      }
+      this->result->wall_time = Benchmark::now() - start;
+      this->result->operations = this->num_jobs;
+      this->result->metrics["submission_wall_time"] = submission_end - start;
+      this->result->metrics["simulated_time"] = wrench::S4U_Simulation::getClock() - simulated_start;
+      return 0;
+    }
+};
+
+static BenchmarkResult runBatchServiceBenchmark(std::string host_selection_algorithm) {
+  unsigned long num_hosts = (unsigned long) (256 * Benchmark::scale);
+  unsigned long num_jobs = 4 * num_hosts;
+
+  BenchmarkResult result;
+  result.parameters = {{"num_hosts", num_hosts},
+                       {"num_jobs",  num_jobs}};
+
+  Benchmark::runSimulation("batch", num_hosts, 4, [&](wrench::Simulation *simulation) {
+      std::vector<std::string> hostnames = simulation->getHostnameList();
+      std::string hostname = hostnames[0];
+
+      wrench::ComputeService *batch_service = simulation->add(
+              new wrench::BatchService(hostname, true, false, hostnames, nullptr,
+                                       {{wrench::BatchServiceProperty::HOST_SELECTION_ALGORITHM, host_selection_algorithm}}));
+
+      return simulation->add(new BatchServiceBenchmarkWMS(&result, num_jobs, {batch_service}, hostname));
+  });
+  return result;
+}
+
+static BenchmarkResult benchmarkBatchServiceFirstFit() {
+  return runBatchServiceBenchmark("FIRSTFIT");
+}
+
+static BenchmarkResult benchmarkBatchServiceBestFit() {
+  return runBatchServiceBenchmark("BESTFIT");
+}
+
+REGISTER_BENCHMARK("batch_service/host_selection_firstfit", benchmarkBatchServiceFirstFit);
+REGISTER_BENCHMARK("batch_service/host_selection_bestfit", benchmarkBatchServiceBestFit);
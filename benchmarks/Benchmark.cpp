@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <wrench-dev.h>
+
+#include "include/Benchmark.h"
+
+double Benchmark::scale = 1.0;
+
+/**
+ * @brief Serialize a benchmark result
+ * @return a JSON object
+ */
+nlohmann::json BenchmarkResult::toJSON() const {
+  nlohmann::json json;
+  json["name"] = this->name;
+  json["parameters"] = this->parameters;
+  json["operations"] = this->operations;
+  json["wall_time"] = this->wall_time;
+  json["ns_per_operation"] = (this->operations > 0 ? 1.0e9 * this->wall_time / this->operations : 0.0);
+  json["metrics"] = this->metrics;
+  json["success"] = this->success;
+  if (not this->success) {
+    json["error"] = this->error;
+  }
+  return json;
+}
+
+/**
+ * @brief Deserialize a benchmark result
+ * @param json: a JSON object produced by toJSON()
+ * @return a benchmark result
+ */
+BenchmarkResult BenchmarkResult::fromJSON(const nlohmann::json &json) {
+  BenchmarkResult result;
+  result.name = json.at("name").get<std::string>();
+  result.parameters = json.at("parameters").get<std::map<std::string, double>>();
+  result.operations = json.at("operations").get<unsigned long>();
+  result.wall_time = json.at("wall_time").get<double>();
+  result.metrics = json.at("metrics").get<std::map<std::string, double>>();
+  result.success = json.at("success").get<bool>();
+  if (json.find("error") != json.end()) {
+    result.error = json.at("error").get<std::string>();
+  }
+  return result;
+}
+
+/**
+ * @brief Get the current wall-clock time
+ * @return a date in seconds (from a monotonic clock)
+ */
+double Benchmark::now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Run a benchmark in a separate process (SimGrid only allows one simulation
+ *        per process) and retrieve its result through a pipe
+ *
+ * @param benchmark: the benchmark
+ * @return the benchmark result
+ */
+BenchmarkResult Benchmark::runWithFork(const BenchmarkCase &benchmark) {
+
+  int fds[2];
+  if (pipe(fds) != 0) {
+    throw std::runtime_error("Benchmark::runWithFork(): cannot create pipe");
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    throw std::runtime_error("Benchmark::runWithFork(): cannot fork");
+  }
+
+  if (pid == 0) {
+    close(fds[0]);
+    BenchmarkResult result;
+    try {
+      result = benchmark.run();
+    } catch (std::exception &e) {
+      result.success = false;
+      result.error = e.what();
+    }
+    result.name = benchmark.name;
+    std::string serialized = result.toJSON().dump();
+    const char *ptr = serialized.c_str();
+    size_t remaining = serialized.size();
+    while (remaining > 0) {
+      ssize_t written = write(fds[1], ptr, remaining);
+      if (written <= 0) {
+        break;
+      }
+      ptr += written;
+      remaining -= written;
+    }
+    close(fds[1]);
+    _exit(0);
+  }
+
+  close(fds[1]);
+  std::string serialized;
+  char buffer[4096];
+  ssize_t num_read;
+  while ((num_read = read(fds[0], buffer, sizeof(buffer))) > 0) {
+    serialized.append(buffer, (size_t) num_read);
+  }
+  close(fds[0]);
+
+  int exit_code;
+  waitpid(pid, &exit_code, 0);
+
+  BenchmarkResult result;
+  try {
+    result = BenchmarkResult::fromJSON(nlohmann::json::parse(serialized));
+  } catch (std::exception &e) {
+    result.name = benchmark.name;
+    result.success = false;
+    result.error = "benchmark process terminated abnormally (status " + std::to_string(exit_code) + ")";
+  }
+  return result;
+}
+
+/**
+ * @brief Write a one-cluster platform description to a temporary file
+ *
+ * @param name: a name used to build the file path
+ * @param num_hosts: the number of hosts (named host0, host1, ...)
+ * @param num_cores: the number of cores per host
+ *
+ * @return the path of the platform file (which the caller must remove)
+ */
+std::string Benchmark::createClusterPlatformFile(std::string name, unsigned long num_hosts, unsigned long num_cores) {
+  std::string path = "/tmp/wrench_benchmark_" + name + "_" + std::to_string(getpid()) + ".xml";
+
+  std::string xml = "<?xml version='1.0'?>"
+          "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+          "<platform version=\"4.1\"> "
+          "   <zone id=\"AS0\" routing=\"Full\"> "
+          "       <cluster id=\"benchmark_cluster\" prefix=\"host\" suffix=\"\" radical=\"0-" +
+                    std::to_string(num_hosts - 1) + "\" speed=\"1f\" core=\"" + std::to_string(num_cores) + "\" "
+          "                bw=\"125GBps\" lat=\"0us\" bb_bw=\"2250GBps\" bb_lat=\"0us\"/> "
+          "   </zone> "
+          "</platform>";
+
+  FILE *platform_file = fopen(path.c_str(), "w");
+  if (platform_file == nullptr) {
+    throw std::runtime_error("Benchmark::createClusterPlatformFile(): cannot create " + path);
+  }
+  fprintf(platform_file, "%s", xml.c_str());
+  fclose(platform_file);
+  return path;
+}
+
+/**
+ * @brief Run a simulation on a one-cluster platform, taking care of the simulation
+ *        setup and teardown that all simulation benchmarks share
+ *
+ * @param name: a name used to build the (temporary) platform file path
+ * @param num_hosts: the number of hosts (named host0, host1, ...)
+ * @param num_cores: the number of cores per host
+ * @param setup: a function that adds services to the simulation and returns the WMS
+ *               (which is then given a workflow)
+ */
+void Benchmark::runSimulation(std::string name, unsigned long num_hosts, unsigned long num_cores,
+                              std::function<wrench::WMS *(wrench::Simulation *)> setup) {
+
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("wrench_benchmarks");
+  simulation->init(&argc, argv);
+
+  // The platform file is parsed right away, so it can be removed right away
+  std::string platform_file = createClusterPlatformFile(name, num_hosts, num_cores);
+  try {
+    simulation->instantiatePlatform(platform_file);
+  } catch (...) {
+    unlink(platform_file.c_str());
+    throw;
+  }
+  unlink(platform_file.c_str());
+
+  wrench::Workflow workflow;
+  wrench::WMS *wms = setup(simulation);
+  wms->addWorkflow(&workflow);
+
+  simulation->launch();
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
+
+/**
+ * @brief Get the list of registered benchmarks
+ * @return a list of benchmarks
+ */
+std::vector<BenchmarkCase> &Benchmark::getRegisteredBenchmarks() {
+  static std::vector<BenchmarkCase> benchmarks;
+  return benchmarks;
+}
+
+/**
+ * @brief Register a benchmark
+ * @param name: the benchmark name
+ * @param run: the benchmark function
+ * @return true
+ */
+bool Benchmark::registerBenchmark(std::string name, std::function<BenchmarkResult()> run) {
+  getRegisteredBenchmarks().push_back({std::move(name), std::move(run)});
+  return true;
+}
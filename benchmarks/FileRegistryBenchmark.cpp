@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+
+#include "include/Benchmark.h"
+
+/**********************************************************************/
+/**  FILE REGISTRY SERVICE LOOKUPS                                   **/
+/**********************************************************************/
+
+/**
+ * @brief A WMS that registers many file replicas and then looks them up
+ */
+class FileRegistryBenchmarkWMS : public wrench::WMS {
+
+public:
+    FileRegistryBenchmarkWMS(BenchmarkResult *result, unsigned long num_files, unsigned long num_lookups,
+                             const std::set<wrench::StorageService *> &storage_services,
+                             wrench::FileRegistryService *file_registry_service,
+                             std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, file_registry_service, hostname, "benchmark") {
+      this->result = result;
+      this->num_files = num_files;
+      this->num_lookups = num_lookups;
+    }
+
+private:
+
+    BenchmarkResult *result;
+    unsigned long num_files;
+    unsigned long num_lookups;
+
+    int main() {
+
+      wrench::FileRegistryService *frs = this->getAvailableFileRegistryService();
+
+      std::vector<wrench::WorkflowFile *> files;
+      for (unsigned long i = 0; i < this->num_files; i++) {
+        files.push_back(this->workflow->addFile("file_" + std::to_string(i), 1000.0));
+      }
+
+      double start = Benchmark::now();
+      for (auto f : files) {
+        for (auto ss : this->getAvailableStorageServices()) {
+          frs->addEntry(f, ss);
+        }
+      }
+      double add_end = Benchmark::now();
+
+      double simulated_start = wrench::S4U_Simulation::getClock();
+      unsigned long num_locations = 0;
+      for (unsigned long i = 0; i < this->num_lookups; i++) {
+        num_locations += frs->lookupEntry(files[(i * 7919) % files.size()]).size();
+      }
+      this->result->wall_time = Benchmark::now() - add_end;
+      this->result->operations = this->num_lookups;
+      this->result->metrics["add_entry_wall_time"] = add_end - start;
+      this->result->metrics["simulated_time"] = wrench::S4U_Simulation::getClock() - simulated_start;
+      this->result->metrics["num_locations_found"] = num_locations;
+      return 0;
+    }
+};
+
+static BenchmarkResult benchmarkFileRegistryLookups() {
+  unsigned long num_files = (unsigned long) (10000 * Benchmark::scale);
+  unsigned long num_lookups = (unsigned long) (20000 * Benchmark::scale);
+  unsigned long num_storage_services = 4;
+
+  BenchmarkResult result;
+  result.parameters = {{"num_files",            num_files},
+                       {"num_lookups",          num_lookups},
+                       {"num_storage_services", num_storage_services}};
+
+  Benchmark::runSimulation("file_registry", num_storage_services, 1, [&](wrench::Simulation *simulation) {
+      std::vector<std::string> hostnames = simulation->getHostnameList();
+      std::string hostname = hostnames[0];
+
+      std::set<wrench::StorageService *> storage_services;
+      for (auto const &h : hostnames) {
+        storage_services.insert(simulation->add(new wrench::SimpleStorageService(h, 10000000000000.0)));
+      }
+
+      wrench::FileRegistryService *file_registry_service =
+              simulation->setFileRegistryService(new wrench::FileRegistryService(hostname));
+
+      return simulation->add(
+              new FileRegistryBenchmarkWMS(&result, num_files, num_lookups, storage_services,
+                                           file_registry_service, hostname));
+  });
+  return result;
+}
+
+REGISTER_BENCHMARK("file_registry/lookup_entry", benchmarkFileRegistryLookups);
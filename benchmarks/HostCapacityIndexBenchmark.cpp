@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <deque>
+
+#include <wrench-dev.h>
+
+#include "include/Benchmark.h"
+
+/**********************************************************************/
+/**  HOST SELECTION AMONG H HOSTS (INDEX VS. LINEAR SCAN)            **/
+/**********************************************************************/
+
+/**
+ * @brief Best-fit host selection by scanning all hosts (as was done before the index)
+ */
+static std::string scanBestFit(std::map<std::string, std::pair<unsigned long, double>> &availabilities,
+                               unsigned long min_num_cores, unsigned long desired_num_cores, double ram) {
+  std::string target_host = "";
+  unsigned long target_num_cores = 0;
+  unsigned long target_slack = 0;
+  for (auto const &h : availabilities) {
+    unsigned long num_available_cores = h.second.first;
+    if ((num_available_cores < min_num_cores) or (h.second.second < ram)) {
+      continue;
+    }
+    unsigned long tentative_target_num_cores = std::min(num_available_cores, desired_num_cores);
+    unsigned long tentative_target_slack = num_available_cores - tentative_target_num_cores;
+    if ((target_host == "") or
+        (tentative_target_num_cores > target_num_cores) or
+        ((tentative_target_num_cores == target_num_cores) and (target_slack > tentative_target_slack))) {
+      target_host = h.first;
+      target_num_cores = tentative_target_num_cores;
+      target_slack = tentative_target_slack;
+    }
+  }
+  return target_host;
+}
+
+/**
+ * @brief Place a stream of 1- to 8-core requests on hosts, releasing the oldest
+ *        placement whenever a request cannot be placed
+ *
+ * @param host_selection_algorithm: "best_fit", "first_fit", "worst_fit", "cores_and_ram_best_fit",
+ *        or "scan" (best fit without the index)
+ */
+static BenchmarkResult runHostCapacityIndexBenchmark(std::string host_selection_algorithm) {
+  unsigned long num_hosts = (unsigned long) (10000 * Benchmark::scale);
+  unsigned long num_cores = 8;
+  // Queries that scan all hosts get fewer requests
+  unsigned long num_requests = (((host_selection_algorithm == "scan") or
+                                 (host_selection_algorithm == "cores_and_ram_best_fit")) ? 10000 : 100000);
+
+  BenchmarkResult result;
+  result.parameters = {{"num_hosts",    num_hosts},
+                       {"num_requests", num_requests}};
+
+  wrench::HostCapacityIndex index;
+  std::map<std::string, std::pair<unsigned long, double>> availabilities;
+  for (unsigned long i = 0; i < num_hosts; i++) {
+    std::string hostname = "host_" + std::to_string(i);
+    double ram = 1000.0 * (1 + (i % 4));
+    index.setCapacity(hostname, num_cores, ram);
+    availabilities[hostname] = std::make_pair(num_cores, ram);
+  }
+
+  std::deque<std::tuple<std::string, unsigned long, double>> placements;
+  unsigned long num_placed = 0;
+
+  double start = Benchmark::now();
+  for (unsigned long i = 0; i < num_requests; i++) {
+    unsigned long min_num_cores = 1 + (i * 7) % num_cores;
+    unsigned long desired_num_cores = std::min(num_cores, min_num_cores + (i % 3));
+    double ram = 250.0 * (i % 9);
+
+    while (true) {
+      std::string hostname;
+      if (host_selection_algorithm == "best_fit") {
+        hostname = index.findBestFit(min_num_cores, desired_num_cores, ram);
+      } else if (host_selection_algorithm == "first_fit") {
+        hostname = index.findFirstFit(min_num_cores, ram);
+      } else if (host_selection_algorithm == "worst_fit") {
+        hostname = index.findWorstFit(min_num_cores, ram);
+      } else if (host_selection_algorithm == "cores_and_ram_best_fit") {
+        hostname = index.findPackingFit(min_num_cores, desired_num_cores, ram, num_cores, 4000.0);
+      } else {
+        hostname = scanBestFit(availabilities, min_num_cores, desired_num_cores, ram);
+      }
+
+      if (not hostname.empty()) {
+        auto &availability = availabilities[hostname];
+        unsigned long allocated_num_cores = std::min(availability.first, desired_num_cores);
+        availability.first -= allocated_num_cores;
+        availability.second -= ram;
+        index.setCapacity(hostname, availability.first, availability.second);
+        placements.push_back(std::make_tuple(hostname, allocated_num_cores, ram));
+        num_placed++;
+        break;
+      }
+      if (placements.empty()) {
+        break;
+      }
+
+      // Release the oldest placement, and try again
+      auto &availability = availabilities[std::get<0>(placements.front())];
+      availability.first += std::get<1>(placements.front());
+      availability.second += std::get<2>(placements.front());
+      index.setCapacity(std::get<0>(placements.front()), availability.first, availability.second);
+      placements.pop_front();
+    }
+  }
+  result.wall_time = Benchmark::now() - start;
+  result.operations = num_requests;
+  result.metrics["num_placed"] = num_placed;
+  return result;
+}
+
+static BenchmarkResult benchmarkHostCapacityIndexBestFit() {
+  return runHostCapacityIndexBenchmark("best_fit");
+}
+
+static BenchmarkResult benchmarkHostCapacityIndexFirstFit() {
+  return runHostCapacityIndexBenchmark("first_fit");
+}
+
+static BenchmarkResult benchmarkHostCapacityIndexWorstFit() {
+  return runHostCapacityIndexBenchmark("worst_fit");
+}
+
+static BenchmarkResult benchmarkHostCapacityIndexCoresAndRamBestFit() {
+  return runHostCapacityIndexBenchmark("cores_and_ram_best_fit");
+}
+
+static BenchmarkResult benchmarkHostSelectionLinearScan() {
+  return runHostCapacityIndexBenchmark("scan");
+}
+
+REGISTER_BENCHMARK("host_capacity_index/best_fit", benchmarkHostCapacityIndexBestFit);
+REGISTER_BENCHMARK("host_capacity_index/first_fit", benchmarkHostCapacityIndexFirstFit);
+REGISTER_BENCHMARK("host_capacity_index/worst_fit", benchmarkHostCapacityIndexWorstFit);
+REGISTER_BENCHMARK("host_capacity_index/cores_and_ram_best_fit", benchmarkHostCapacityIndexCoresAndRamBestFit);
+REGISTER_BENCHMARK("host_capacity_index/linear_scan_best_fit", benchmarkHostSelectionLinearScan);
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include "wrench/simgrid_S4U_util/S4U_PendingCommunication.h"
+#include "wrench/simulation/SimulationMessage.h"
+
+#include "include/Benchmark.h"
+
+/**********************************************************************/
+/**  S4U_MAILBOX PUT/GET ROUND TRIPS                                 **/
+/**********************************************************************/
+
+/**
+ * @brief A WMS that sends messages to itself, either always on the same mailbox
+ *        or on a freshly generated mailbox each time (as synchronous RPCs do)
+ */
+class MailboxRoundTripBenchmarkWMS : public wrench::WMS {
+
+public:
+    MailboxRoundTripBenchmarkWMS(BenchmarkResult *result, unsigned long num_round_trips,
+                                 bool unique_mailboxes, std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "benchmark") {
+      this->result = result;
+      this->num_round_trips = num_round_trips;
+      this->unique_mailboxes = unique_mailboxes;
+    }
+
+private:
+
+    BenchmarkResult *result;
+    unsigned long num_round_trips;
+    bool unique_mailboxes;
+
+    int main() {
+
+      std::string mailbox = wrench::S4U_Mailbox::generateUniqueMailboxName("benchmark");
+
+      double simulated_start = wrench::S4U_Simulation::getClock();
+      double start = Benchmark::now();
+      for (unsigned long i = 0; i < this->num_round_trips; i++) {
+        if (this->unique_mailboxes) {
+          mailbox = wrench::S4U_Mailbox::generateUniqueMailboxName("benchmark");
+        }
+        std::unique_ptr<wrench::S4U_PendingCommunication> pending =
+                wrench::S4U_Mailbox::iputMessage(mailbox, new wrench::SimulationMessage("BENCHMARK", 1024));
+        std::unique_ptr<wrench::SimulationMessage> message = wrench::S4U_Mailbox::getMessage(mailbox);
+        pending->wait();
+      }
+      this->result->wall_time = Benchmark::now() - start;
+      this->result->operations = this->num_round_trips;
+      this->result->metrics["simulated_time"] = wrench::S4U_Simulation::getClock() - simulated_start;
+      return 0;
+    }
+};
+
+static BenchmarkResult runMailboxRoundTripBenchmark(bool unique_mailboxes) {
+  unsigned long num_round_trips = (unsigned long) (100000 * Benchmark::scale);
+
+  BenchmarkResult result;
+  result.parameters = {{"num_round_trips", num_round_trips}};
+
+  Benchmark::runSimulation("mailbox", 1, 1, [&](wrench::Simulation *simulation) {
+      std::string hostname = simulation->getHostnameList()[0];
+      return simulation->add(
+              new MailboxRoundTripBenchmarkWMS(&result, num_round_trips, unique_mailboxes, hostname));
+  });
+  return result;
+}
+
+static BenchmarkResult benchmarkMailboxRoundTripSameMailbox() {
+  return runMailboxRoundTripBenchmark(false);
+}
+
+static BenchmarkResult benchmarkMailboxRoundTripUniqueMailboxes() {
+  return runMailboxRoundTripBenchmark(true);
+}
+
+REGISTER_BENCHMARK("mailbox/round_trip_same_mailbox", benchmarkMailboxRoundTripSameMailbox);
+REGISTER_BENCHMARK("mailbox/round_trip_unique_mailboxes", benchmarkMailboxRoundTripUniqueMailboxes);
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+
+#include "include/Benchmark.h"
+
+/**********************************************************************/
+/**  TASK COMPLETION TRACE RECORDING AND TRAVERSAL                   **/
+/**********************************************************************/
+
+static BenchmarkResult benchmarkTaskCompletionTrace() {
+  unsigned long num_timestamps = (unsigned long) (1000000 * Benchmark::scale);
+
+  BenchmarkResult result;
+  result.parameters = {{"num_timestamps", num_timestamps}};
+
+  wrench::SimulationTrace<wrench::SimulationTimestampTaskCompletion> trace;
+
+  double start = Benchmark::now();
+  for (unsigned long i = 0; i < num_timestamps; i++) {
+    trace.addTimestamp((double) i, wrench::SimulationTimestampTaskCompletion(nullptr));
+  }
+  double add_end = Benchmark::now();
+
+  double sum = 0.0;
+  for (auto ts : wrench::SimulationTraceView<wrench::SimulationTimestampTaskCompletion>(&trace)) {
+    sum += ts->getDate();
+  }
+  double end = Benchmark::now();
+
+  result.wall_time = add_end - start;
+  result.operations = num_timestamps;
+  result.metrics["traversal_wall_time"] = end - add_end;
+  result.metrics["date_sum"] = sum;
+  return result;
+}
+
+REGISTER_BENCHMARK("simulation_trace/task_completions", benchmarkTaskCompletionTrace);
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
+#include "services/compute/standard_job_executor/StandardJobExecutorMessage.h"
+
+#include "include/Benchmark.h"
+
+/**********************************************************************/
+/**  STANDARD JOB EXECUTOR DISPATCH WITH M WORKUNITS                 **/
+/**********************************************************************/
+
+/**
+ * @brief A WMS that runs one standard job with many independent tasks on
+ *        a StandardJobExecutor and waits for its completion
+ */
+class StandardJobExecutorBenchmarkWMS : public wrench::WMS {
+
+public:
+    StandardJobExecutorBenchmarkWMS(BenchmarkResult *result, wrench::Simulation *simulation,
+                                    unsigned long num_tasks, std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "benchmark") {
+      this->result = result;
+      this->benchmark_simulation = simulation;
+      this->num_tasks = num_tasks;
+    }
+
+private:
+
+    BenchmarkResult *result;
+    wrench::Simulation *benchmark_simulation;
+    unsigned long num_tasks;
+
+    int main() {
+
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      std::vector<wrench::WorkflowTask *> tasks;
+      for (unsigned long i = 0; i < this->num_tasks; i++) {
+        tasks.push_back(this->workflow->addTask("task_" + std::to_string(i), 10.0 + (i % 7), 1, 1, 1.0));
+      }
+      wrench::StandardJob *job = job_manager->createStandardJob(tasks, {});
+
+      std::set<std::tuple<std::string, unsigned long, double>> compute_resources;
+      for (auto const &h : this->benchmark_simulation->getHostnameList()) {
+        compute_resources.insert(std::make_tuple(h, wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM));
+      }
+
+      std::string my_mailbox = wrench::S4U_Mailbox::generateUniqueMailboxName("benchmark_callback");
+
+      double simulated_start = wrench::S4U_Simulation::getClock();
+      double start = Benchmark::now();
+
+      std::shared_ptr<wrench::StandardJobExecutor> executor = std::shared_ptr<wrench::StandardJobExecutor>(
+              new wrench::StandardJobExecutor(
+                      this->benchmark_simulation,
+                      my_mailbox,
+                      this->hostname,
+                      job,
+                      compute_resources,
+                      nullptr,
+                      {}));
+      executor->start(executor, true);
+
+      std::unique_ptr<wrench::SimulationMessage> message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+      if (not dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get())) {
+        throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+      }
+
+      this->result->wall_time = Benchmark::now() - start;
+      this->result->operations = this->num_tasks;
+      this->result->metrics["simulated_time"] = wrench::S4U_Simulation::getClock() - simulated_start;
+      return 0;
+    }
+};
+
+static BenchmarkResult benchmarkStandardJobExecutorDispatch() {
+  unsigned long num_hosts = 16;
+  unsigned long num_cores = 16;
+  unsigned long num_tasks = (unsigned long) (2000 * Benchmark::scale);
+
+  BenchmarkResult result;
+  result.parameters = {{"num_hosts", num_hosts},
+                       {"num_cores", num_cores},
+                       {"num_workunits", num_tasks}};
+
+  Benchmark::runSimulation("executor", num_hosts, num_cores, [&](wrench::Simulation *simulation) {
+      std::string hostname = simulation->getHostnameList()[0];
+      return simulation->add(
+              new StandardJobExecutorBenchmarkWMS(&result, simulation, num_tasks, hostname));
+  });
+  return result;
+}
+
+REGISTER_BENCHMARK("standard_job_executor/dispatch", benchmarkStandardJobExecutorDispatch);
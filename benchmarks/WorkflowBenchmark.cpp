@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <fstream>
+#include <unistd.h>
+#include <wrench-dev.h>
+
+#include "include/Benchmark.h"
+
+/**
+ * The synthetic workflow used by these benchmarks has "width" tasks per level,
+ * and each task of a level depends on two tasks of the previous level (through
+ * a data dependency). It is fully deterministic.
+ */
+
+static std::string taskId(unsigned long level, unsigned long index) {
+  return "task_" + std::to_string(level) + "_" + std::to_string(index);
+}
+
+static std::string fileId(unsigned long level, unsigned long index) {
+  return "file_" + std::to_string(level) + "_" + std::to_string(index);
+}
+
+static std::vector<std::string> parentIds(unsigned long level, unsigned long index, unsigned long width) {
+  if (level == 0) {
+    return {};
+  }
+  if (width == 1) {
+    return {taskId(level - 1, 0)};
+  }
+  return {taskId(level - 1, index), taskId(level - 1, (index + 1) % width)};
+}
+
+static std::vector<std::string> parentFileIds(unsigned long level, unsigned long index, unsigned long width) {
+  if (level == 0) {
+    return {"input_" + std::to_string(index)};
+  }
+  if (width == 1) {
+    return {fileId(level - 1, 0)};
+  }
+  return {fileId(level - 1, index), fileId(level - 1, (index + 1) % width)};
+}
+
+/**
+ * @brief Write the synthetic workflow as a Pegasus DAX file
+ */
+static std::string writeSyntheticDAX(unsigned long num_levels, unsigned long width) {
+  std::string path = "/tmp/wrench_benchmark_workflow_" + std::to_string(getpid()) + ".dax";
+  std::ofstream dax(path);
+  dax << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+  dax << "<adag xmlns=\"http://pegasus.isi.edu/schema/DAX\" version=\"2.1\" name=\"benchmark\">\n";
+  for (unsigned long level = 0; level < num_levels; level++) {
+    for (unsigned long i = 0; i < width; i++) {
+      dax << "  <job id=\"" << taskId(level, i) << "\" name=\"bench\" runtime=\"10.0\">\n";
+      for (auto const &f : parentFileIds(level, i, width)) {
+        dax << "    <uses file=\"" << f << "\" link=\"input\" size=\"1000\"/>\n";
+      }
+      dax << "    <uses file=\"" << fileId(level, i) << "\" link=\"output\" size=\"1000\"/>\n";
+      dax << "  </job>\n";
+    }
+  }
+  for (unsigned long level = 1; level < num_levels; level++) {
+    for (unsigned long i = 0; i < width; i++) {
+      dax << "  <child ref=\"" << taskId(level, i) << "\">\n";
+      for (auto const &p : parentIds(level, i, width)) {
+        dax << "    <parent ref=\"" << p << "\"/>\n";
+      }
+      dax << "  </child>\n";
+    }
+  }
+  dax << "</adag>\n";
+  return path;
+}
+
+/**
+ * @brief Write the synthetic workflow as a JSON file
+ */
+static std::string writeSyntheticJSON(unsigned long num_levels, unsigned long width) {
+  nlohmann::json jobs = nlohmann::json::array();
+  for (unsigned long level = 0; level < num_levels; level++) {
+    for (unsigned long i = 0; i < width; i++) {
+      nlohmann::json job;
+      job["type"] = "compute";
+      job["name"] = taskId(level, i);
+      job["runtime"] = 10.0;
+      job["files"] = nlohmann::json::array();
+      for (auto const &f : parentFileIds(level, i, width)) {
+        job["files"].push_back({{"link", "input"}, {"name", f}, {"size", 1000}});
+      }
+      job["files"].push_back({{"link", "output"}, {"name", fileId(level, i)}, {"size", 1000}});
+      job["parents"] = parentIds(level, i, width);
+      jobs.push_back(job);
+    }
+  }
+  nlohmann::json j;
+  j["name"] = "benchmark";
+  j["workflow"]["jobs"] = jobs;
+
+  std::string path = "/tmp/wrench_benchmark_workflow_" + std::to_string(getpid()) + ".json";
+  std::ofstream json_file(path);
+  json_file << j.dump();
+  return path;
+}
+
+/**
+ * @brief Build the synthetic workflow through the API
+ */
+static void buildSyntheticWorkflow(wrench::Workflow *workflow, unsigned long num_levels, unsigned long width) {
+  for (unsigned long level = 0; level < num_levels; level++) {
+    for (unsigned long i = 0; i < width; i++) {
+      wrench::WorkflowTask *task = workflow->addTask(taskId(level, i), 10.0);
+      for (auto const &p : parentIds(level, i, width)) {
+        workflow->addControlDependency(workflow->getWorkflowTaskByID(p), task);
+      }
+    }
+  }
+}
+
+/**********************************************************************/
+/**  DAX / JSON LOADING                                              **/
+/**********************************************************************/
+
+static BenchmarkResult benchmarkLoadFromDAX() {
+  unsigned long num_levels = (unsigned long) (20 * Benchmark::scale);
+  unsigned long width = 50;
+  std::string path = writeSyntheticDAX(num_levels, width);
+
+  BenchmarkResult result;
+  result.parameters = {{"num_tasks", num_levels * width}};
+
+  double start = Benchmark::now();
+  wrench::Workflow workflow;
+  workflow.loadFromDAX(path);
+  result.wall_time = Benchmark::now() - start;
+  result.operations = workflow.getNumberOfTasks();
+
+  unlink(path.c_str());
+  return result;
+}
+
+REGISTER_BENCHMARK("workflow/load_from_dax", benchmarkLoadFromDAX);
+
+static BenchmarkResult benchmarkLoadFromJSON() {
+  unsigned long num_levels = (unsigned long) (20 * Benchmark::scale);
+  unsigned long width = 50;
+  std::string path = writeSyntheticJSON(num_levels, width);
+
+  BenchmarkResult result;
+  result.parameters = {{"num_tasks", num_levels * width}};
+
+  double start = Benchmark::now();
+  wrench::Workflow workflow;
+  workflow.loadFromJSON(path);
+  result.wall_time = Benchmark::now() - start;
+  result.operations = workflow.getNumberOfTasks();
+
+  unlink(path.c_str());
+  return result;
+}
+
+REGISTER_BENCHMARK("workflow/load_from_json", benchmarkLoadFromJSON);
+
+/**********************************************************************/
+/**  READY TASKS / TASK STATE UPDATES                                **/
+/**********************************************************************/
+
+/**
+ * @brief "Execute" the synthetic workflow level by level, as a WMS would, by
+ *        repeatedly calling getReadyTasks() and updateTaskState()
+ */
+static BenchmarkResult benchmarkReadyTasksAndStateUpdates() {
+  unsigned long num_levels = (unsigned long) (50 * Benchmark::scale);
+  unsigned long width = 100;
+
+  wrench::Workflow workflow;
+  buildSyntheticWorkflow(&workflow, num_levels, width);
+
+  BenchmarkResult result;
+  result.parameters = {{"num_tasks", num_levels * width}};
+
+  unsigned long num_ready_tasks_calls = 0;
+  unsigned long num_state_updates = 0;
+
+  double start = Benchmark::now();
+  while (not workflow.isDone()) {
+    std::map<std::string, std::vector<wrench::WorkflowTask *>> ready_tasks = workflow.getReadyTasks();
+    num_ready_tasks_calls++;
+    if (ready_tasks.empty()) {
+      throw std::runtime_error("No ready tasks while the workflow is not done");
+    }
+    for (auto const &entry : ready_tasks) {
+      for (auto task : entry.second) {
+        workflow.updateTaskState(task, wrench::WorkflowTask::RUNNING);
+        workflow.updateTaskState(task, wrench::WorkflowTask::COMPLETED);
+        num_state_updates += 2;
+      }
+    }
+  }
+  result.wall_time = Benchmark::now() - start;
+  result.operations = num_ready_tasks_calls + num_state_updates;
+  result.metrics = {{"get_ready_tasks_calls", num_ready_tasks_calls},
+                    {"update_task_state_calls", num_state_updates}};
+  return result;
+}
+
+REGISTER_BENCHMARK("workflow/ready_tasks_and_state_updates", benchmarkReadyTasksAndStateUpdates);
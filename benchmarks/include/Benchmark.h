@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_BENCHMARK_H
+#define WRENCH_BENCHMARK_H
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <json.hpp>
+
+namespace wrench {
+    class Simulation;
+    class WMS;
+}
+
+/**
+ * @brief The outcome of running one microbenchmark
+ */
+struct BenchmarkResult {
+    /** @brief The benchmark name */
+    std::string name;
+    /** @brief The benchmark input parameters (e.g., number of hosts) */
+    std::map<std::string, double> parameters;
+    /** @brief The number of timed operations */
+    unsigned long operations = 0;
+    /** @brief The wall-clock time of the timed section, in seconds */
+    double wall_time = 0.0;
+    /** @brief Additional measurements (e.g., simulated time) */
+    std::map<std::string, double> metrics;
+    /** @brief Whether the benchmark ran to completion */
+    bool success = true;
+    /** @brief An error message, if the benchmark failed */
+    std::string error;
+
+    nlohmann::json toJSON() const;
+
+    static BenchmarkResult fromJSON(const nlohmann::json &json);
+};
+
+/**
+ * @brief A registered microbenchmark
+ */
+struct BenchmarkCase {
+    /** @brief The benchmark name */
+    std::string name;
+    /** @brief The function that runs the benchmark (in a forked process) */
+    std::function<BenchmarkResult()> run;
+};
+
+/**
+ * @brief Helpers shared by all microbenchmarks
+ */
+class Benchmark {
+
+public:
+
+    static double now();
+
+    static BenchmarkResult runWithFork(const BenchmarkCase &benchmark);
+
+    static std::string createClusterPlatformFile(std::string name, unsigned long num_hosts, unsigned long num_cores);
+
+    static void runSimulation(std::string name, unsigned long num_hosts, unsigned long num_cores,
+                              std::function<wrench::WMS *(wrench::Simulation *)> setup);
+
+    static std::vector<BenchmarkCase> &getRegisteredBenchmarks();
+
+    static bool registerBenchmark(std::string name, std::function<BenchmarkResult()> run);
+
+    /** @brief Scaling factor applied to all benchmark sizes (set from the command line) */
+    static double scale;
+};
+
+/**
+ * @brief Convenient macro to register a benchmark function at static initialization time
+ */
+#define REGISTER_BENCHMARK(name, function) \
+        static bool benchmark_registered_##function = Benchmark::registerBenchmark(name, function)
+
+#endif //WRENCH_BENCHMARK_H
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <xbt.h>
+
+#include "include/Benchmark.h"
+
+/**
+ * @brief Run all registered WRENCH microbenchmarks (each one in its own process)
+ *        and print the results as a JSON document
+ *
+ * Usage: wrench_benchmarks [--filter <substring>] [--scale <factor>] [--output <file>]
+ */
+int main(int argc, char **argv) {
+
+  // disable log
+  xbt_log_control_set("root.thresh:critical");
+
+  std::string filter;
+  std::string output_file;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if ((arg == "--filter") and (i + 1 < argc)) {
+      filter = argv[++i];
+    } else if ((arg == "--scale") and (i + 1 < argc)) {
+      Benchmark::scale = std::stod(argv[++i]);
+    } else if ((arg == "--output") and (i + 1 < argc)) {
+      output_file = argv[++i];
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--filter <substring>] [--scale <factor>] [--output <file>]" << std::endl;
+      return 1;
+    }
+  }
+
+  nlohmann::json report;
+  report["scale"] = Benchmark::scale;
+  report["benchmarks"] = nlohmann::json::array();
+
+  bool all_succeeded = true;
+  for (auto const &benchmark : Benchmark::getRegisteredBenchmarks()) {
+    if ((not filter.empty()) and (benchmark.name.find(filter) == std::string::npos)) {
+      continue;
+    }
+    std::cerr << "Running " << benchmark.name << "..." << std::endl;
+    BenchmarkResult result = Benchmark::runWithFork(benchmark);
+    if (not result.success) {
+      std::cerr << "  FAILED: " << result.error << std::endl;
+      all_succeeded = false;
+    }
+    report["benchmarks"].push_back(result.toJSON());
+  }
+
+  if (output_file.empty()) {
+    std::cout << report.dump(2) << std::endl;
+  } else {
+    std::ofstream output(output_file);
+    output << report.dump(2) << std::endl;
+  }
+
+  return (all_succeeded ? 0 : 1);
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <json.hpp>
+#include <wrench.h>
+
+#include "SimpleWMS.h"
+#include "scheduler/BatchStandardJobScheduler.h"
+#include "scheduler/CloudStandardJobScheduler.h"
+#include "scheduler/RandomStandardJobScheduler.h"
+
+/*
+ * Ensemble runner: runs a list of independent SimpleWMS simulations, in parallel, using
+ * a bounded pool of worker processes, and prints their results as JSON. Each line of the
+ * configuration file describes one simulation:
+ *
+ *    <name> <multicore|batch|cloud> <xml platform file> <workflow file (.dax or .json)>
+ *
+ * Empty lines and lines starting with '#' are ignored.
+ */
+
+/**
+ * @brief Set up a SimpleWMS simulation
+ *
+ * @param simulation: the (initialized) simulation
+ * @param service_type: "multicore", "batch", or "cloud"
+ * @param platform_file: the platform description file
+ * @param workflow_file: the workflow description file
+ */
+static void setupSimulation(wrench::Simulation *simulation, const std::string &service_type,
+                            const std::string &platform_file, const std::string &workflow_file) {
+
+  /* The workflow is leaked on purpose, as the worker process terminates right after the simulation */
+  auto workflow = new wrench::Workflow();
+  if ((workflow_file.size() > 5) and (workflow_file.substr(workflow_file.size() - 5) == ".json")) {
+    workflow->loadFromJSON(workflow_file);
+  } else {
+    workflow->loadFromDAX(workflow_file);
+  }
+
+  simulation->instantiatePlatform(platform_file);
+  std::vector<std::string> hostname_list = simulation->getHostnameList();
+  std::string wms_host = hostname_list[0];
+
+  wrench::StorageService *storage_service = simulation->add(
+          new wrench::SimpleStorageService(wms_host, 10000000000000.0));
+  simulation->setFileRegistryService(new wrench::FileRegistryService(wms_host));
+
+  wrench::ComputeService *compute_service = nullptr;
+  std::unique_ptr<wrench::StandardJobScheduler> scheduler;
+  if (service_type == "multicore") {
+    compute_service = simulation->add(new wrench::MultihostMulticoreComputeService(
+            wms_host, true, false, std::set<std::string>(hostname_list.begin(), hostname_list.end()),
+            storage_service, {}));
+    scheduler = std::unique_ptr<wrench::StandardJobScheduler>(new wrench::RandomStandardJobScheduler());
+  } else if (service_type == "batch") {
+    compute_service = simulation->add(new wrench::BatchService(
+            wms_host, true, false, hostname_list, storage_service, {}));
+    scheduler = std::unique_ptr<wrench::StandardJobScheduler>(new wrench::BatchStandardJobScheduler());
+  } else if (service_type == "cloud") {
+    compute_service = simulation->add(new wrench::CloudService(
+            wms_host, true, false, hostname_list, storage_service, {}));
+    scheduler = std::unique_ptr<wrench::StandardJobScheduler>(new wrench::CloudStandardJobScheduler());
+  } else {
+    throw std::invalid_argument("Unknown compute service type '" + service_type + "'");
+  }
+
+  wrench::WMS *wms = simulation->add(
+          new wrench::SimpleWMS(std::move(scheduler), nullptr, {compute_service}, {storage_service}, wms_host));
+  wms->addWorkflow(workflow);
+
+  simulation->stageFiles(workflow->getInputFiles(), storage_service);
+}
+
+int main(int argc, char **argv) {
+
+  unsigned long num_workers = 0;
+  std::string configuration_file;
+
+  if ((argc == 4) and (std::string(argv[1]) == "-j")) {
+    num_workers = std::stoul(argv[2]);
+    configuration_file = argv[3];
+  } else if (argc == 2) {
+    configuration_file = argv[1];
+  } else {
+    std::cerr << "Usage: " << argv[0] << " [-j <max number of concurrent simulations>] <configuration file>"
+              << std::endl;
+    std::cerr << "  (each configuration line: <name> <multicore|batch|cloud> <xml platform file> <workflow file>)"
+              << std::endl;
+    exit(1);
+  }
+
+  /* Parse the configuration file */
+  std::ifstream file(configuration_file);
+  if (not file) {
+    std::cerr << "Cannot open configuration file '" << configuration_file << "'" << std::endl;
+    exit(1);
+  }
+
+  std::vector<wrench::EnsembleConfiguration> configurations;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream tokens(line);
+    std::string name, service_type, platform_file, workflow_file;
+    if (not(tokens >> name) or (name[0] == '#')) {
+      continue;
+    }
+    if (not(tokens >> service_type >> platform_file >> workflow_file)) {
+      std::cerr << "Invalid configuration line: " << line << std::endl;
+      exit(1);
+    }
+    configurations.push_back(wrench::EnsembleConfiguration(
+            name, [service_type, platform_file, workflow_file](wrench::Simulation *simulation) {
+              setupSimulation(simulation, service_type, platform_file, workflow_file);
+            }, {"--log=root.thres:critical"}));
+  }
+
+  /* Run the ensemble */
+  wrench::EnsembleRunner runner(num_workers);
+  std::cerr << "Running " << configurations.size() << " simulations with up to "
+            << runner.getMaxNumWorkers() << " concurrent workers..." << std::endl;
+  std::vector<wrench::EnsembleResult> results = runner.run(configurations);
+
+  /* Report */
+  nlohmann::json report = nlohmann::json::array();
+  bool all_succeeded = true;
+  for (auto const &result : results) {
+    nlohmann::json entry;
+    entry["name"] = result.name;
+    entry["success"] = result.success;
+    if (not result.success) {
+      entry["failure_cause"] = result.failure_cause;
+      all_succeeded = false;
+    }
+    entry["wall_time"] = result.wall_time;
+    entry["simulated_end_date"] = result.simulated_end_date;
+    entry["num_completed_tasks"] = result.task_completion_dates.size();
+    double makespan = 0.0;
+    for (auto const &completion : result.task_completion_dates) {
+      makespan = std::max<double>(makespan, completion.second);
+    }
+    entry["makespan"] = makespan;
+    report.push_back(entry);
+  }
+  std::cout << report.dump(2) << std::endl;
+
+  return (all_succeeded ? 0 : 1);
+}
@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <fstream>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <json.hpp>
+#include <wrench.h>
+#include <wrench/simgrid_S4U_util/S4U_Daemon.h>
+#include <wrench/simgrid_S4U_util/S4U_Mailbox.h>
+
+#include "SimpleWMS.h"
+#include "scheduler/BatchStandardJobScheduler.h"
+#include "scheduler/CloudStandardJobScheduler.h"
+#include "scheduler/RandomStandardJobScheduler.h"
+
+/*
+ * End-to-end scale test: generates a platform with N hosts and a workflow with M tasks,
+ * executes the workflow with the SimpleWMS on a multicore, batch, or cloud compute
+ * service, and reports the wall-clock time, the peak resident set size, the number of
+ * simulated actors that were created, the number of messages that were exchanged, and
+ * the number of heap allocations performed during the simulation.
+ */
+
+/** @brief The number of heap allocations performed by the process so far */
+static std::atomic<unsigned long> num_allocations(0);
+
+/*
+ * Replacements of the global allocation functions, which count heap allocations
+ * (the array forms, by default, call these)
+ */
+void *operator new(std::size_t size) {
+  num_allocations++;
+  void *ptr = std::malloc(size ? size : 1);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+/**
+ * @brief Get the wall-clock time
+ * @return a date in seconds (from a monotonic clock)
+ */
+static double now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Get the peak resident set size of the process
+ * @return a size in bytes
+ */
+static double getPeakRSS() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return 1024.0 * usage.ru_maxrss;
+}
+
+/**
+ * @brief Write a platform description with one cluster of hosts (named host0, host1, ...)
+ *
+ * @param num_hosts: the number of hosts
+ * @param num_cores: the number of cores per host
+ *
+ * @return the path to the platform file
+ */
+static std::string generatePlatform(unsigned long num_hosts, unsigned long num_cores) {
+  std::string path = "/tmp/wrench_scale_test_platform_" + std::to_string(getpid()) + ".xml";
+  std::ofstream xml(path);
+  xml << "<?xml version='1.0'?>\n"
+      << "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">\n"
+      << "<platform version=\"4.1\">\n"
+      << "  <zone id=\"AS0\" routing=\"Full\">\n"
+      << "    <cluster id=\"scale_test_cluster\" prefix=\"host\" suffix=\"\" radical=\"0-" << (num_hosts - 1) << "\"\n"
+      << "             speed=\"1f\" core=\"" << num_cores << "\" bw=\"125GBps\" lat=\"0us\"\n"
+      << "             bb_bw=\"2250GBps\" bb_lat=\"0us\"/>\n"
+      << "  </zone>\n"
+      << "</platform>\n";
+  return path;
+}
+
+/**
+ * @brief Generate a layered workflow in which each task depends on (at most) two
+ *        tasks of the previous level through data dependencies
+ *
+ * @param workflow: the workflow to populate
+ * @param num_tasks: the number of tasks
+ * @param width: the number of tasks per level
+ */
+static void generateWorkflow(wrench::Workflow *workflow, unsigned long num_tasks, unsigned long width) {
+  std::vector<wrench::WorkflowTask *> previous_level;
+  std::vector<wrench::WorkflowTask *> current_level;
+
+  for (unsigned long i = 0; i < num_tasks; i++) {
+    unsigned long index = i % width;
+    if ((index == 0) and (i > 0)) {
+      previous_level = current_level;
+      current_level.clear();
+    }
+
+    wrench::WorkflowTask *task = workflow->addTask("task_" + std::to_string(i), 100.0 + (i % 10), 1, 1, 1.0);
+    task->addOutputFile(workflow->addFile("file_" + std::to_string(i), 1000000.0));
+
+    if (previous_level.empty()) {
+      task->addInputFile(workflow->addFile("input_" + std::to_string(i), 1000000.0));
+    } else {
+      std::set<wrench::WorkflowTask *> parents = {previous_level[index % previous_level.size()],
+                                                  previous_level[(index + 1) % previous_level.size()]};
+      for (auto parent : parents) {
+        task->addInputFile(*(parent->getOutputFiles().begin()));
+      }
+    }
+    current_level.push_back(task);
+  }
+}
+
+int main(int argc, char **argv) {
+
+  double start = now();
+
+  wrench::Simulation simulation;
+  simulation.init(&argc, argv);
+
+  if ((argc < 4) or (argc > 6)) {
+    std::cerr << "Usage: " << argv[0]
+              << " <multicore|batch|cloud> <num hosts> <num tasks> [num cores per host (default: 8)]"
+              << " [workflow width (default: 100)]" << std::endl;
+    exit(1);
+  }
+
+  std::string service_type = argv[1];
+  unsigned long num_hosts = std::stoul(argv[2]);
+  unsigned long num_tasks = std::stoul(argv[3]);
+  unsigned long num_cores = (argc > 4) ? std::stoul(argv[4]) : 8;
+  unsigned long width = (argc > 5) ? std::stoul(argv[5]) : 100;
+
+  if ((service_type != "multicore") and (service_type != "batch") and (service_type != "cloud")) {
+    std::cerr << "Unknown compute service type '" << service_type << "'" << std::endl;
+    exit(1);
+  }
+  if ((num_hosts < 1) or (num_tasks < 1) or (num_cores < 1) or (width < 1)) {
+    std::cerr << "The number of hosts, tasks, cores, and the workflow width should be at least 1" << std::endl;
+    exit(1);
+  }
+
+  /* Generate the workflow and the platform */
+  std::cerr << "Generating a workflow with " << num_tasks << " tasks..." << std::endl;
+  wrench::Workflow workflow;
+  generateWorkflow(&workflow, num_tasks, width);
+
+  std::cerr << "Generating and instantiating a platform with " << num_hosts << " hosts..." << std::endl;
+  std::string platform_file = generatePlatform(num_hosts, num_cores);
+  simulation.instantiatePlatform(platform_file);
+  unlink(platform_file.c_str());
+
+  std::vector<std::string> hostname_list = simulation.getHostnameList();
+  std::string wms_host = hostname_list[0];
+
+  /* Instantiate the storage service, the file registry service, and the compute service */
+  wrench::StorageService *storage_service = simulation.add(
+          new wrench::SimpleStorageService(wms_host, 10000000000000000.0));
+  simulation.setFileRegistryService(new wrench::FileRegistryService(wms_host));
+
+  wrench::ComputeService *compute_service = nullptr;
+  std::unique_ptr<wrench::StandardJobScheduler> scheduler;
+  if (service_type == "multicore") {
+    compute_service = simulation.add(new wrench::MultihostMulticoreComputeService(
+            wms_host, true, false, std::set<std::string>(hostname_list.begin(), hostname_list.end()),
+            storage_service, {}));
+    scheduler = std::unique_ptr<wrench::StandardJobScheduler>(new wrench::RandomStandardJobScheduler());
+  } else if (service_type == "batch") {
+    compute_service = simulation.add(new wrench::BatchService(
+            wms_host, true, false, hostname_list, storage_service, {}));
+    scheduler = std::unique_ptr<wrench::StandardJobScheduler>(new wrench::BatchStandardJobScheduler());
+  } else {
+    compute_service = simulation.add(new wrench::CloudService(
+            wms_host, true, false, hostname_list, storage_service, {}));
+    scheduler = std::unique_ptr<wrench::StandardJobScheduler>(new wrench::CloudStandardJobScheduler());
+  }
+
+  /* Instantiate the WMS */
+  wrench::WMS *wms = simulation.add(
+          new wrench::SimpleWMS(std::move(scheduler), nullptr, {compute_service}, {storage_service}, wms_host));
+  wms->addWorkflow(&workflow);
+
+  /* Stage the workflow input files */
+  simulation.stageFiles(workflow.getInputFiles(), storage_service);
+
+  double setup_end = now();
+  double setup_rss = getPeakRSS();
+  unsigned long setup_num_allocations = num_allocations;
+
+  /* Launch the simulation */
+  std::cerr << "Launching the simulation (" << service_type << " compute service)..." << std::endl;
+  try {
+    simulation.launch();
+  } catch (std::runtime_error &e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  double end = now();
+  unsigned long simulation_num_allocations = num_allocations - setup_num_allocations;
+
+  unsigned long num_completed_tasks = 0;
+  double makespan = 0.0;
+  for (auto task : workflow.getTasks()) {
+    if (task->getState() == wrench::WorkflowTask::COMPLETED) {
+      num_completed_tasks++;
+      makespan = std::max<double>(makespan, task->getEndDate());
+    }
+  }
+
+  /* Report */
+  nlohmann::json report;
+  report["compute_service"] = service_type;
+  report["num_hosts"] = num_hosts;
+  report["num_cores_per_host"] = num_cores;
+  report["num_tasks"] = num_tasks;
+  report["workflow_width"] = width;
+  report["num_completed_tasks"] = num_completed_tasks;
+  report["simulated_makespan"] = makespan;
+  report["setup_wall_time"] = setup_end - start;
+  report["simulation_wall_time"] = end - setup_end;
+  report["total_wall_time"] = end - start;
+  report["setup_peak_rss"] = setup_rss;
+  report["peak_rss"] = getPeakRSS();
+  report["num_allocations"] = simulation_num_allocations;
+  report["num_allocations_per_task"] = (double) simulation_num_allocations / (double) num_tasks;
+  report["num_actors_created"] = wrench::S4U_Daemon::getNumStartedDaemons();
+  report["num_messages_exchanged"] = wrench::S4U_Mailbox::getNumSentMessages();
+  report["num_mailbox_names_generated"] = wrench::S4U_Mailbox::getNumGeneratedMailboxNames();
+  report["ideal_control_plane"] = wrench::S4U_Mailbox::isIdealControlPlane();
+  report["num_messages_delivered_in_memory"] = wrench::S4U_Mailbox::getNumMemoryMessages();
+
+  std::cout << report.dump(2) << std::endl;
+
+  return (num_completed_tasks == num_tasks ? 0 : 1);
+}
@@ -156,8 +156,8 @@ int main(int argc, char **argv) {
    * of events. In the code below, we retrieve the trace of all task completion events, print how
    * many such events there are, and print some information for the first such event.
    */
-  std::vector<wrench::SimulationTimestamp<wrench::SimulationTimestampTaskCompletion> *> trace;
-  trace = simulation.output.getTrace<wrench::SimulationTimestampTaskCompletion>();
+  wrench::SimulationTraceView<wrench::SimulationTimestampTaskCompletion> trace =
+          simulation.output.getTrace<wrench::SimulationTimestampTaskCompletion>();
   std::cerr << "Number of entries in TaskCompletion trace: " << trace.size() << std::endl;
   std::cerr << "Task in first trace entry: " << trace[0]->getContent()->getTask()->getId() << std::endl;
 
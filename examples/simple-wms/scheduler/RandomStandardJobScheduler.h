@@ -22,8 +22,6 @@ namespace wrench {
 
     public:
 
-        RandomStandardJobScheduler(JobManager *job_manager) : job_manager(job_manager) {}
-
         /***********************/
         /** \cond DEVELOPER    */
         /***********************/
@@ -31,9 +29,6 @@ namespace wrench {
         void scheduleTasks(const std::set<ComputeService *> &compute_services,
                            const std::map<std::string, std::vector<WorkflowTask *>> &tasks);
 
-    private:
-        JobManager *job_manager;
-
         /***********************/
         /** \endcond           */
         /***********************/
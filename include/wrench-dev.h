@@ -19,6 +19,9 @@
 #include "wrench/services/compute/ComputeService.h"
 #include "wrench/services/compute/ComputeServiceProperty.h"
 #include "wrench/services/compute/ComputeServiceMessage.h"
+#include "wrench/services/compute/ResourceAllocation.h"
+#include "wrench/services/compute/HostCapacityIndex.h"
+#include "wrench/services/compute/MoldableCoreAllocator.h"
 #include "wrench/services/ServiceMessage.h"
 
 // Storage Services
@@ -47,6 +50,7 @@
 
 // Simgrid Util
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simgrid_S4U_util/S4U_HostRegistry.h"
 
 
 #endif //WRENCH_WRENCH_DEV_H
@@ -41,6 +41,12 @@
 // Simulation Output Analysis
 #include "wrench/simulation/SimulationTimestamp.h"
 #include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/simulation/CriticalPathAnalyzer.h"
+#include "wrench/simulation/TimelineExporter.h"
+#include "wrench/services/compute/UtilizationRecorder.h"
+
+// Ensembles of Independent Simulations
+#include "wrench/simulation/EnsembleRunner.h"
 
 
 
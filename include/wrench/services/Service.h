@@ -16,6 +16,7 @@
 #include <map>
 
 #include <wrench/simgrid_S4U_util/S4U_Daemon.h>
+#include <wrench/services/ServiceFuture.h>
 
 namespace wrench {
 
@@ -80,6 +81,8 @@ namespace wrench {
 
         void serviceSanityCheck();
 
+        void sendRequestAsynchronously(ServiceFutureBase *future, SimulationMessage *request);
+
         /** @brief The service's property list */
         std::map<std::string, std::string> property_list;
 
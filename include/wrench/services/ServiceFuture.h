@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SERVICEFUTURE_H
+#define WRENCH_SERVICEFUTURE_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "wrench/simulation/SimulationMessage.h"
+
+namespace wrench {
+
+    class FailureCause;
+
+    /**
+     * @brief The (result type-independent part of the) future answer to an asynchronous
+     *        request sent to a service, which makes it possible to wait for several such
+     *        answers at once. The answer is sent to the reply mailbox of the actor that
+     *        creates the future (with the future's correlation id), and a future should only
+     *        be used by that actor.
+     */
+    class ServiceFutureBase {
+
+    public:
+
+        virtual ~ServiceFutureBase();
+
+        bool isReady();
+
+        static void waitAll(const std::vector<ServiceFutureBase *> &futures);
+
+        static unsigned long waitAny(const std::vector<ServiceFutureBase *> &futures);
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        std::string getReplyMailbox();
+
+        unsigned long getCorrelationId();
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+    protected:
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        ServiceFutureBase();
+
+        SimulationMessage *getAnswer();
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+    private:
+
+        void receive();
+
+        std::string reply_mailbox;
+        unsigned long correlation_id;
+        std::unique_ptr<SimulationMessage> answer;
+        std::shared_ptr<FailureCause> failure_cause;
+    };
+
+    /**
+     * @brief The future answer to an asynchronous request sent to a service
+     *
+     * @tparam T: the type of the result of the request
+     */
+    template<class T>
+    class ServiceFuture : public ServiceFutureBase {
+
+    public:
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        /**
+         * @brief Constructor (the request should then be sent with the future's reply mailbox
+         *        and correlation id)
+         *
+         * @param decoder: a function that extracts the result from the answer message
+         *                 (and throws if the answer message is unexpected or is a failure)
+         */
+        explicit ServiceFuture(std::function<T(SimulationMessage *)> decoder) :
+                ServiceFutureBase(), decoder(std::move(decoder)) {
+        }
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+        /**
+         * @brief Get the result of the request, waiting for the answer if need be
+         *
+         * @return the result
+         *
+         * @throw WorkflowExecutionException
+         * @throw std::runtime_error
+         */
+        T get() {
+          return this->decoder(this->getAnswer());
+        }
+
+    private:
+
+        std::function<T(SimulationMessage *)> decoder;
+    };
+
+};
+
+#endif //WRENCH_SERVICEFUTURE_H
@@ -11,12 +11,14 @@
 #define SIMULATION_COMPUTESERVICE_H
 
 #include <map>
+#include <memory>
 
 #include <iostream>
 #include <cfloat>
 #include <climits>
 
 #include "wrench/services/Service.h"
+#include "wrench/services/compute/UtilizationRecorder.h"
 #include "wrench/workflow/job/WorkflowJob.h"
 
 namespace wrench {
@@ -67,10 +69,22 @@ namespace wrench {
 
         double getTTL();
 
+        std::unique_ptr<ServiceFuture<std::vector<unsigned long>>> getNumCoresAsync();
+
+        std::unique_ptr<ServiceFuture<std::vector<unsigned long>>> getNumIdleCoresAsync();
+
+        std::unique_ptr<ServiceFuture<std::vector<double>>> getMemoryCapacityAsync();
+
+        std::unique_ptr<ServiceFuture<std::vector<double>>> getCoreFlopRateAsync();
+
         void setDefaultStorageService(StorageService *storage_service);
 
         StorageService *getDefaultStorageService();
 
+        void setUtilizationRecorder(std::shared_ptr<UtilizationRecorder> recorder);
+
+        std::shared_ptr<UtilizationRecorder> getUtilizationRecorder();
+
         virtual void
         submitStandardJob(StandardJob *job, std::map<std::string, std::string> &service_specific_arguments) = 0;
 
@@ -106,11 +120,23 @@ namespace wrench {
         bool supports_standard_jobs;
         /** @brief The default storage service associated to the compute service (nullptr if none) */
         StorageService *default_storage_service;
+        /** @brief The recorder of the utilization of the compute service's hosts (nullptr if none) */
+        std::shared_ptr<UtilizationRecorder> utilization_recorder = nullptr;
+
+        void recordResourceAllocation(const std::string &hostname, unsigned long num_cores, double ram);
+
+        void recordResourceRelease(const std::string &hostname, unsigned long num_cores, double ram);
 
     private:
 
         std::map<std::string, std::vector<double>> getServiceResourceInformation();
 
+        void sendServiceResourceInformationRequest(ServiceFutureBase *future);
+
+        static std::vector<double> getServiceResourceInformationEntry(SimulationMessage *message, const std::string &key);
+
+        static std::vector<unsigned long> toUnsignedLongs(const std::vector<double> &values);
+
         /***********************/
         /** \endcond          **/
         /***********************/
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_HOSTCAPACITYINDEX_H
+#define WRENCH_HOSTCAPACITYINDEX_H
+
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond DEVELOPER    */
+    /***********************/
+
+    /**
+     * @brief An index of the free capacity (number of idle cores and amount of available RAM)
+     *        of a set of hosts, ordered by free cores and then by free RAM, so that a host that
+     *        fits a request can be found without scanning all hosts. Updates take O(log H) time,
+     *        and best-fit and worst-fit queries O(B log H) time, where H is the number of hosts
+     *        and B is the number of distinct free core counts (which is bounded by the number of
+     *        cores per host). The hosts are also kept in the order in which they were added, in a
+     *        tree of per-range maximum free capacities, for first-fit queries
+     */
+    class HostCapacityIndex {
+
+    public:
+
+        void setCapacity(const std::string &hostname, unsigned long num_cores, double ram);
+
+        void remove(const std::string &hostname);
+
+        void clear();
+
+        unsigned long getNumCores(const std::string &hostname) const;
+
+        double getRam(const std::string &hostname) const;
+
+        /** @brief Get the number of indexed hosts @return a number of hosts */
+        unsigned long size() const {
+          return this->capacities.size();
+        }
+
+        std::string findBestFit(unsigned long min_num_cores, unsigned long desired_num_cores, double ram) const;
+
+        std::string findFirstFit(unsigned long min_num_cores, double ram) const;
+
+        std::string findWorstFit(unsigned long min_num_cores, double ram) const;
+
+        std::string findPackingFit(unsigned long min_num_cores, unsigned long desired_num_cores, double ram,
+                                   unsigned long core_scale, double ram_scale,
+                                   const std::vector<std::pair<unsigned long, double>> &reservations = {}) const;
+
+    private:
+
+        /** @brief An index entry: <free cores, free RAM, hostname> */
+        typedef std::tuple<unsigned long, double, std::string> Entry;
+
+        std::set<Entry>::const_iterator findFirstAtLeast(unsigned long min_num_cores, double ram) const;
+
+        std::set<Entry>::const_iterator findLastBefore(std::set<Entry>::const_iterator it,
+                                                       unsigned long min_num_cores, double ram) const;
+
+        void setFirstFitCapacity(unsigned long position, unsigned long num_cores, double ram);
+
+        unsigned long findFirstFitPosition(unsigned long node, unsigned long min_num_cores, double ram) const;
+
+        std::set<Entry> entries;
+        std::unordered_map<std::string, std::pair<unsigned long, double>> capacities;
+
+        /** @brief The hosts' positions in the order in which they were added (kept when a host is removed) */
+        std::unordered_map<std::string, unsigned long> positions;
+        /** @brief The hostnames, by position */
+        std::vector<std::string> hostnames;
+        /** @brief A complete binary tree over positions (the root at index 1, the leaves in the second half),
+         *         in which each node holds the maximum free cores and maximum free RAM in its range */
+        std::vector<std::pair<unsigned long, double>> first_fit_tree;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_HOSTCAPACITYINDEX_H
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_MOLDABLECOREALLOCATOR_H
+#define WRENCH_MOLDABLECOREALLOCATOR_H
+
+#include <map>
+#include <vector>
+
+namespace wrench {
+
+    class WorkflowTask;
+
+    /***********************/
+    /** \cond DEVELOPER    */
+    /***********************/
+
+    /**
+     * @brief A core allocator for moldable tasks (i.e., tasks that can run on any number of cores
+     *        between their minimum and maximum numbers of cores), which picks per-task numbers of
+     *        cores for a set of tasks that run concurrently on the idle cores of a set of hosts, with
+     *        a heuristic that aims at minimizing the time at which they have all completed
+     */
+    class MoldableCoreAllocator {
+
+    public:
+
+        static double estimateExecutionTime(WorkflowTask *task, unsigned long num_cores);
+
+        static std::map<WorkflowTask *, unsigned long> allocate(const std::vector<WorkflowTask *> &tasks,
+                                                                const std::vector<unsigned long> &host_num_cores);
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_MOLDABLECOREALLOCATOR_H
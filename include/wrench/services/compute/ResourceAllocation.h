@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_RESOURCEALLOCATION_H
+#define WRENCH_RESOURCEALLOCATION_H
+
+#include <initializer_list>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond DEVELOPER    */
+    /***********************/
+
+    /**
+     * @brief A set of compute resources (a number of cores and an amount of RAM on each of
+     *        a set of hosts), stored as a small vector sorted by host id (see S4U_HostRegistry)
+     *        so that it is cheap to copy and to look up
+     */
+    class ResourceAllocation {
+
+    public:
+
+        /** @brief The resources allocated on one host */
+        struct HostResources {
+            /** @brief The host's id */
+            unsigned long host_id;
+            /** @brief The number of cores (or ComputeService::ALL_CORES) */
+            unsigned long num_cores;
+            /** @brief The amount of RAM in bytes (or ComputeService::ALL_RAM) */
+            double ram;
+
+            const std::string &getHostname() const;
+        };
+
+        /** @brief An iterator over the per-host resources, in host id order */
+        typedef std::vector<HostResources>::const_iterator const_iterator;
+
+        ResourceAllocation() = default;
+
+        ResourceAllocation(std::initializer_list<std::tuple<std::string, unsigned long, double>> resources);
+
+        ResourceAllocation(const std::set<std::tuple<std::string, unsigned long, double>> &resources);
+
+        void add(unsigned long host_id, unsigned long num_cores, double ram);
+
+        void add(const std::string &hostname, unsigned long num_cores, double ram);
+
+        const HostResources *find(unsigned long host_id) const;
+
+        const HostResources *find(const std::string &hostname) const;
+
+        /**
+         * @brief Get the resources allocated on the i-th host (in host id order)
+         * @param i: an index
+         * @return the resources
+         */
+        const HostResources &operator[](unsigned long i) const {
+          return this->hosts[i];
+        }
+
+        /** @brief Get an iterator to the first host's resources @return an iterator */
+        const_iterator begin() const {
+          return this->hosts.begin();
+        }
+
+        /** @brief Get an iterator past the last host's resources @return an iterator */
+        const_iterator end() const {
+          return this->hosts.end();
+        }
+
+        /** @brief Get the number of hosts @return a number of hosts */
+        unsigned long size() const {
+          return this->hosts.size();
+        }
+
+        /** @brief Determine whether there are no resources @return true or false */
+        bool empty() const {
+          return this->hosts.empty();
+        }
+
+        unsigned long getTotalNumCores() const;
+
+        double getTotalRam() const;
+
+    private:
+        std::vector<HostResources> hosts;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_RESOURCEALLOCATION_H
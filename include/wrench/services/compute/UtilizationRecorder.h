@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_UTILIZATIONRECORDER_H
+#define WRENCH_UTILIZATIONRECORDER_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace wrench {
+
+    /**
+     * @brief A sample of a piecewise-constant utilization time series: the utilization of a host from
+     *        the sample's date until the next sample's date (or forever, for the last sample)
+     */
+    class UtilizationSample {
+
+    public:
+        /** @brief The date at which the utilization starts holding */
+        double date;
+        /** @brief The number of busy cores (a time-weighted average, when downsampling) */
+        double busy_cores;
+        /** @brief The used RAM in bytes (a time-weighted average, when downsampling) */
+        double used_ram;
+    };
+
+    /**
+     * @brief A recorder of the core and RAM utilization of hosts over time, which compute services
+     *        (and standard job executors) update on every resource allocation change
+     *
+     * @details By default, every change is recorded. In downsampling mode, each host's series
+     *          consists of fixed-length periods, each with the time-weighted average utilization over that
+     *          period, and the period length doubles (by merging adjacent periods) whenever a series
+     *          would exceed a maximum number of samples, so that memory usage is bounded regardless of
+     *          the simulation length.
+     */
+    class UtilizationRecorder {
+
+    public:
+
+        UtilizationRecorder();
+
+        UtilizationRecorder(unsigned long max_num_samples_per_host, double initial_period);
+
+        bool isDownsampling();
+
+        std::vector<std::string> getHostnames();
+
+        std::vector<UtilizationSample> getSamples(const std::string &hostname);
+
+        double getPeriod(const std::string &hostname);
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        void allocate(double date, const std::string &hostname, unsigned long num_cores, double ram);
+
+        void release(double date, const std::string &hostname, unsigned long num_cores, double ram);
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+    private:
+
+        /** @brief The utilization series of a host */
+        struct HostSeries {
+            double busy_cores = 0.0;
+            double used_ram = 0.0;
+            double last_change_date = 0.0;
+            std::vector<UtilizationSample> samples;
+
+            // Downsampling mode only
+            double period = 0.0;
+            double period_start = 0.0;
+            double busy_core_integral = 0.0;
+            double used_ram_integral = 0.0;
+        };
+
+        void update(double date, const std::string &hostname, double core_delta, double ram_delta);
+
+        void advance(HostSeries &series, double date);
+
+        unsigned long max_num_samples_per_host;
+        double initial_period;
+        std::map<std::string, HostSeries> series;
+    };
+
+};
+
+#endif //WRENCH_UTILIZATIONRECORDER_H
@@ -5,6 +5,7 @@
 #ifndef WRENCH_BATCHJOB_H
 #define WRENCH_BATCHJOB_H
 
+#include "wrench/services/compute/ResourceAllocation.h"
 #include "wrench/workflow/job/StandardJob.h"
 
 namespace wrench {
@@ -33,8 +34,8 @@ namespace wrench {
         unsigned long getNumNodes();
         WorkflowJob* getWorkflowJob();
         void setEndingTimeStamp(double);
-        std::set<std::tuple<std::string,unsigned long, double>> getResourcesAllocated();
-        void setAllocatedResources(std::set<std::tuple<std::string,unsigned long, double>>);
+        const ResourceAllocation &getResourcesAllocated();
+        void setAllocatedResources(ResourceAllocation);
 
     private:
         unsigned long jobid;
@@ -44,7 +45,7 @@ namespace wrench {
         unsigned long cores_per_node;
         double ending_time_stamp;
         double appeared_time_stamp;
-        std::set<std::tuple<std::string,unsigned long, double>> resources_allocated;
+        ResourceAllocation resources_allocated;
     };
 
     /***********************/
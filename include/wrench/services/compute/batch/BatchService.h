@@ -12,6 +12,7 @@
 #define WRENCH_BATCH_SERVICE_H
 
 #include "wrench/services/compute/ComputeService.h"
+#include "wrench/services/compute/HostCapacityIndex.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
 #include "wrench/services/compute/batch/BatchJob.h"
 #include "wrench/services/compute/batch/BatchNetworkListener.h"
@@ -39,6 +40,10 @@ namespace wrench {
                  {BatchServiceProperty::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD, "1024"},
                  {BatchServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD,              "1024"},
                  {BatchServiceProperty::THREAD_STARTUP_OVERHEAD,                     "0"},
+                 {BatchServiceProperty::MULTICORE_EXECUTION_MODE,                    "compute_threads"},
+                 {BatchServiceProperty::WORKUNIT_EXECUTOR_MODE,                      "one_per_workunit"},
+                 {BatchServiceProperty::FILE_OPERATION_MODE,                         "sequential"},
+                 {BatchServiceProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS,          "8"},
                  {BatchServiceProperty::STANDARD_JOB_DONE_MESSAGE_PAYLOAD,           "1024"},
                  {BatchServiceProperty::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD, "1024"},
                  {BatchServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD,  "1024"},
@@ -110,6 +115,8 @@ namespace wrench {
         std::map<std::string, unsigned long> nodes_to_cores_map;
         std::vector<double> timeslots;
         std::map<std::string, unsigned long> available_nodes_to_cores;
+        // Index of the above available cores, used for BESTFIT host selection
+        HostCapacityIndex available_nodes_index;
         std::map<unsigned long, std::string> host_id_to_names;
         /*End Resources information in Batchservice */
 
@@ -162,7 +169,7 @@ namespace wrench {
 
         std::string convertAvailableResourcesToJsonString(std::map<std::string, unsigned long>);
 
-        std::string convertResourcesToJsonString(std::set<std::tuple<std::string, unsigned long, double>>);
+        std::string convertResourcesToJsonString(const ResourceAllocation &resources);
 
         //submits a standard job
         void submitStandardJob(StandardJob *job, std::map<std::string, std::string> &batch_job_args) override;
@@ -182,7 +189,7 @@ namespace wrench {
 
         bool dispatchNextPendingJob();
 
-        void processGetResourceInformation(const std::string &answer_mailbox);
+        void processGetResourceInformation(const std::string &answer_mailbox, unsigned long correlation_id);
 
         void processStandardJobCompletion(StandardJobExecutor *executor, StandardJob *job);
 
@@ -196,7 +203,7 @@ namespace wrench {
 
         void terminateRunningStandardJob(StandardJob *job);
 
-        std::set<std::tuple<std::string, unsigned long, double>> scheduleOnHosts(std::string host_selection_algorithm,
+        ResourceAllocation scheduleOnHosts(std::string host_selection_algorithm,
                                                                                  unsigned long, unsigned long, double);
 
         BatchJob *scheduleJob(std::string);
@@ -214,7 +221,7 @@ namespace wrench {
         void processStandardJobTimeout(StandardJob *job);
 
         //process pilot job termination request
-        void processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox);
+        void processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox, unsigned long correlation_id);
 
         //Process standardjob timeout
         void processPilotJobTimeout(PilotJob *job);
@@ -223,7 +230,11 @@ namespace wrench {
         void notifyJobSubmitters(PilotJob *job);
 
         //update the resources
-        void updateResources(std::set<std::tuple<std::string, unsigned long, double>> resources);
+        void updateResources(const ResourceAllocation &resources);
+
+        void indexAvailableCores(const std::string &hostname);
+
+        double getAllocatedRam(const std::string &hostname, double ram_per_node);
 
         void updateResources(StandardJob *job);
 
@@ -237,13 +248,13 @@ namespace wrench {
         bool scheduleAllQueuedJobs();
 
         // process a job submission
-        void processJobSubmission(BatchJob *job, std::string answer_mailbox);
+        void processJobSubmission(BatchJob *job, std::string answer_mailbox, unsigned long correlation_id);
 
         //process execute events from batsched
         void processExecuteJobFromBatSched(std::string bat_sched_reply);
 
         //process execution of job
-        void processExecution(std::set<std::tuple<std::string, unsigned long, double>>, WorkflowJob *,
+        void processExecution(const ResourceAllocation &resources, WorkflowJob *,
                               BatchJob *, unsigned long, unsigned long, unsigned long);
 
         //notify batsched about job completion/failure/killed events
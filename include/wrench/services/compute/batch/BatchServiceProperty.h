@@ -17,6 +17,28 @@ namespace wrench {
     public:
         /** @brief The overhead to start a thread execution, in seconds **/
         DECLARE_PROPERTY_NAME(THREAD_STARTUP_OVERHEAD);
+        /** @brief How a task's multicore computation is simulated. Can be:
+         *    - compute_threads
+         *    - single_actor
+         *   (see StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE)
+         **/
+        DECLARE_PROPERTY_NAME(MULTICORE_EXECUTION_MODE);
+        /** @brief How workunit executors are managed. Can be:
+         *    - one_per_workunit
+         *    - pooled (workunit executors are reused across the workunits of a job)
+         *   (see StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE)
+         **/
+        DECLARE_PROPERTY_NAME(WORKUNIT_EXECUTOR_MODE);
+        /** @brief How file reads, writes, and copies are performed. Can be:
+         *    - sequential
+         *    - overlapped
+         *   (see StandardJobExecutorProperty::FILE_OPERATION_MODE)
+         **/
+        DECLARE_PROPERTY_NAME(FILE_OPERATION_MODE);
+        /** @brief The maximum number of concurrent file operations of a workunit
+         *   (see StandardJobExecutorProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS)
+         **/
+        DECLARE_PROPERTY_NAME(MAX_NUM_CONCURRENT_FILE_OPERATIONS);
         /** @brief The host selection algorithm. Can be:
          *    - FIRSTFIT
          *    - BESTFIT
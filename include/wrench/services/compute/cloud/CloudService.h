@@ -96,9 +96,9 @@ namespace wrench {
 
         bool processNextMessage();
 
-        void processGetResourceInformation(const std::string &answer_mailbox);
+        void processGetResourceInformation(const std::string &answer_mailbox, unsigned long correlation_id);
 
-        void processGetExecutionHosts(const std::string &answer_mailbox);
+        void processGetExecutionHosts(const std::string &answer_mailbox, unsigned long correlation_id);
 
         void processCreateVM(const std::string &answer_mailbox,
                              const std::string &pm_hostname,
@@ -107,12 +107,14 @@ namespace wrench {
                              bool supports_pilot_jobs,
                              unsigned long num_cores,
                              double ram_memory,
-                             std::map<std::string, std::string> plist);
+                             std::map<std::string, std::string> plist,
+                             unsigned long correlation_id);
 
         void processSubmitStandardJob(const std::string &answer_mailbox, StandardJob *job,
-                                      std::map<std::string, std::string> &service_specific_args);
+                                      std::map<std::string, std::string> &service_specific_args,
+                                      unsigned long correlation_id);
 
-        void processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job);
+        void processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job, unsigned long correlation_id);
 
         void terminate();
 
@@ -14,6 +14,7 @@
 #include <queue>
 
 #include "wrench/services/compute/ComputeService.h"
+#include "wrench/services/compute/ResourceAllocation.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
 #include "MultihostMulticoreComputeServiceProperty.h"
 
@@ -55,11 +56,16 @@ namespace wrench {
                 {MultihostMulticoreComputeServiceProperty::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD,     "1024"},
                 {MultihostMulticoreComputeServiceProperty::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD,      "1024"},
                 {MultihostMulticoreComputeServiceProperty::THREAD_STARTUP_OVERHEAD,                        "0.0"},
+                {MultihostMulticoreComputeServiceProperty::MULTICORE_EXECUTION_MODE,                       "compute_threads"},
+                {MultihostMulticoreComputeServiceProperty::WORKUNIT_EXECUTOR_MODE,                         "one_per_workunit"},
+                {MultihostMulticoreComputeServiceProperty::FILE_OPERATION_MODE,                            "sequential"},
+                {MultihostMulticoreComputeServiceProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS,             "8"},
                 {MultihostMulticoreComputeServiceProperty::JOB_SELECTION_POLICY,                           "FCFS"},
                 {MultihostMulticoreComputeServiceProperty::RESOURCE_ALLOCATION_POLICY,                     "aggressive"},
                 {MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_CORE_ALLOCATION_ALGORITHM,      "maximum"},
                 {MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_TASK_SELECTION_ALGORITHM,       "maximum_flops"},
                 {MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_HOST_SELECTION_ALGORITHM,       "best_fit"},
+                {MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_HOST_SELECTION_LOOK_AHEAD,      "0"},
         };
 
 
@@ -111,12 +117,13 @@ namespace wrench {
     private:
 
         friend class Simulation;
+        friend class BatchService;
 
         // Low-level Constructor
         MultihostMulticoreComputeService(const std::string &hostname,
                                          bool supports_standard_jobs,
                                          bool supports_pilot_jobs,
-                                         std::set<std::tuple<std::string, unsigned long, double>> compute_resources,
+                                         ResourceAllocation compute_resources,
                                          std::map<std::string, std::string> plist,
                                          double ttl,
                                          PilotJob *pj, std::string suffix,
@@ -126,16 +133,16 @@ namespace wrench {
         void initiateInstance(const std::string &hostname,
                               bool supports_standard_jobs,
                               bool supports_pilot_jobs,
-                              std::set<std::tuple<std::string, unsigned long, double>> compute_resources,
+                              ResourceAllocation compute_resources,
                               std::map<std::string, std::string> plist,
                               double ttl,
                               PilotJob *pj,
                               StorageService *default_storage_service);
 
-        std::set<std::tuple<std::string, unsigned long, double>> compute_resources;
+        ResourceAllocation compute_resources;
 
-        // Core availabilities (for each hosts, how many cores and how many bytes of RAM are currently available on it)
-        std::map<std::string, std::pair<unsigned long, double>> core_and_ram_availabilities;
+        // Core availabilities (for each host, by host id, how many cores and how many bytes of RAM are currently available on it)
+        std::map<unsigned long, std::pair<unsigned long, double>> core_and_ram_availabilities;
         unsigned long total_num_cores;
 
         double ttl;
@@ -150,6 +157,9 @@ namespace wrench {
         // Set of completed standard job executors
         std::set<std::shared_ptr<StandardJobExecutor>> completed_job_executors;
 
+        // Pool of workunit executors shared by all standard job executors (in the pooled mode)
+        std::shared_ptr<WorkunitExecutorPool> workunit_executor_pool = nullptr;
+
         // Set of running jobs
         std::set<WorkflowJob *> running_jobs;
 
@@ -174,9 +184,9 @@ namespace wrench {
 
         void processPilotJobCompletion(PilotJob *job);
 
-        void processStandardJobTerminationRequest(StandardJob *job, std::string answer_mailbox);
+        void processStandardJobTerminationRequest(StandardJob *job, std::string answer_mailbox, unsigned long correlation_id);
 
-        void processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox);
+        void processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox, unsigned long correlation_id);
 
         bool processNextMessage();
 
@@ -186,9 +196,9 @@ namespace wrench {
 
         bool dispatchPilotJob(PilotJob *job);
 
-        std::set<std::tuple<std::string, unsigned long, double>> computeResourceAllocation(StandardJob *job);
+        ResourceAllocation computeResourceAllocation(StandardJob *job);
 
-        std::set<std::tuple<std::string, unsigned long, double>> computeResourceAllocationAggressive(StandardJob *job);
+        ResourceAllocation computeResourceAllocationAggressive(StandardJob *job);
 
 
 //        void createWorkForNewlyDispatchedJob(StandardJob *job);
@@ -201,12 +211,13 @@ namespace wrench {
 
         void failRunningStandardJob(StandardJob *job, std::shared_ptr<FailureCause> cause);
 
-        void processGetResourceInformation(const std::string &answer_mailbox);
+        void processGetResourceInformation(const std::string &answer_mailbox, unsigned long correlation_id);
 
         void processSubmitStandardJob(const std::string &answer_mailbox, StandardJob *job,
-                                      std::map<std::string, std::string> &service_specific_arguments);
+                                      std::map<std::string, std::string> &service_specific_arguments,
+                                      unsigned long correlation_id);
 
-        void processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job);
+        void processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job, unsigned long correlation_id);
     };
 };
 
@@ -34,6 +34,32 @@ namespace wrench {
         /** @brief The overhead to start a thread execution, in seconds **/
         DECLARE_PROPERTY_NAME(THREAD_STARTUP_OVERHEAD);
 
+        /** @brief How a task's multicore computation is simulated. Possible values are:
+         *                  - compute_threads (default)
+         *                  - single_actor
+         *         (see StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE)
+         **/
+        DECLARE_PROPERTY_NAME(MULTICORE_EXECUTION_MODE);
+
+        /** @brief How workunit executors are managed. Possible values are:
+         *                  - one_per_workunit (default)
+         *                  - pooled: workunit executors are reused across the workunits of all jobs
+         *         (see StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE)
+         **/
+        DECLARE_PROPERTY_NAME(WORKUNIT_EXECUTOR_MODE);
+
+        /** @brief How file reads, writes, and copies are performed. Possible values are:
+         *                  - sequential (default)
+         *                  - overlapped
+         *         (see StandardJobExecutorProperty::FILE_OPERATION_MODE)
+         **/
+        DECLARE_PROPERTY_NAME(FILE_OPERATION_MODE);
+
+        /** @brief The maximum number of concurrent file operations of a workunit
+         *         (see StandardJobExecutorProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS)
+         **/
+        DECLARE_PROPERTY_NAME(MAX_NUM_CONCURRENT_FILE_OPERATIONS);
+
         /** @brief The job selection policy:
          *      - FCFS: serve jobs in First-Come-First-Serve manner
          */
@@ -51,6 +77,7 @@ namespace wrench {
          *         a computational task. Possible values are:
          *                  - maximum (default)
          *                  - minimum
+         *                  - moldable (see StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM)
          **/
         DECLARE_PROPERTY_NAME(TASK_SCHEDULING_CORE_ALLOCATION_ALGORITHM);
 
@@ -65,10 +92,20 @@ namespace wrench {
 
         /** @brief The algorithm that decides, once a resource allocation has been determined
          *         for a job, on which host a task should be placed. Possible values are:
-         *                  - best fit (default)
+         *                  - best_fit (default)
+         *                  - first_fit
+         *                  - worst_fit
+         *                  - cores_and_ram_best_fit
+         *         (see StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM)
          */
         DECLARE_PROPERTY_NAME(TASK_SCHEDULING_HOST_SELECTION_ALGORITHM);
 
+        /** @brief The number of ready tasks with the largest memory requirements for which
+         *         the cores_and_ram_best_fit host selection algorithm leaves room (default: 0)
+         *         (see StandardJobExecutorProperty::HOST_SELECTION_LOOK_AHEAD)
+         */
+        DECLARE_PROPERTY_NAME(TASK_SCHEDULING_HOST_SELECTION_LOOK_AHEAD);
+
     };
 
 };
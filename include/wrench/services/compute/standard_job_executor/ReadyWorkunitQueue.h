@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_READYWORKUNITQUEUE_H
+#define WRENCH_READYWORKUNITQUEUE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace wrench {
+
+    class Workunit;
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A priority queue of ready workunits, implemented as an indexed binary heap: each
+     *        queued workunit knows its position in the heap (its handle), so that the highest
+     *        priority workunit can be popped, and any workunit removed, in O(log n). Workunits
+     *        that cannot be dispatched for now can be blocked, i.e., set aside (by minimum number
+     *        of cores and RAM) until they fit on some host, so that they are not looked at again
+     *        and again while they can't be dispatched
+     */
+    class ReadyWorkunitQueue {
+
+    public:
+
+        /** @brief The order in which computational workunits are selected (workunits without
+         *         computational tasks always come first, and ties are broken in queuing order) */
+        enum SelectionPolicy {
+            /** @brief Largest number of flops first */
+            MAXIMUM_FLOPS,
+            /** @brief Largest minimum number of cores first */
+            MAXIMUM_MINIMUM_CORES
+        };
+
+        static SelectionPolicy getSelectionPolicy(const std::string &selection_algorithm);
+
+        explicit ReadyWorkunitQueue(SelectionPolicy policy = MAXIMUM_FLOPS);
+
+        void push(std::unique_ptr<Workunit> workunit);
+
+        Workunit *top();
+
+        std::unique_ptr<Workunit> pop();
+
+        std::unique_ptr<Workunit> remove(Workunit *workunit);
+
+        void block(Workunit *workunit, unsigned long min_num_cores, double ram);
+
+        void unblock(const std::function<bool(unsigned long, double)> &fits);
+
+        std::vector<Workunit *> getWorkunits() const;
+
+        void visitInOrder(const std::function<bool(Workunit *)> &visitor) const;
+
+        /** @brief Determine whether the queue is empty (blocked workunits included) @return true or false */
+        bool empty() const {
+          return this->heap.empty() and this->blocked.empty();
+        }
+
+        /** @brief Get the number of queued workunits (blocked workunits included) @return a number of workunits */
+        unsigned long size() const {
+          return this->heap.size() + this->blocked.size();
+        }
+
+        /** @brief Get the number of blocked workunits @return a number of workunits */
+        unsigned long getNumBlocked() const {
+          return this->blocked.size();
+        }
+
+        void clear();
+
+    private:
+
+        struct Entry {
+            bool computational;
+            double key;
+            unsigned long sequence_number;
+            std::unique_ptr<Workunit> workunit;
+        };
+
+        bool isBefore(const Entry &e1, const Entry &e2) const;
+
+        void insertEntry(Entry entry);
+
+        Entry removeEntry(unsigned long i);
+
+        void swapEntries(unsigned long i, unsigned long j);
+
+        void siftUp(unsigned long i);
+
+        void siftDown(unsigned long i);
+
+        SelectionPolicy policy;
+        unsigned long next_sequence_number = 1;
+        std::vector<Entry> heap;
+        /** @brief The blocked workunits, by <minimum number of cores, RAM> */
+        std::multimap<std::pair<unsigned long, double>, Entry> blocked;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_READYWORKUNITQUEUE_H
@@ -11,10 +11,16 @@
 #define WRENCH_MULTINODEMULTICORESTANDARDJOBEXECUTOR_H
 
 
+#include <list>
 #include <queue>
 #include <set>
+#include <unordered_map>
 
 #include "wrench/services/compute/ComputeService.h"
+#include "wrench/services/compute/HostCapacityIndex.h"
+#include "wrench/services/compute/ResourceAllocation.h"
+#include "wrench/services/compute/standard_job_executor/ReadyWorkunitQueue.h"
+#include "wrench/services/compute/standard_job_executor/WorkunitExecutorPool.h"
 #include "wrench/services/compute/standard_job_executor/WorkunitMulticoreExecutor.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutorProperty.h"
 #include "wrench/services/compute/standard_job_executor/Workunit.h"
@@ -47,14 +53,18 @@ namespace wrench {
                 std::string callback_mailbox,
                 std::string hostname,
                 StandardJob *job,
-                std::set<std::tuple<std::string, unsigned long, double>> compute_resources,
+                const ResourceAllocation &compute_resources,
                 StorageService *default_storage_service,
                 std::map<std::string, std::string> plist = {});
 
         void kill();
 
         StandardJob *getJob();
-        std::set<std::tuple<std::string, unsigned long, double>> getComputeResources();
+        const ResourceAllocation &getComputeResources();
+
+        void setUtilizationRecorder(std::shared_ptr<UtilizationRecorder> recorder);
+
+        void setWorkunitExecutorPool(std::shared_ptr<WorkunitExecutorPool> pool);
 
     private:
 
@@ -62,37 +72,64 @@ namespace wrench {
 
         std::string callback_mailbox;
         StandardJob *job;
-        std::set<std::tuple<std::string, unsigned long, double>> compute_resources;
+        ResourceAllocation compute_resources;
         int total_num_cores;
+        // Number of cores not used by a running workunit, over all hosts
+        unsigned long num_idle_cores;
         double total_ram;
         StorageService *default_storage_service;
 
-        // Core availabilities (for each hosts, how many cores are currently available on it)
-        std::map<std::string, unsigned long> core_availabilities;
-        // RAM availabilities (for each host, host many bytes of RAM are currently available on it)
-        std::map<std::string, double> ram_availabilities;
-
-        // Sets of workunit executors
-        std::set<std::shared_ptr<WorkunitMulticoreExecutor>> running_workunit_executors;
+        // Core availabilities (for each host, by host id, how many cores are currently available on it)
+        std::map<unsigned long, unsigned long> core_availabilities;
+        // RAM availabilities (for each host, by host id, how many bytes of RAM are currently available on it)
+        std::map<unsigned long, double> ram_availabilities;
+        // Index of the above availabilities, used to select hosts
+        HostCapacityIndex host_capacities;
+        // Largest number of cores and amount of RAM of a host
+        unsigned long max_host_num_cores = 0;
+        double max_host_ram = 0.0;
+        // Numbers of cores picked for the ready tasks by the "moldable" core allocation algorithm
+        // (only valid while ready workunits are being dispatched)
+        std::map<WorkflowTask *, unsigned long> moldable_num_cores;
+        // Ready workunits with the largest RAM requirements, for which the "cores_and_ram_best_fit" host
+        // selection algorithm leaves room (only valid while ready workunits are being dispatched)
+        std::vector<Workunit *> large_memory_workunits;
+
+        // Recorder of the core and RAM utilization of the executor's hosts (nullptr if none)
+        std::shared_ptr<UtilizationRecorder> utilization_recorder = nullptr;
+
+        // Pool of persistent workunit executors (nullptr unless the pooled mode is used)
+        std::shared_ptr<WorkunitExecutorPool> workunit_executor_pool = nullptr;
+        // Whether the pool was created by (and is thus private to) this executor
+        bool owns_workunit_executor_pool = false;
+
+        // Sets of workunit executors (running ones are indexed by address, for constant-time lookup)
+        std::unordered_map<WorkunitMulticoreExecutor *, std::shared_ptr<WorkunitMulticoreExecutor>> running_workunit_executors;
         std::set<std::shared_ptr<WorkunitMulticoreExecutor>> finished_workunit_executors;
         std::set<std::shared_ptr<WorkunitMulticoreExecutor>> failed_workunit_executors;
 
-        // Work units
-        std::set<std::unique_ptr<Workunit>> non_ready_workunits;
-        std::set<std::unique_ptr<Workunit>> ready_workunits;
-        std::set<std::unique_ptr<Workunit>> running_workunits;
-        std::set<std::unique_ptr<Workunit>> completed_workunits;
+        // Work units (each workunit in a list knows its position in it, so that it can be
+        // moved between lists in constant time)
+        std::list<std::unique_ptr<Workunit>> non_ready_workunits;
+        ReadyWorkunitQueue ready_workunits;
+        std::list<std::unique_ptr<Workunit>> running_workunits;
+        std::list<std::unique_ptr<Workunit>> completed_workunits;
 
         // Property list
         std::map<std::string, std::string> property_list;
 
         std::map<std::string, std::string> default_property_values = {
                 {StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD, "0"},
+                {StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE, "compute_threads"},
+                {StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE, "one_per_workunit"},
+                {StandardJobExecutorProperty::FILE_OPERATION_MODE, "sequential"},
+                {StandardJobExecutorProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS, "8"},
                 {StandardJobExecutorProperty::STANDARD_JOB_DONE_MESSAGE_PAYLOAD, "1024"},
                 {StandardJobExecutorProperty::STANDARD_JOB_FAILED_MESSAGE_PAYLOAD, "1024"},
                 {StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM, "maximum"},
                 {StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM, "maximum_flops"},
                 {StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM, "best_fit"},
+                {StandardJobExecutorProperty::HOST_SELECTION_LOOK_AHEAD, "0"},
         };
 
         int main();
@@ -111,15 +148,13 @@ namespace wrench {
         bool processNextMessage();
 
         unsigned long computeWorkUnitMinNumCores(Workunit *wu);
-        unsigned long computeWorkUnitDesiredNumCores(Workunit *wu);
+        unsigned long computeWorkUnitDesiredNumCores(Workunit *wu, const std::string &core_allocation_algorithm);
         double computeWorkUnitMinMemory(Workunit *wu);
 
           void dispatchReadyWorkunits();
 
         void createWorkunits();
 
-        std::vector<Workunit*> sortReadyWorkunits();
-
     };
 
     /***********************/
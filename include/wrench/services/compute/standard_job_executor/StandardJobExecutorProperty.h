@@ -28,6 +28,29 @@ namespace wrench {
 
         /** @brief The number of seconds to start a thread **/
         DECLARE_PROPERTY_NAME(THREAD_STARTUP_OVERHEAD);
+        /** @brief How a task's multicore computation is simulated. Possible values are:
+         *                  - compute_threads (default): one compute thread actor per core
+         *                  - single_actor: a single computation by the workunit executor itself,
+         *                                  which takes the same time (no per-core actors or mailboxes)
+         **/
+        DECLARE_PROPERTY_NAME(MULTICORE_EXECUTION_MODE);
+        /** @brief How workunit executors are managed. Possible values are:
+         *                  - one_per_workunit (default): a new workunit executor is started for each workunit
+         *                  - pooled: persistent workunit executors are reused across workunits (and
+         *                            across jobs if the executor is given a pool by its compute service)
+         **/
+        DECLARE_PROPERTY_NAME(WORKUNIT_EXECUTOR_MODE);
+        /** @brief How workunit executors perform file reads, writes, and copies. Possible values are:
+         *                  - sequential (default): one after the other, and not during computation
+         *                  - overlapped: file copies, and the input file reads of a task, are performed
+         *                                concurrently, output file writes proceed while the next task of
+         *                                the workunit (if any) runs, and tasks that read no pre-copied
+         *                                file do not wait for the job's pre file copies
+         **/
+        DECLARE_PROPERTY_NAME(FILE_OPERATION_MODE);
+        /** @brief The maximum number of concurrent file reads, writes, or copies of a workunit executor
+         *         (in overlapped FILE_OPERATION_MODE) **/
+        DECLARE_PROPERTY_NAME(MAX_NUM_CONCURRENT_FILE_OPERATIONS);
         /** @brief The number of bytes in the control message sent by the executor to state that it has completed a job **/
         DECLARE_PROPERTY_NAME(STANDARD_JOB_DONE_MESSAGE_PAYLOAD);
         /** @brief The number of bytes in the control message sent by the executor to state that a job has failed **/
@@ -38,6 +61,11 @@ namespace wrench {
          *         a computational task. Possible values are:
          *                  - maximum (default)
          *                  - minimum
+         *                  - moldable: the numbers of cores given to the highest-priority ready tasks are
+         *                              picked together, based on their speedups, with a heuristic
+         *                              that places the tasks on the hosts' idle cores and aims at
+         *                              minimizing the time at which they would all complete if
+         *                              they ran concurrently (see MoldableCoreAllocator)
          **/
         DECLARE_PROPERTY_NAME(CORE_ALLOCATION_ALGORITHM);
 
@@ -50,10 +78,25 @@ namespace wrench {
 
         /** @brief The algorithm that decides on which host a task should
          *         be placed. Possible values are:
-         *                  - best fit (default)
+         *                  - best_fit: the host that can give the task the most cores (up to its maximum),
+         *                    with the fewest cores left idle (default)
+         *                  - first_fit: the first host, in a fixed order (that of the compute resources,
+         *                    which doesn't change as cores become idle or busy), that can run the task
+         *                  - worst_fit: the host with the most idle cores
+         *                  - cores_and_ram_best_fit: the host that can give the task the most cores (up to
+         *                    its maximum), with the fewest cores and the least RAM left available, each
+         *                    relative to the largest host, and, first and foremost, that leaves room for the
+         *                    largest-memory ready tasks (see HOST_SELECTION_LOOK_AHEAD)
          */
         DECLARE_PROPERTY_NAME(HOST_SELECTION_ALGORITHM);
 
+        /** @brief The number of ready tasks with the largest memory requirements for which
+         *         the cores_and_ram_best_fit HOST_SELECTION_ALGORITHM avoids taking hosts with
+         *         room, when there would be fewer such hosts left than such tasks (default: 0,
+         *         i.e., no look-ahead)
+         */
+        DECLARE_PROPERTY_NAME(HOST_SELECTION_LOOK_AHEAD);
+
     };
 
     /***********************/
@@ -13,6 +13,7 @@
 
 #include <tuple>
 #include <set>
+#include <list>
 #include <map>
 #include <vector>
 #include <memory>
@@ -23,6 +24,7 @@ namespace wrench {
     class WorkflowFile;
     class StorageService;
     class WorkflowTask;
+    class WorkunitMulticoreExecutor;
 
     /***********************/
     /** \cond INTERNAL     */
@@ -59,6 +61,15 @@ namespace wrench {
         /** @brief File deletions to perform last */
         std::set<std::tuple<WorkflowFile *, StorageService *>> cleanup_file_deletions;
 
+        /** @brief The Workunit's position in the ReadyWorkunitQueue it is in, if any */
+        unsigned long ready_queue_index;
+        /** @brief The Workunit's rank among equal-priority Workunits in a ReadyWorkunitQueue (0 if never queued) */
+        unsigned long ready_queue_sequence_number;
+        /** @brief The Workunit's position in the (non-ready, running, or completed) Workunit list it is in, if any */
+        std::list<std::unique_ptr<Workunit>>::iterator list_position;
+        /** @brief The WorkunitMulticoreExecutor running the Workunit, if any */
+        WorkunitMulticoreExecutor *workunit_executor;
+
 
         ~Workunit();
     };
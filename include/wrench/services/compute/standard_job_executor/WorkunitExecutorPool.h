@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_WORKUNITEXECUTORPOOL_H
+#define WRENCH_WORKUNITEXECUTORPOOL_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace wrench {
+
+    class Simulation;
+
+    class WorkunitMulticoreExecutor;
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A pool of persistent workunit executors, kept idle on each host
+     *        so that they can be reused across workunits (and across the jobs
+     *        of the compute service that owns the pool) instead of creating
+     *        and tearing down one actor per workunit
+     */
+    class WorkunitExecutorPool {
+
+    public:
+
+        WorkunitExecutorPool(Simulation *simulation,
+                             double thread_startup_overhead,
+                             bool single_actor_execution);
+
+        std::shared_ptr<WorkunitMulticoreExecutor> acquire(const std::string &hostname);
+
+        void release(std::shared_ptr<WorkunitMulticoreExecutor> workunit_executor);
+
+        void killIdleExecutors();
+
+        unsigned long getNumIdleExecutors();
+
+        unsigned long getNumCreatedExecutors();
+
+    private:
+        Simulation *simulation;
+        double thread_startup_overhead;
+        bool single_actor_execution;
+
+        unsigned long num_created_executors = 0;
+
+        // Idle workunit executors, for each host
+        std::map<std::string, std::vector<std::shared_ptr<WorkunitMulticoreExecutor>>> idle_executors;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_WORKUNITEXECUTORPOOL_H
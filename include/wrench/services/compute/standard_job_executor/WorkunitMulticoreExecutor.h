@@ -25,6 +25,8 @@ namespace wrench {
     class WorkerThreadWork;
     class Workunit;
     class ComputeThread;
+    class FileOperationThread;
+    class FailureCause;
 
     /***********************/
     /** \cond INTERNAL     */
@@ -45,7 +47,22 @@ namespace wrench {
                      std::string callback_mailbox,
                      Workunit *workunit,
                      StorageService *default_storage_service,
-                     double thread_startup_overhead = 0.0);
+                     double thread_startup_overhead = 0.0,
+                     bool single_actor_execution = false);
+
+        WorkunitMulticoreExecutor(
+                     Simulation *simulation,
+                     std::string hostname,
+                     double thread_startup_overhead,
+                     bool single_actor_execution);
+
+        void assignWork(Workunit *workunit,
+                        unsigned long num_cores,
+                        double ram_utilization,
+                        std::string callback_mailbox,
+                        StorageService *default_storage_service);
+
+        void setFileOperationMode(bool overlapped, unsigned long max_num_concurrent_file_operations);
 
         void kill();
 
@@ -58,18 +75,50 @@ namespace wrench {
     private:
         int main();
 
+        bool performAndReportWork();
+
         void performWork(Workunit *work);
 
-        void runMulticoreComputation(double flops, double parallel_efficiency);
+        void performOverlappedWork(Workunit *work);
+
+        void readInputFilesAndCompute(Workunit *work, WorkflowTask *task, unsigned long max_num_concurrent_reads);
+
+        void completeTask(WorkflowTask *task);
+
+        void completeOutputFileWrites(WorkflowTask *task,
+                                      const std::vector<std::shared_ptr<FileOperationThread>> &threads,
+                                      unsigned long num_started, std::string reply_mailbox,
+                                      unsigned long correlation_id);
+
+        unsigned long startFileOperationThreads(const std::vector<std::shared_ptr<FileOperationThread>> &threads);
+
+        void completeFileOperationThreads(const std::vector<std::shared_ptr<FileOperationThread>> &threads,
+                                          unsigned long num_started, std::string reply_mailbox,
+                                          unsigned long correlation_id);
+
+        void startFileOperationThread(std::shared_ptr<FileOperationThread> file_operation_thread);
+
+        std::shared_ptr<FailureCause> waitForFileOperationThread(std::string reply_mailbox, unsigned long correlation_id);
+
+        void runMulticoreComputation(double flops, double speedup);
+
+        void runSingleActorMulticoreComputation(double flops, double speedup);
 
         std::string callback_mailbox;
         unsigned long num_cores;
         double ram_utilization;
         double thread_startup_overhead;
+        bool single_actor_execution;
+        // Whether the executor is pooled, i.e., performs workunits as they are assigned to it until it is killed
+        bool persistent;
+        // Whether file reads, writes, and copies are performed concurrently (and overlap computation)
+        bool overlapped_file_operations = false;
+        unsigned long max_num_concurrent_file_operations = 1;
 
         StorageService *default_storage_service;
 
         std::vector<std::shared_ptr<ComputeThread>> compute_threads;
+        std::vector<std::shared_ptr<FileOperationThread>> file_operation_threads;
 
     };
 
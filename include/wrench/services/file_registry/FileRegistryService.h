@@ -58,6 +58,8 @@ namespace wrench {
 
         std::set<StorageService *> lookupEntry(WorkflowFile *file);
 
+        std::unique_ptr<ServiceFuture<std::set<StorageService *>>> lookupEntryAsync(WorkflowFile *file);
+
         std::map<double, StorageService *> lookupEntry(WorkflowFile *file, std::string reference_host,
                                                        NetworkProximityService *);
 
@@ -62,6 +62,8 @@ namespace wrench{
 
         double query(std::pair<std::string, std::string> hosts);
 
+        std::unique_ptr<ServiceFuture<double>> queryAsync(std::pair<std::string, std::string> hosts);
+
         std::vector<std::string> getHostnameList();
         
         std::pair<double, double> getCoordinate(std::string);
@@ -44,6 +44,10 @@ namespace wrench {
 
         virtual bool lookupFile(WorkflowFile *file);
 
+        std::unique_ptr<ServiceFuture<double>> howMuchFreeSpaceAsync();
+
+        std::unique_ptr<ServiceFuture<bool>> lookupFileAsync(WorkflowFile *file);
+
         virtual void deleteFile(WorkflowFile *file);
 
         /***********************/
@@ -62,16 +66,18 @@ namespace wrench {
 
         virtual void writeFile(WorkflowFile *file);
 
-        static void readFiles(std::set<WorkflowFile *> files,
-                              std::map<WorkflowFile *, StorageService *> file_locations,
-                              StorageService *default_storage_service);
+        static void readFiles(const std::set<WorkflowFile *> &files,
+                              const std::map<WorkflowFile *, StorageService *> &file_locations,
+                              StorageService *default_storage_service,
+                              unsigned long max_num_concurrent_transfers = 1);
 
-        static void writeFiles(std::set<WorkflowFile *> files,
-                               std::map<WorkflowFile *, StorageService *> file_locations,
-                               StorageService *default_storage_service);
+        static void writeFiles(const std::set<WorkflowFile *> &files,
+                               const std::map<WorkflowFile *, StorageService *> &file_locations,
+                               StorageService *default_storage_service,
+                               unsigned long max_num_concurrent_transfers = 1);
 
-        static void deleteFiles(std::set<WorkflowFile *> files,
-                                std::map<WorkflowFile *, StorageService *> file_locations,
+        static void deleteFiles(const std::set<WorkflowFile *> &files,
+                                const std::map<WorkflowFile *, StorageService *> &file_locations,
                                 StorageService *default_storage_service);
 
         StorageService(std::string hostname,
@@ -107,9 +113,15 @@ namespace wrench {
             WRITE,
         };
 
-        static void writeOrReadFiles(FileOperation action, std::set<WorkflowFile *> files,
-                                     std::map<WorkflowFile *, StorageService *> file_locations,
-                                     StorageService *default_storage_service);
+        static void writeOrReadFiles(FileOperation action, const std::set<WorkflowFile *> &files,
+                                     const std::map<WorkflowFile *, StorageService *> &file_locations,
+                                     StorageService *default_storage_service,
+                                     unsigned long max_num_concurrent_transfers);
+
+        static void writeOrReadFilesConcurrently(FileOperation action, const std::set<WorkflowFile *> &files,
+                                                 const std::map<WorkflowFile *, StorageService *> &file_locations,
+                                                 StorageService *default_storage_service,
+                                                 unsigned long max_num_concurrent_transfers);
 
 
     };
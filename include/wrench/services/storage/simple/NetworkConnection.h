@@ -18,6 +18,7 @@
 namespace wrench {
 
     class WorkflowFile;
+    class StorageService;
 
     class NetworkConnection {
 
@@ -39,6 +40,8 @@ namespace wrench {
         std::string ack_mailbox;
         std::unique_ptr<S4U_PendingCommunication> comm;
         std::shared_ptr<FailureCause> failure_cause;
+        StorageService *src = nullptr;
+        unsigned long correlation_id = 0;
     };
 
 };
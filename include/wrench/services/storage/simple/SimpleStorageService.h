@@ -88,12 +88,13 @@ namespace wrench {
 
         unsigned long getNewUniqueNumber();
 
-        bool processFileWriteRequest(WorkflowFile *file, std::string answer_mailbox);
+        bool processFileWriteRequest(WorkflowFile *file, std::string answer_mailbox, unsigned long correlation_id);
 
         bool processFileReadRequest(WorkflowFile *file, std::string answer_mailbox,
-                                    std::string mailbox_to_receive_the_file_content);
+                                    std::string mailbox_to_receive_the_file_content, unsigned long correlation_id);
 
-        bool processFileCopyRequest(WorkflowFile *file, StorageService *src, std::string answer_mailbox);
+        bool processFileCopyRequest(WorkflowFile *file, StorageService *src, std::string answer_mailbox,
+                                    unsigned long correlation_id);
 
         unsigned long num_concurrent_connections;
 
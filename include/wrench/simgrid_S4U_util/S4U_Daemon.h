@@ -61,6 +61,8 @@ namespace wrench {
 
         void setSimulation(Simulation *simulation);
 
+        static unsigned long getNumStartedDaemons();
+
     protected:
 
         void killActor();
@@ -71,6 +73,8 @@ namespace wrench {
 				bool terminated;
 				simgrid::s4u::ActorPtr s4u_actor;
 
+				static unsigned long num_started_daemons;
+
 		};
 
 		/***********************/
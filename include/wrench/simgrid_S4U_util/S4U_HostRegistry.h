@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_S4U_HOSTREGISTRY_H
+#define WRENCH_S4U_HOSTREGISTRY_H
+
+#include <climits>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <simgrid/s4u.hpp>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A registry of the platform's hosts, built once the platform has been
+     *        instantiated, which assigns a dense integer id (0, 1, ..., n-1) to each
+     *        host and caches the host attributes that services look up repeatedly
+     *        (number of cores, flop rate, memory capacity). Hosts created afterwards
+     *        (e.g., VMs) are registered, with the next ids, when their id is first requested
+     */
+    class S4U_HostRegistry {
+
+    public:
+
+        /** @brief The id returned by findHostId() for an unknown host */
+        static constexpr unsigned long NO_HOST = ULONG_MAX;
+
+        static void build(const std::vector<simgrid::s4u::Host *> &hosts);
+
+        static void clear();
+
+        static unsigned long getNumHosts();
+
+        static unsigned long findHostId(const std::string &hostname);
+
+        static unsigned long getHostId(const std::string &hostname);
+
+        static const std::string &getHostname(unsigned long host_id);
+
+        static simgrid::s4u::Host *getHost(unsigned long host_id);
+
+        static unsigned int getNumCores(unsigned long host_id);
+
+        static double getFlopRate(unsigned long host_id);
+
+        static double getMemoryCapacity(unsigned long host_id);
+
+    private:
+
+        /** @brief The cached attributes of a host */
+        struct HostAttributes {
+            std::string hostname;
+            simgrid::s4u::Host *host;
+            unsigned int num_cores;
+            double flop_rate;
+            double memory_capacity;
+            /** @brief The error message for an invalid memory capacity specification
+             *         (reported upon lookup rather than when the registry is built) */
+            std::string memory_capacity_error;
+        };
+
+        static const HostAttributes &getAttributes(unsigned long host_id);
+
+        static unsigned long registerHost(simgrid::s4u::Host *host);
+
+        /** @brief The attributes of the hosts, indexed by host id (a deque, so that references to
+         *         the attributes, e.g., hostnames, remain valid when hosts are registered) */
+        static std::deque<HostAttributes> hosts;
+        static std::unordered_map<std::string, unsigned long> host_ids;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_S4U_HOSTREGISTRY_H
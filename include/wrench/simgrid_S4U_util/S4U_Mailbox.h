@@ -12,9 +12,12 @@
 #define WRENCH_S4U_MAILBOX_H
 
 
+#include <deque>
 #include <string>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include <simgrid/s4u.hpp>
 
@@ -35,17 +38,67 @@ namespace wrench {
 		public:
 				static std::unique_ptr<SimulationMessage> getMessage(std::string mailbox);
 				static std::unique_ptr<SimulationMessage> getMessage(std::string mailbox, double timeout);
-				static void putMessage(std::string mailbox, SimulationMessage *m);
-				static void dputMessage(std::string mailbox_name, SimulationMessage *msg);
-				static std::unique_ptr<S4U_PendingCommunication> iputMessage(std::string mailbox_name, SimulationMessage *msg);
+				static void putMessage(std::string mailbox, SimulationMessage *m, unsigned long correlation_id = 0);
+				static void dputMessage(std::string mailbox_name, SimulationMessage *msg, unsigned long correlation_id = 0);
+				static std::unique_ptr<S4U_PendingCommunication> iputMessage(std::string mailbox_name, SimulationMessage *msg, unsigned long correlation_id = 0);
 				static std::unique_ptr<S4U_PendingCommunication> igetMessage(std::string mailbox_name);
 //				static void clear_dputs();
 
+				static std::unique_ptr<SimulationMessage> getReply(std::string mailbox_name, unsigned long correlation_id);
+				static std::unique_ptr<SimulationMessage> getReply(std::string mailbox_name, unsigned long correlation_id, double timeout);
+				static std::unique_ptr<SimulationMessage> getAnyReply(std::string mailbox_name, const std::vector<unsigned long> &correlation_ids);
+				static void expectReplies(unsigned long correlation_id);
+				static void ignoreReplies(unsigned long correlation_id);
+				static std::unique_ptr<SimulationMessage> takeKeptReply(unsigned long correlation_id);
+				static void routeReply(std::unique_ptr<SimulationMessage> msg);
+
 				static std::string generateUniqueMailboxName(std::string);
 				static unsigned long generateUniqueSequenceNumber();
 
+				static std::string generateReplyMailboxName();
+				static unsigned long generateCorrelationId();
+
+				static unsigned long getNumSentMessages();
+				static unsigned long getNumMemoryMessages();
+				static unsigned long getNumGeneratedMailboxNames();
+
+				static void setIdealControlPlane(bool enabled);
+				static bool isIdealControlPlane();
+
+				static void releaseMemoryReception(const std::string &mailbox_name);
+
 		private:
 
+				/** @brief The in-memory mailbox through which control messages go in ideal control plane mode */
+				struct MemoryMailbox {
+						/** @brief The delivered control messages */
+						std::deque<SimulationMessage *> messages;
+						/** @brief The number of pending asynchronous (network) receptions */
+						unsigned long num_posted_receptions = 0;
+						/** @brief The number of actors waiting for a message */
+						unsigned long num_waiters = 0;
+						/** @brief The mutex and condition on which receivers wait */
+						simgrid::s4u::MutexPtr mutex = nullptr;
+						simgrid::s4u::ConditionVariablePtr condition = nullptr;
+				};
+
+				static bool putMemoryMessage(const std::string &mailbox_name, SimulationMessage *msg);
+				static SimulationMessage *getMemoryMessage(const std::string &mailbox_name, double timeout);
+				static bool postMemoryReception(const std::string &mailbox_name, SimulationMessage **msg);
+				static void releaseMemoryMailbox(const std::string &mailbox_name);
+
+				static std::unique_ptr<SimulationMessage> receiveReply(const std::string &mailbox_name, const std::vector<unsigned long> &correlation_ids, double timeout);
+
+				static unsigned long num_sent_messages;
+				static unsigned long num_memory_messages;
+				static unsigned long num_generated_mailbox_names;
+				static unsigned long last_correlation_id;
+				static bool ideal_control_plane;
+				static std::map<std::string, MemoryMailbox> memory_mailboxes;
+				/** @brief The replies, indexed by correlation id, that were received while waiting for other replies
+				 *         and that are expected (see expectReplies()) */
+				static std::unordered_map<unsigned long, std::deque<SimulationMessage *>> expected_replies;
+
 //				static std::map<simgrid::s4u::ActorPtr , std::set<simgrid::s4u::CommPtr>> dputs;
 
 		};
@@ -27,6 +27,8 @@ namespace wrench {
     public:
         S4U_PendingCommunication(std::string mailbox);
 
+        ~S4U_PendingCommunication();
+
         std::unique_ptr<SimulationMessage> wait();
 
         static unsigned long waitForSomethingToHappen(
@@ -37,9 +39,15 @@ namespace wrench {
                 std::vector<S4U_PendingCommunication*> pending_comms,
                 double timeout);
 
-        simgrid::s4u::CommPtr comm_ptr;
-        SimulationMessage *simulation_message;
+        /** @brief The S4U communication (nullptr if the communication was completed in memory) */
+        simgrid::s4u::CommPtr comm_ptr = nullptr;
+        SimulationMessage *simulation_message = nullptr;
         std::string mailbox_name;
+        /** @brief Whether the communication is a reception posted in ideal control plane mode */
+        bool posted_memory_reception = false;
+
+    private:
+        void complete();
     };
 
     /** \endcond */
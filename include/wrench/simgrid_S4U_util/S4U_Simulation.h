@@ -44,6 +44,8 @@ namespace wrench {
 
 
 		private:
+				friend class S4U_HostRegistry;
+
 				static double getHostMemoryCapacity(simgrid::s4u::Host *host);
 				simgrid::s4u::Engine *engine;
 				bool initialized = false;
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_CRITICALPATHANALYZER_H
+#define WRENCH_CRITICALPATHANALYZER_H
+
+#include <string>
+#include <vector>
+
+namespace wrench {
+
+    class Workflow;
+    class WorkflowTask;
+    class SimulationOutput;
+
+    /**
+     * @brief One task on the executed critical path of a workflow, and how the time between the
+     *        completion of its critical predecessor and its own completion was spent
+     */
+    class CriticalPathSegment {
+
+    public:
+        /** @brief The task */
+        WorkflowTask *task = nullptr;
+        /** @brief The host on which the task executed */
+        std::string execution_host;
+
+        /** @brief The date at which the task's critical predecessor completed (0.0 for the first task) */
+        double ready_date = 0.0;
+        /** @brief The date at which the task was submitted (as part of a job) */
+        double submit_date = 0.0;
+        /** @brief The date at which the task started executing (i.e., reading its input files) */
+        double execution_start_date = 0.0;
+        /** @brief The date at which the task's computation started */
+        double computation_start_date = 0.0;
+        /** @brief The date at which the task's computation completed */
+        double computation_end_date = 0.0;
+        /** @brief The date at which the task completed (i.e., had written its output files) */
+        double end_date = 0.0;
+
+        /** @brief The time between the predecessor's completion and the task's submission */
+        double scheduling_gap = 0.0;
+        /** @brief The time between the task's submission and its execution start */
+        double queue_wait = 0.0;
+        /** @brief The time spent reading input files and writing output files */
+        double data_transfer = 0.0;
+        /** @brief The time spent computing */
+        double compute = 0.0;
+    };
+
+    /**
+     * @brief The busy and idle times of a host over the course of a workflow execution
+     */
+    class HostIdleTime {
+
+    public:
+        /** @brief The host name */
+        std::string hostname;
+        /** @brief The number of tasks that executed on the host */
+        unsigned long num_tasks = 0;
+        /** @brief The time during which at least one task executed on the host */
+        double busy_time = 0.0;
+        /** @brief The time, before the makespan, during which no task executed on the host */
+        double idle_time = 0.0;
+    };
+
+    /**
+     * @brief A post-mortem analysis of a workflow execution
+     */
+    class CriticalPathReport {
+
+    public:
+        /** @brief The workflow makespan (i.e., the completion date of the last task) */
+        double makespan = 0.0;
+
+        /** @brief The executed critical path, from the first task to the last task */
+        std::vector<CriticalPathSegment> critical_path;
+
+        /** @brief The total compute time along the critical path */
+        double compute_time = 0.0;
+        /** @brief The total data transfer time along the critical path */
+        double data_transfer_time = 0.0;
+        /** @brief The total queue wait time along the critical path */
+        double queue_wait_time = 0.0;
+        /** @brief The total scheduling gap time along the critical path */
+        double scheduling_gap_time = 0.0;
+
+        /** @brief The busy and idle times of each host, sorted by host name */
+        std::vector<HostIdleTime> hosts;
+
+        std::string toJSON(int indent = 2) const;
+    };
+
+    /**
+     * @brief An analyzer that reconstructs, after a simulation, the executed critical path of a workflow
+     *        (by walking back from the last completed task, through the parents that completed last),
+     *        and that attributes the time along that path to compute, data transfer, queue wait, and
+     *        scheduling gaps
+     *
+     * @details The analysis relies on task dates (WorkflowTask::getStartDate(), WorkflowTask::getEndDate(), etc.),
+     *          which are always recorded, and is refined by the SimulationTimestampTaskStart and
+     *          SimulationTimestampFileWriteStart traces, if they were enabled. Without the former,
+     *          input file reads are counted as queue wait; without the latter, output file writes are
+     *          counted as compute.
+     */
+    class CriticalPathAnalyzer {
+
+    public:
+
+        static CriticalPathReport analyze(Workflow *workflow, SimulationOutput &output,
+                                          const std::vector<std::string> &hostnames = {});
+    };
+
+};
+
+#endif //WRENCH_CRITICALPATHANALYZER_H
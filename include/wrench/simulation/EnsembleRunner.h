@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_ENSEMBLERUNNER_H
+#define WRENCH_ENSEMBLERUNNER_H
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace wrench {
+
+    class Simulation;
+
+    /**
+     * @brief The configuration of one simulation in an ensemble of independent simulations
+     */
+    class EnsembleConfiguration {
+
+    public:
+
+        /**
+         * @brief Constructor
+         *
+         * @param name: the configuration's name
+         * @param setup: a function that, given an initialized simulation, instantiates the platform,
+         *               the services, and the WMS(s) (i.e., everything but calling Simulation::launch())
+         * @param arguments: command-line arguments passed to Simulation::init() (e.g., SimGrid options)
+         */
+        EnsembleConfiguration(std::string name,
+                              std::function<void(Simulation *)> setup,
+                              std::vector<std::string> arguments = {}) :
+                name(std::move(name)), setup(std::move(setup)), arguments(std::move(arguments)) {}
+
+        /** @brief The configuration's name */
+        std::string name;
+        /** @brief The function that sets up the simulation */
+        std::function<void(Simulation *)> setup;
+        /** @brief The command-line arguments passed to Simulation::init() */
+        std::vector<std::string> arguments;
+    };
+
+    /**
+     * @brief The result of one simulation in an ensemble of independent simulations
+     */
+    class EnsembleResult {
+
+    public:
+        /** @brief The name of the configuration that was simulated */
+        std::string name;
+        /** @brief Whether the simulation completed successfully */
+        bool success = false;
+        /** @brief A human-readable failure cause (when success is false) */
+        std::string failure_cause;
+        /** @brief The wall-clock time, in seconds, it took to set up and run the simulation */
+        double wall_time = 0.0;
+        /** @brief The simulated date at which the simulation ended */
+        double simulated_end_date = 0.0;
+        /** @brief The (task id, completion date) pairs from the simulation's task completion trace */
+        std::vector<std::pair<std::string, double>> task_completion_dates;
+    };
+
+    /**
+     * @brief A runner that executes an ensemble of independent simulations in parallel, each in
+     *        its own forked worker process (since only one simulation can run per process)
+     */
+    class EnsembleRunner {
+
+    public:
+
+        explicit EnsembleRunner(unsigned long max_num_workers = 0);
+
+        unsigned long getMaxNumWorkers();
+
+        std::vector<EnsembleResult> run(const std::vector<EnsembleConfiguration> &configurations);
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        static std::string serializeResult(const EnsembleResult &result);
+
+        static EnsembleResult deserializeResult(const std::string &bytes);
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+    private:
+
+        static void runWorker(const EnsembleConfiguration &configuration, int fd);
+
+        unsigned long max_num_workers;
+    };
+
+};
+
+#endif //WRENCH_ENSEMBLERUNNER_H
@@ -64,7 +64,7 @@ namespace wrench {
         /***********************/
 
         template<class T>
-        void newTimestamp(SimulationTimestamp<T> *event);
+        void newTimestamp(const T &content);
 
         double getCurrentSimulatedDate();
 
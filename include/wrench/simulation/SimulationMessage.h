@@ -33,10 +33,14 @@ namespace wrench {
 
         virtual std::string getName();
 
+        virtual bool isControlMessage();
+
         /** @brief The message name */
         std::string name;
         /** @brief The message size in bytes */
         double payload;
+        /** @brief The id of the request/reply exchange to which the message belongs (0 if none) */
+        unsigned long correlation_id = 0;
     };
 
 
@@ -12,12 +12,18 @@
 #define WRENCH_SIMULATIONOUTPUT_H
 
 
+#include <bitset>
 #include <typeinfo>
 #include <typeindex>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <utility>
 
+#include "wrench/simgrid_S4U_util/S4U_Simulation.h"
 #include "wrench/simulation/SimulationTimestamp.h"
 #include "wrench/simulation/SimulationTrace.h"
+#include "wrench/simulation/SimulationTraceSink.h"
 
 namespace wrench {
 
@@ -28,22 +34,92 @@ namespace wrench {
 
     public:
 
+        /** @brief The maximum number of timestamp types */
+        static const unsigned int MAX_NUM_TIMESTAMP_TYPES = 64;
+
         /**
-         * @brief Retrieve a copy of a simulation trace (which should be filled in with timestamps)
+         * @brief Constructor
+         */
+        SimulationOutput() {
+          this->enabled_timestamp_types[SimulationTimestampTaskCompletion::TYPE_ID] = true;
+        }
+
+        /**
+         * @brief Retrieve a simulation trace (which should be filled in with timestamps)
          *        once the simulation has completed
          *
          * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
-         * @return a vector pointers to SimulationTimestampXXXX instances
+         * @return a (non-copying) view of the trace
+         */
+        template <class T> SimulationTraceView<T> getTrace() {
+          return SimulationTraceView<T>(this->findTrace<T>());
+        }
+
+        /**
+         * @brief Reserve space in a simulation trace, so that recording timestamps does not
+         *        cause reallocations (useful when the number of timestamps is known in advance)
+         *
+         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param num_timestamps: the number of timestamps
+         */
+        template <class T> void reserveTrace(size_t num_timestamps) {
+          this->getOrCreateTrace<T>()->reserve(num_timestamps);
+        }
+
+        /**
+         * @brief Enable or disable the recording of a type of timestamps (by default, only
+         *        SimulationTimestampTaskCompletion timestamps are recorded). Disabled timestamps
+         *        cost a single bit test.
+         *
+         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param enabled: true to enable, false to disable
+         */
+        template <class T> void setTimestampTypeEnabled(bool enabled) {
+          static_assert(T::TYPE_ID < MAX_NUM_TIMESTAMP_TYPES, "Invalid simulation timestamp type id");
+          this->enabled_timestamp_types[T::TYPE_ID] = enabled;
+        }
+
+        /**
+         * @brief Determine whether a type of timestamps is recorded
+         *
+         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return true or false
          */
-        template <class T> std::vector<SimulationTimestamp<T> *> getTrace() {
-          std::type_index type_index = std::type_index(typeid(T));
+        template <class T> bool isTimestampTypeEnabled() {
+          return this->enabled_timestamp_types[T::TYPE_ID];
+        }
 
-          std::vector<SimulationTimestamp<T> *> non_generic_vector;
-          SimulationTrace<T> *trace = (SimulationTrace<T> *)(this->traces[type_index]);
-          for (auto ts : trace->getTrace()) {
-            non_generic_vector.push_back((SimulationTimestamp<T> *)ts);
+        /**
+         * @brief Enable or disable the recording of all types of timestamps
+         *
+         * @param enabled: true to enable, false to disable
+         */
+        void setAllTimestampTypesEnabled(bool enabled) {
+          if (enabled) {
+            this->enabled_timestamp_types.set();
+          } else {
+            this->enabled_timestamp_types.reset();
           }
-          return non_generic_vector;
+        }
+
+        /**
+         * @brief Stream all subsequent timestamps to a trace sink (e.g., a file) during the simulation
+         *
+         * @param sink: the trace sink (nullptr to stop streaming)
+         * @param keep_in_memory: whether timestamps should also be kept in the in-memory traces
+         *        (by default they are not, so that memory usage does not grow with the simulation length)
+         */
+        void setTraceSink(std::shared_ptr<SimulationTraceSink> sink, bool keep_in_memory = false) {
+          this->trace_sink = std::move(sink);
+          this->keep_traces_in_memory = keep_in_memory;
+        }
+
+        /**
+         * @brief Retrieve the trace sink, if any
+         * @return the trace sink, or nullptr
+         */
+        std::shared_ptr<SimulationTraceSink> getTraceSink() {
+          return this->trace_sink;
         }
 
         /***********************/
@@ -51,17 +127,42 @@ namespace wrench {
         /***********************/
 
         /**
-         * @brief Append a simulation timestamp to a simulation trace
+         * @brief Append a simulation timestamp, dated with the current simulated date, to a simulation
+         *        trace (the timestamp is not even constructed if its type is disabled)
          *
          * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
-         * @param timestamp: a pointer to a SimulationTimestampXXXX object
+         * @param args: the arguments of the SimulationTimestampXXXX constructor
          */
-        template <class T> void addTimestamp(T *timestamp) {
-          std::type_index type_index = std::type_index(typeid(T));
-          if (this->traces.find(type_index) == this->traces.end()) {
-            this->traces[type_index] = new SimulationTrace<T>();
+        template <class T, class... Args> void addTimestamp(Args &&... args) {
+          if (not this->enabled_timestamp_types[T::TYPE_ID]) {
+            return;
           }
-          ((SimulationTrace<T> *)(this->traces[type_index]))->addTimestamp(new SimulationTimestamp<T>(timestamp));
+          this->addDatedTimestamp<T>(S4U_Simulation::getClock(), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Append a simulation timestamp, dated with a given date (e.g., a date captured before
+         *        a blocking operation), to a simulation trace (the timestamp is not even constructed
+         *        if its type is disabled)
+         *
+         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param date: the timestamp's date
+         * @param args: the arguments of the SimulationTimestampXXXX constructor
+         */
+        template <class T, class... Args> void addDatedTimestamp(double date, Args &&... args) {
+          if (not this->enabled_timestamp_types[T::TYPE_ID]) {
+            return;
+          }
+          T timestamp(std::forward<Args>(args)...);
+          if (this->trace_sink) {
+            this->trace_record.reset(T::getTypeName(), date);
+            timestamp.fillTraceRecord(this->trace_record);
+            this->trace_sink->write(this->trace_record);
+            if (not this->keep_traces_in_memory) {
+              return;
+            }
+          }
+          this->getOrCreateTrace<T>()->addTimestamp(date, timestamp);
         }
 
         /***********************/
@@ -77,6 +178,34 @@ namespace wrench {
 
     private:
         std::map<std::type_index, GenericSimulationTrace*> traces;
+        std::shared_ptr<SimulationTraceSink> trace_sink = nullptr;
+        bool keep_traces_in_memory = false;
+        // (reused for each streamed timestamp, so as not to allocate)
+        SimulationTraceRecord trace_record;
+        std::bitset<MAX_NUM_TIMESTAMP_TYPES> enabled_timestamp_types;
+
+        /**
+         * @brief Find a simulation trace
+         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return the trace, or nullptr if no timestamp of that type has been recorded
+         */
+        template <class T> SimulationTrace<T> *findTrace() {
+          auto it = this->traces.find(std::type_index(typeid(T)));
+          return (it == this->traces.end() ? nullptr : (SimulationTrace<T> *) (it->second));
+        }
+
+        /**
+         * @brief Find a simulation trace, creating it if needed
+         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return the trace
+         */
+        template <class T> SimulationTrace<T> *getOrCreateTrace() {
+          GenericSimulationTrace *&trace = this->traces[std::type_index(typeid(T))];
+          if (trace == nullptr) {
+            trace = new SimulationTrace<T>();
+          }
+          return (SimulationTrace<T> *) trace;
+        }
     };
 
 };
@@ -12,13 +12,14 @@
 
 
 #include <iostream>
-#include "wrench/simgrid_S4U_util/S4U_Simulation.h"
 #include "wrench/simulation/SimulationTimestampTypes.h"
 
 namespace wrench {
 
     /**
-     * @brief A simulation-generated timestamp
+     * @brief A simulation-generated timestamp, i.e., a (date, content) entry of a simulation trace.
+     *        This is a lightweight handle to an entry that is stored in the trace's columns, and
+     *        remains valid as long as the trace is not modified.
      *
      * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
      */
@@ -32,7 +33,7 @@ namespace wrench {
          *
          * @return the date (as a number of seconds since the beginning of the simulation)
          */
-        double getDate() {
+        double getDate() const {
           return this->date;
         }
 
@@ -41,35 +42,38 @@ namespace wrench {
          *
          * @return a pointer to a object of class T, i.e., a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
          */
-        T *getContent() {
+        T *getContent() const {
           return this->content;
         }
 
+        /**
+         * @brief Member access, so that a timestamp handle can be used as a timestamp pointer
+         *        (e.g., trace[0]->getDate())
+         *
+         * @return a pointer to this timestamp
+         */
+        const SimulationTimestamp<T> *operator->() const {
+          return this;
+        }
+
         /***********************/
         /** \cond DEVELOPER    */
         /***********************/
 
         /**
          * @brief Constructor
+         * @param date: the date
          * @param content: a pointer to a object of class T, i.e., a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
          */
-        SimulationTimestamp(T *content) {
-          // TODO: Make content a unique_ptr to make memory management better
-          this->content = content;
-          this->date = S4U_Simulation::getClock();
+        SimulationTimestamp(double date, T *content) : date(date), content(content) {
         }
 
         /***********************/
         /** \endcond           */
         /***********************/
 
-
-        ~SimulationTimestamp() {
-          delete this->content;
-        }
-
     private:
-        double date = -1.0;
+        double date;
         T *content;
 
     };
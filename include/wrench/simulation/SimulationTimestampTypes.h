@@ -11,17 +11,256 @@
 #define WRENCH_SIMULATIONTIMESTAMPTYPES_H
 
 
+#include <string>
+#include <utility>
+
 namespace wrench {
 
     class WorkflowTask;
+    class WorkflowFile;
+    class StorageService;
+    class ComputeService;
+    class SimulationTraceRecord;
+
+    /*
+     * Each timestamp type has:
+     *   - a TYPE_ID (unique, and smaller than SimulationOutput::MAX_NUM_TIMESTAMP_TYPES), used to
+     *     enable/disable the type at no cost (see SimulationOutput::setTimestampTypeEnabled())
+     *   - a getTypeName() method and a fillTraceRecord() method (which sets the subject and the
+     *     fields that the type carries), used when streaming traces
+     */
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A base class for timestamps about a workflow task
+     */
+    class SimulationTimestampTask {
+
+    public:
+
+        /**
+         * @brief Constructor
+         * @param task: a workflow task
+         */
+        explicit SimulationTimestampTask(WorkflowTask *task) : task(task) {
+        }
+
+        /**
+         * @brief Retrieve the task
+         *
+         * @return the task
+         */
+        WorkflowTask *getTask() {
+          return this->task;
+        }
+
+        std::string getSubject() const;
+
+        void fillTraceRecord(SimulationTraceRecord &record) const;
+
+    protected:
+        /** @brief The task */
+        WorkflowTask *task;
+    };
+
+    /**
+     * @brief A base class for timestamps about a file read or a file write
+     */
+    class SimulationTimestampFileTransfer {
+
+    public:
+
+        /**
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param storage_service: the storage service that the file is read from or written to
+         */
+        SimulationTimestampFileTransfer(WorkflowFile *file, StorageService *storage_service) :
+                file(file), storage_service(storage_service) {
+        }
+
+        /**
+         * @brief Retrieve the file
+         * @return the file
+         */
+        WorkflowFile *getFile() {
+          return this->file;
+        }
+
+        /**
+         * @brief Retrieve the storage service
+         * @return the storage service
+         */
+        StorageService *getStorageService() {
+          return this->storage_service;
+        }
+
+        double getNumBytes();
+
+        std::string getSubject() const;
+
+        void fillTraceRecord(SimulationTraceRecord &record) const;
+
+    protected:
+        /** @brief The file */
+        WorkflowFile *file;
+        /** @brief The storage service */
+        StorageService *storage_service;
+    };
+
+    /**
+     * @brief A base class for timestamps about a file copy between two storage services
+     */
+    class SimulationTimestampFileCopy {
+
+    public:
+
+        /**
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param src: the source storage service
+         * @param dst: the destination storage service
+         */
+        SimulationTimestampFileCopy(WorkflowFile *file, StorageService *src, StorageService *dst) :
+                file(file), src(src), dst(dst) {
+        }
+
+        /**
+         * @brief Retrieve the file
+         * @return the file
+         */
+        WorkflowFile *getFile() {
+          return this->file;
+        }
+
+        /**
+         * @brief Retrieve the source storage service
+         * @return the storage service
+         */
+        StorageService *getSource() {
+          return this->src;
+        }
+
+        /**
+         * @brief Retrieve the destination storage service
+         * @return the storage service
+         */
+        StorageService *getDestination() {
+          return this->dst;
+        }
+
+        double getNumBytes();
+
+        std::string getSubject() const;
+
+        void fillTraceRecord(SimulationTraceRecord &record) const;
+
+    protected:
+        /** @brief The file */
+        WorkflowFile *file;
+        /** @brief The source storage service */
+        StorageService *src;
+        /** @brief The destination storage service */
+        StorageService *dst;
+    };
+
+    /**
+     * @brief A base class for timestamps about a (standard or pilot) job. Since jobs can be
+     *        deleted during the simulation, the job's name is stored rather than the job itself.
+     */
+    class SimulationTimestampJob {
+
+    public:
+
+        /**
+         * @brief Constructor
+         * @param job_name: the job's name
+         * @param compute_service: the compute service to which the job was submitted
+         */
+        SimulationTimestampJob(std::string job_name, ComputeService *compute_service) :
+                job_name(std::move(job_name)), compute_service(compute_service) {
+        }
+
+        /**
+         * @brief Retrieve the job's name
+         * @return a name
+         */
+        const std::string &getJobName() {
+          return this->job_name;
+        }
+
+        /**
+         * @brief Retrieve the compute service to which the job was submitted
+         * @return a compute service
+         */
+        ComputeService *getComputeService() {
+          return this->compute_service;
+        }
+
+        /**
+         * @brief Retrieve the id of what this timestamp is about (used when streaming traces)
+         * @return the job name
+         */
+        std::string getSubject() const {
+          return this->job_name;
+        }
+
+        void fillTraceRecord(SimulationTraceRecord &record) const;
+
+    protected:
+        /** @brief The job's name */
+        std::string job_name;
+        /** @brief The compute service */
+        ComputeService *compute_service;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+/** @brief Declares the TYPE_ID and the getTypeName() method of a timestamp type */
+#define WRENCH_SIMULATION_TIMESTAMP_TYPE(type_id, type_name) \
+        /** @brief The type's unique id */ \
+        static const unsigned int TYPE_ID = type_id; \
+        /** @brief Retrieve the name of this timestamp type (used when streaming traces) @return a type name */ \
+        static const std::string &getTypeName() { \
+          static const std::string name = type_name; \
+          return name; \
+        }
 
     /**
     * @brief A "task completion" simulation timestamp
     */
-    class SimulationTimestampTaskCompletion {
+    class SimulationTimestampTaskCompletion : public SimulationTimestampTask {
 
     public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param task: a workflow task
+         */
+        explicit SimulationTimestampTaskCompletion(WorkflowTask *task) : SimulationTimestampTask(task) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(0, "task_completion")
 
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "task start" simulation timestamp (the task begins reading its input files)
+    */
+    class SimulationTimestampTaskStart : public SimulationTimestampTask {
+
+    public:
         /***********************/
         /** \cond DEVELOPER    */
         /***********************/
@@ -30,29 +269,375 @@ namespace wrench {
          * @brief Constructor
          * @param task: a workflow task
          */
-        SimulationTimestampTaskCompletion(WorkflowTask *task) {
-          this->task = task;
+        explicit SimulationTimestampTaskStart(WorkflowTask *task) : SimulationTimestampTask(task) {
         }
 
-        ~SimulationTimestampTaskCompletion() {
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(1, "task_start")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "task failure" simulation timestamp
+    */
+    class SimulationTimestampTaskFailure : public SimulationTimestampTask {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param task: a workflow task
+         */
+        explicit SimulationTimestampTaskFailure(WorkflowTask *task) : SimulationTimestampTask(task) {
         }
 
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(2, "task_failure")
+
         /***********************/
         /** \endcond           */
         /***********************/
+    };
+
+    /**
+    * @brief A "file read start" simulation timestamp
+    */
+    class SimulationTimestampFileReadStart : public SimulationTimestampFileTransfer {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
 
         /**
-         * @brief Retrieve the task that has completed
-         *
-         * @return the task
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param storage_service: the storage service from which the file is read
          */
-        WorkflowTask *getTask() {
-          return this->task;
+        SimulationTimestampFileReadStart(WorkflowFile *file, StorageService *storage_service) :
+                SimulationTimestampFileTransfer(file, storage_service) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(3, "file_read_start")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "file read completion" simulation timestamp
+    */
+    class SimulationTimestampFileReadCompletion : public SimulationTimestampFileTransfer {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param storage_service: the storage service from which the file was read
+         */
+        SimulationTimestampFileReadCompletion(WorkflowFile *file, StorageService *storage_service) :
+                SimulationTimestampFileTransfer(file, storage_service) {
         }
 
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(4, "file_read_completion")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "file write start" simulation timestamp
+    */
+    class SimulationTimestampFileWriteStart : public SimulationTimestampFileTransfer {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param storage_service: the storage service to which the file is written
+         */
+        SimulationTimestampFileWriteStart(WorkflowFile *file, StorageService *storage_service) :
+                SimulationTimestampFileTransfer(file, storage_service) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(5, "file_write_start")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "file write completion" simulation timestamp
+    */
+    class SimulationTimestampFileWriteCompletion : public SimulationTimestampFileTransfer {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param storage_service: the storage service to which the file was written
+         */
+        SimulationTimestampFileWriteCompletion(WorkflowFile *file, StorageService *storage_service) :
+                SimulationTimestampFileTransfer(file, storage_service) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(6, "file_write_completion")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "file copy start" simulation timestamp
+    */
+    class SimulationTimestampFileCopyStart : public SimulationTimestampFileCopy {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param src: the source storage service
+         * @param dst: the destination storage service
+         */
+        SimulationTimestampFileCopyStart(WorkflowFile *file, StorageService *src, StorageService *dst) :
+                SimulationTimestampFileCopy(file, src, dst) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(7, "file_copy_start")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "file copy completion" simulation timestamp
+    */
+    class SimulationTimestampFileCopyCompletion : public SimulationTimestampFileCopy {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param file: a workflow file
+         * @param src: the source storage service
+         * @param dst: the destination storage service
+         */
+        SimulationTimestampFileCopyCompletion(WorkflowFile *file, StorageService *src, StorageService *dst) :
+                SimulationTimestampFileCopy(file, src, dst) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(8, "file_copy_completion")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "job submission" simulation timestamp (for standard and pilot jobs)
+    */
+    class SimulationTimestampJobSubmission : public SimulationTimestampJob {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param job_name: the job's name
+         * @param compute_service: the compute service to which the job is submitted
+         */
+        SimulationTimestampJobSubmission(std::string job_name, ComputeService *compute_service) :
+                SimulationTimestampJob(std::move(job_name), compute_service) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(9, "job_submission")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "job start" simulation timestamp (a standard job starts executing)
+    */
+    class SimulationTimestampJobStart : public SimulationTimestampJob {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param job_name: the job's name
+         * @param compute_service: the compute service on which the job starts
+         */
+        SimulationTimestampJobStart(std::string job_name, ComputeService *compute_service) :
+                SimulationTimestampJob(std::move(job_name), compute_service) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(10, "job_start")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+    /**
+    * @brief A "job completion" simulation timestamp (a standard job has completed)
+    */
+    class SimulationTimestampJobCompletion : public SimulationTimestampJob {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param job_name: the job's name
+         * @param compute_service: the compute service on which the job ran
+         * @param submit_date: the date at which the job was submitted
+         * @param start_date: the date at which the job started (-1.0 if unknown)
+         */
+        SimulationTimestampJobCompletion(std::string job_name, ComputeService *compute_service,
+                                         double submit_date, double start_date) :
+                SimulationTimestampJob(std::move(job_name), compute_service),
+                submit_date(submit_date), start_date(start_date) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(11, "job_completion")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+        /**
+         * @brief Retrieve the date at which the job was submitted
+         * @return a date
+         */
+        double getSubmitDate() {
+          return this->submit_date;
+        }
+
+        /**
+         * @brief Retrieve the date at which the job started
+         * @return a date (-1.0 if unknown)
+         */
+        double getStartDate() {
+          return this->start_date;
+        }
+
+        /**
+         * @brief Retrieve the time the job spent waiting in a queue before starting
+         * @return a duration in seconds (-1.0 if unknown)
+         */
+        double getQueueWaitTime() {
+          if ((this->start_date < 0) or (this->submit_date < 0)) {
+            return -1.0;
+          }
+          return this->start_date - this->submit_date;
+        }
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        void fillTraceRecord(SimulationTraceRecord &record) const;
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
     private:
-        WorkflowTask *task;
+        double submit_date;
+        double start_date;
+    };
+
+    /**
+    * @brief A "pilot job start" simulation timestamp
+    */
+    class SimulationTimestampPilotJobStart : public SimulationTimestampJob {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param job_name: the pilot job's name
+         * @param compute_service: the compute service on which the pilot job starts
+         */
+        SimulationTimestampPilotJobStart(std::string job_name, ComputeService *compute_service) :
+                SimulationTimestampJob(std::move(job_name), compute_service) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(12, "pilot_job_start")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
     };
+
+    /**
+    * @brief A "pilot job expiration" simulation timestamp
+    */
+    class SimulationTimestampPilotJobExpiration : public SimulationTimestampJob {
+
+    public:
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param job_name: the pilot job's name
+         * @param compute_service: the compute service on which the pilot job ran
+         */
+        SimulationTimestampPilotJobExpiration(std::string job_name, ComputeService *compute_service) :
+                SimulationTimestampJob(std::move(job_name), compute_service) {
+        }
+
+        WRENCH_SIMULATION_TIMESTAMP_TYPE(13, "pilot_job_expiration")
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+#undef WRENCH_SIMULATION_TIMESTAMP_TYPE
+
 };
 
 #endif //WRENCH_SIMULATIONTIMESTAMPTYPES_H
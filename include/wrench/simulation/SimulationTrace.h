@@ -10,6 +10,8 @@
 #ifndef WRENCH_SIMULATIONTRACE_H
 #define WRENCH_SIMULATIONTRACE_H
 
+#include <cstddef>
+#include <iterator>
 #include <vector>
 #include <map>
 
@@ -38,7 +40,8 @@ namespace wrench {
     /***********************/
 
     /**
-     * @brief A template class to represent a trace of timestamps
+     * @brief A template class to represent a trace of timestamps, stored in two
+     *        contiguous columns (dates and contents) that can be pre-reserved
      *
      * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
      */
@@ -49,31 +52,51 @@ namespace wrench {
         /**
          * @brief Append a timestamp to the trace
          *
-         * @param timestamp: a pointer to a SimulationTimestamp<T> object
-         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param date: the timestamp's date
+         * @param content: the timestamp's content (a SimulationTimestampXXXX object)
          */
-        void addTimestamp(SimulationTimestamp<T> *timestamp) {
-          this->trace.push_back(timestamp);
+        void addTimestamp(double date, const T &content) {
+          this->dates.push_back(date);
+          this->contents.push_back(content);
         }
 
         /**
-         * @brief Retrieve the trace as a vector of timestamps
+         * @brief Reserve space in the trace's columns
          *
-         * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
-         * @return a vector of pointers to SimulationTimestamp<T> objects
+         * @param num_timestamps: the number of timestamps that the trace should be able to hold without reallocation
          */
-        std::vector<SimulationTimestamp<T> *> getTrace() {
-          return this->trace;
+        void reserve(size_t num_timestamps) {
+          this->dates.reserve(num_timestamps);
+          this->contents.reserve(num_timestamps);
         }
 
-        ~SimulationTrace<T>() {
-          for (auto s : this->trace) {
-            delete s;
-          }
+        /**
+         * @brief Retrieve the number of timestamps in the trace
+         * @return a number of timestamps
+         */
+        size_t size() const {
+          return this->dates.size();
+        }
+
+        /**
+         * @brief Retrieve the column of timestamp dates
+         * @return a vector of dates
+         */
+        const std::vector<double> &getDates() const {
+          return this->dates;
+        }
+
+        /**
+         * @brief Retrieve the column of timestamp contents
+         * @return a vector of SimulationTimestampXXXX objects
+         */
+        std::vector<T> &getContents() {
+          return this->contents;
         }
 
     private:
-        std::vector<SimulationTimestamp<T> *> trace;
+        std::vector<double> dates;
+        std::vector<T> contents;
 
     };
 
@@ -81,6 +104,147 @@ namespace wrench {
     /** \endcond           */
     /***********************/
 
+    /**
+     * @brief A non-copying, read-only view of a simulation trace, which is valid as long as the
+     *        trace is not modified (i.e., typically once the simulation has completed)
+     *
+     * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+     */
+    template <class T> class SimulationTraceView {
+
+    public:
+
+        /**
+         * @brief An iterator over the timestamps of a trace view
+         */
+        class Iterator {
+
+        public:
+            /** @brief Iterator traits */
+            typedef std::forward_iterator_tag iterator_category;
+            /** @brief Iterator traits */
+            typedef SimulationTimestamp<T> value_type;
+            /** @brief Iterator traits */
+            typedef std::ptrdiff_t difference_type;
+            /** @brief Iterator traits */
+            typedef SimulationTimestamp<T> *pointer;
+            /** @brief Iterator traits */
+            typedef SimulationTimestamp<T> reference;
+
+            /**
+             * @brief Constructor
+             * @param view: the view
+             * @param index: the position in the view
+             */
+            Iterator(const SimulationTraceView<T> *view, size_t index) : view(view), index(index) {}
+
+            /**
+             * @brief Dereference
+             * @return the timestamp at the iterator's position
+             */
+            SimulationTimestamp<T> operator*() const {
+              return (*this->view)[this->index];
+            }
+
+            /**
+             * @brief Increment
+             * @return the iterator
+             */
+            Iterator &operator++() {
+              this->index++;
+              return *this;
+            }
+
+            /**
+             * @brief Equality
+             * @param other: another iterator
+             * @return true if both iterators are at the same position
+             */
+            bool operator==(const Iterator &other) const {
+              return this->index == other.index;
+            }
+
+            /**
+             * @brief Inequality
+             * @param other: another iterator
+             * @return true if the iterators are at different positions
+             */
+            bool operator!=(const Iterator &other) const {
+              return this->index != other.index;
+            }
+
+        private:
+            const SimulationTraceView<T> *view;
+            size_t index;
+        };
+
+        /**
+         * @brief Constructor
+         * @param trace: the trace (nullptr for an empty view)
+         */
+        explicit SimulationTraceView(SimulationTrace<T> *trace) : trace(trace) {}
+
+        /**
+         * @brief Retrieve the number of timestamps
+         * @return a number of timestamps
+         */
+        size_t size() const {
+          return (this->trace ? this->trace->size() : 0);
+        }
+
+        /**
+         * @brief Determine whether the view is empty
+         * @return true or false
+         */
+        bool empty() const {
+          return this->size() == 0;
+        }
+
+        /**
+         * @brief Retrieve a timestamp
+         * @param index: the timestamp's position in the trace
+         * @return the timestamp
+         */
+        SimulationTimestamp<T> operator[](size_t index) const {
+          return SimulationTimestamp<T>(this->trace->getDates()[index], &(this->trace->getContents()[index]));
+        }
+
+        /**
+         * @brief Retrieve an iterator to the first timestamp
+         * @return an iterator
+         */
+        Iterator begin() const {
+          return Iterator(this, 0);
+        }
+
+        /**
+         * @brief Retrieve an iterator past the last timestamp
+         * @return an iterator
+         */
+        Iterator end() const {
+          return Iterator(this, this->size());
+        }
+
+        /**
+         * @brief Retrieve the (contiguous) column of timestamp dates
+         * @return a pointer to the first date (nullptr if the view is empty)
+         */
+        const double *getDates() const {
+          return (this->empty() ? nullptr : this->trace->getDates().data());
+        }
+
+        /**
+         * @brief Retrieve the (contiguous) column of timestamp contents
+         * @return a pointer to the first content (nullptr if the view is empty)
+         */
+        const T *getContents() const {
+          return (this->empty() ? nullptr : this->trace->getContents().data());
+        }
+
+    private:
+        SimulationTrace<T> *trace;
+    };
+
 };
 
 
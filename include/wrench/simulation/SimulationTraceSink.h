@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONTRACESINK_H
+#define WRENCH_SIMULATIONTRACESINK_H
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace wrench {
+
+    /**
+     * @brief A record of a streamed simulation trace, i.e., a timestamp of some type,
+     *        at some date, about some subject (e.g., a task id), with the fields that
+     *        the timestamp's type carries (the others are left empty)
+     */
+    class SimulationTraceRecord {
+
+    public:
+        /** @brief The timestamp type name (e.g., "task_completion") */
+        std::string type;
+        /** @brief The timestamp date */
+        double date = 0.0;
+        /** @brief The id of what the timestamp is about (e.g., a task id) */
+        std::string subject;
+        /** @brief The name of the storage service of a file read/write, of the source storage
+         *         service of a file copy, or of the compute service of a job ("" if none) */
+        std::string service;
+        /** @brief The name of the destination storage service of a file copy ("" if none) */
+        std::string destination_service;
+        /** @brief The number of bytes of a file read/write/copy (-1.0 if none) */
+        double num_bytes = -1.0;
+        /** @brief The date at which a completed job was submitted (-1.0 if none) */
+        double submit_date = -1.0;
+        /** @brief The date at which a completed job started (-1.0 if none) */
+        double start_date = -1.0;
+
+        /**
+         * @brief Retrieve the time a completed job spent waiting in a queue before starting
+         * @return a duration in seconds (-1.0 if unknown)
+         */
+        double getQueueWaitTime() const {
+          if ((this->start_date < 0) or (this->submit_date < 0)) {
+            return -1.0;
+          }
+          return this->start_date - this->submit_date;
+        }
+
+        /**
+         * @brief Reset the record to a timestamp of some type, at some date, with empty fields
+         * @param type: the timestamp type name
+         * @param date: the timestamp date
+         */
+        void reset(const std::string &type, double date) {
+          this->type = type;
+          this->date = date;
+          this->subject.clear();
+          this->service.clear();
+          this->destination_service.clear();
+          this->num_bytes = -1.0;
+          this->submit_date = -1.0;
+          this->start_date = -1.0;
+        }
+    };
+
+    /**
+     * @brief A sink that streams simulation timestamps to a file during the simulation, through
+     *        a bounded in-memory buffer, so that memory usage does not grow with the simulation length
+     */
+    class SimulationTraceSink {
+
+    public:
+
+        /** @brief Output file formats */
+        enum Format {
+            /** @brief Comma-separated values, with a "type,date,subject,service,destination_service,
+             *         num_bytes,submit_date,start_date,queue_wait" header line (empty fields are left blank) */
+            CSV,
+            /** @brief A compact binary format (see SimulationTraceReader) */
+            BINARY
+        };
+
+        SimulationTraceSink(const std::string &path, Format format, size_t buffer_size = 1024 * 1024);
+
+        ~SimulationTraceSink();
+
+        void write(const SimulationTraceRecord &record);
+
+        void write(const std::string &type, double date, const std::string &subject);
+
+        void flush();
+
+        unsigned long getNumRecords();
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        /** @brief The magic bytes at the beginning of a binary trace file */
+        static const char BINARY_MAGIC[8];
+        /** @brief The binary trace file format version (version 1 files, whose timestamps
+         *         have no fields beyond the subject, can still be read) */
+        static const uint32_t BINARY_VERSION = 2;
+        /** @brief Binary record tag: definition of a type name */
+        static const uint8_t BINARY_TYPE_DEFINITION = 0;
+        /** @brief Binary record tag: timestamp */
+        static const uint8_t BINARY_TIMESTAMP = 1;
+        /** @brief Binary record tag: definition of a service name */
+        static const uint8_t BINARY_SERVICE_DEFINITION = 2;
+        /** @brief Binary timestamp field bit: the service */
+        static const uint8_t BINARY_FIELD_SERVICE = 1;
+        /** @brief Binary timestamp field bit: the destination service */
+        static const uint8_t BINARY_FIELD_DESTINATION_SERVICE = 2;
+        /** @brief Binary timestamp field bit: the number of bytes */
+        static const uint8_t BINARY_FIELD_NUM_BYTES = 4;
+        /** @brief Binary timestamp field bit: the job submit and start dates */
+        static const uint8_t BINARY_FIELD_JOB_DATES = 8;
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+    private:
+
+        void append(const void *data, size_t size);
+
+        void appendCSVString(const std::string &string);
+
+        void appendCSVNumber(double number);
+
+        uint16_t getBinaryId(std::map<std::string, uint16_t> &ids, uint8_t definition_tag, const std::string &name);
+
+        std::ofstream file;
+        Format format;
+        size_t buffer_size;
+        std::string buffer;
+        std::map<std::string, uint16_t> type_ids;
+        std::map<std::string, uint16_t> service_ids;
+        SimulationTraceRecord record;
+        unsigned long num_records = 0;
+    };
+
+    /**
+     * @brief A reader for simulation traces written by a SimulationTraceSink in the BINARY format
+     */
+    class SimulationTraceReader {
+
+    public:
+
+        static void read(const std::string &path, const std::function<void(const SimulationTraceRecord &)> &callback);
+
+        static std::vector<SimulationTraceRecord> readAll(const std::string &path);
+    };
+
+};
+
+#endif //WRENCH_SIMULATIONTRACESINK_H
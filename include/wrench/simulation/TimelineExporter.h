@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_TIMELINEEXPORTER_H
+#define WRENCH_TIMELINEEXPORTER_H
+
+#include <cstddef>
+#include <string>
+
+namespace wrench {
+
+    class Workflow;
+    class SimulationOutput;
+
+    /**
+     * @brief An exporter that writes the timeline of a simulated execution to a file that can be opened in
+     *        a timeline viewer: task executions per host (on as many lanes as concurrently executing tasks),
+     *        file reads/writes/copies per storage service, and job lifetimes (queued, then running) per
+     *        compute service
+     *
+     * @details Task executions come from task dates (WorkflowTask::getStartDate(), WorkflowTask::getEndDate(),
+     *          WorkflowTask::getExecutionHost()), which are always recorded. File transfers and job lifetimes
+     *          come from the SimulationTimestampFileReadStart/Completion, SimulationTimestampFileWriteStart/Completion,
+     *          SimulationTimestampFileCopyStart/Completion, SimulationTimestampJobCompletion, and
+     *          SimulationTimestampPilotJobStart/Expiration traces, if they were enabled.
+     *
+     *          Events are written through a bounded buffer, as they are generated, and only compact
+     *          (fixed-size) interval records are kept in memory, so that runs with millions of tasks can
+     *          be exported.
+     */
+    class TimelineExporter {
+
+    public:
+
+        /** @brief Output file formats */
+        enum Format {
+            /** @brief Chrome Trace Event JSON (for chrome://tracing, Perfetto, etc.) */
+            CHROME_TRACE,
+            /** @brief Paje trace (for ViTE, PajeNG, etc.) */
+            PAJE
+        };
+
+        static void exportTimeline(Workflow *workflow, SimulationOutput &output, const std::string &path,
+                                   Format format = CHROME_TRACE, size_t buffer_size = 1024 * 1024);
+    };
+
+};
+
+#endif //WRENCH_TIMELINEEXPORTER_H
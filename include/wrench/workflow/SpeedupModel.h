@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SPEEDUPMODEL_H
+#define WRENCH_SPEEDUPMODEL_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace wrench {
+
+    /**
+     * @brief A model of how fast a multi-core task runs on some number of cores: a task
+     *        with a speedup of s on n cores runs its flops s times faster than on a single core
+     *        of parallel efficiency 1.0 (i.e., each of the n cores computes flops / s flops)
+     */
+    class SpeedupModel {
+
+    public:
+
+        virtual ~SpeedupModel() = default;
+
+        /**
+         * @brief Get the speedup on some number of cores
+         * @param num_cores: a number of cores (at least 1)
+         * @return the speedup
+         */
+        virtual double getSpeedup(unsigned long num_cores) const = 0;
+    };
+
+    /**
+     * @brief A speedup model in which each core has the same parallel efficiency, whatever the
+     *        number of cores (i.e., the speedup on n cores is n * efficiency)
+     */
+    class ConstantEfficiencySpeedupModel : public SpeedupModel {
+
+    public:
+
+        explicit ConstantEfficiencySpeedupModel(double efficiency);
+
+        double getSpeedup(unsigned long num_cores) const override;
+
+    private:
+        double efficiency;
+    };
+
+    /**
+     * @brief A speedup model that follows Amdahl's law: a fraction of the task's work is
+     *        sequential, and the rest is perfectly parallel (i.e., the speedup on n cores is
+     *        1 / (serial_fraction + (1 - serial_fraction) / n))
+     */
+    class AmdahlSpeedupModel : public SpeedupModel {
+
+    public:
+
+        explicit AmdahlSpeedupModel(double serial_fraction);
+
+        double getSpeedup(unsigned long num_cores) const override;
+
+    private:
+        double serial_fraction;
+    };
+
+    /**
+     * @brief A speedup model given by measured speedups on some numbers of cores, which is
+     *        interpolated linearly in between, scaled linearly below the smallest number of cores,
+     *        and constant above the largest one
+     */
+    class TabulatedSpeedupModel : public SpeedupModel {
+
+    public:
+
+        explicit TabulatedSpeedupModel(const std::map<unsigned long, double> &speedups);
+
+        double getSpeedup(unsigned long num_cores) const override;
+
+    private:
+        // <number of cores, speedup>, by increasing number of cores
+        std::vector<std::pair<unsigned long, double>> speedups;
+    };
+
+};
+
+#endif //WRENCH_SPEEDUPMODEL_H
@@ -11,12 +11,14 @@
 #define WRENCH_WORKFLOWTASK_H
 
 #include <map>
+#include <memory>
 #include <stack>
 #include <lemon/list_graph.h>
 #include <set>
 
 #include "wrench/workflow/job/WorkflowJob.h"
 #include "wrench/workflow/WorkflowFile.h"
+#include "wrench/workflow/SpeedupModel.h"
 
 namespace wrench {
 
@@ -36,6 +38,12 @@ namespace wrench {
 
         double getParallelEfficiency() const;
 
+        void setSpeedupModel(std::shared_ptr<SpeedupModel> speedup_model);
+
+        std::shared_ptr<SpeedupModel> getSpeedupModel() const;
+
+        double getSpeedup(unsigned long num_cores) const;
+
         double getMemoryRequirement() const;
 
         int getNumberOfChildren() const;
@@ -81,6 +89,9 @@ namespace wrench {
 
         double getEndDate();
 
+        double getSubmitDate();
+
+        std::string getExecutionHost();
 
         /***********************/
         /** \endcond           */
@@ -108,6 +119,10 @@ namespace wrench {
 
         void setEndDate(double date);
 
+        void setSubmitDate(double date);
+
+        void setExecutionHost(std::string hostname);
+
         void incrementFailureCount();
 
         /***********************/
@@ -125,10 +140,13 @@ namespace wrench {
         unsigned long min_num_cores;
         unsigned long max_num_cores;
         double parallel_efficiency;
+        std::shared_ptr<SpeedupModel> speedup_model = nullptr; // nullptr: constant parallel_efficiency
         double memory_requirement;
 
         double start_date = -1.0;          // Date at which task began execution (getter?)
         double end_date = -1.0;            // Date at which task finished execution (getter?)
+        double submit_date = -1.0;         // Date at which the task was last submitted (as part of a job)
+        std::string execution_host;        // Host on which the task last executed
         unsigned int failure_count = 0;    // Number of times the tasks has failed
 
         State state;
@@ -53,7 +53,7 @@ namespace wrench {
                     TERMINATED
         };
 
-        std::vector<WorkflowTask *> getTasks();
+        const std::vector<WorkflowTask *> &getTasks();
 
         void incrementNumCompletedTasks();
 
@@ -65,7 +65,7 @@ namespace wrench {
 
         StandardJob::State getState();
 
-        std::map<WorkflowFile *, StorageService *> getFileLocations();
+        const std::map<WorkflowFile *, StorageService *> &getFileLocations();
 
 
         // Tasks to run
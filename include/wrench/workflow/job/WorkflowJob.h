@@ -44,6 +44,10 @@ namespace wrench {
 
         std::string getName();
 
+        double getSubmitDate();
+
+        double getStartDate();
+
         /***********************/
         /** \cond INTERNAL     */
         /***********************/
@@ -60,6 +64,10 @@ namespace wrench {
 
         ComputeService *getParentComputeService();
 
+        void setSubmitDate(double date);
+
+        void setStartDate(double date);
+
         virtual ~WorkflowJob();
 
     protected:
@@ -78,6 +86,10 @@ namespace wrench {
         std::string name;
         /** @brief The compute service to which the job was submitted */
         ComputeService *parent_compute_service;
+        /** @brief The date at which the job was submitted */
+        double submit_date = -1.0;
+        /** @brief The date at which the job started executing */
+        double start_date = -1.0;
 
         /***********************/
         /** \endcond           */
@@ -17,6 +17,7 @@
 #include "wrench/services/compute/ComputeServiceMessage.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simgrid_S4U_util/S4U_Simulation.h"
+#include "wrench/simulation/Simulation.h"
 #include "wrench/simulation/SimulationMessage.h"
 #include "wrench/workflow/WorkflowTask.h"
 #include "wrench/workflow/job/StandardJob.h"
@@ -100,13 +101,13 @@ namespace wrench {
                                                std::set<std::tuple<WorkflowFile *, StorageService *>> cleanup_file_deletions) {
 
       // Do a sanity check of everything (looking for nullptr)
-      for (auto t : tasks) {
+      for (auto const &t : tasks) {
         if (t == nullptr) {
           throw std::invalid_argument("JobManager::createStandardJob(): nullptr task in the task vector");
         }
       }
 
-      for (auto fl : file_locations) {
+      for (auto const &fl : file_locations) {
         if (fl.first == nullptr) {
           throw std::invalid_argument("JobManager::createStandardJob(): nullptr workflow file in the file_locations map");
         }
@@ -115,7 +116,7 @@ namespace wrench {
         }
       }
 
-      for (auto fc : pre_file_copies) {
+      for (auto const &fc : pre_file_copies) {
         if (std::get<0>(fc) == nullptr) {
           throw std::invalid_argument("JobManager::createStandardJob(): nullptr workflow file in the pre_file_copies set");
         }
@@ -127,7 +128,7 @@ namespace wrench {
         }
       }
 
-      for (auto fc : post_file_copies) {
+      for (auto const &fc : post_file_copies) {
         if (std::get<0>(fc) == nullptr) {
           throw std::invalid_argument("JobManager::createStandardJob(): nullptr workflow file in the post_file_copies set");
         }
@@ -139,7 +140,7 @@ namespace wrench {
         }
       }
 
-      for (auto fd : cleanup_file_deletions) {
+      for (auto const &fd : cleanup_file_deletions) {
         if (std::get<0>(fd) == nullptr) {
           throw std::invalid_argument("JobManager::createStandardJob(): nullptr workflow file in the cleanup_file_deletions set");
         }
@@ -148,8 +149,10 @@ namespace wrench {
         }
       }
 
-      StandardJob *raw_ptr = new StandardJob(tasks, file_locations, pre_file_copies, post_file_copies,
-                                             cleanup_file_deletions);
+      // The job takes ownership of the (moved) arguments, which are not copied again
+      StandardJob *raw_ptr = new StandardJob(std::move(tasks), std::move(file_locations),
+                                             std::move(pre_file_copies), std::move(post_file_copies),
+                                             std::move(cleanup_file_deletions));
       std::unique_ptr<WorkflowJob> job = std::unique_ptr<StandardJob>(raw_ptr);
 
       this->jobs.insert(std::make_pair(raw_ptr, std::move(job)));
@@ -174,7 +177,7 @@ namespace wrench {
         throw std::invalid_argument("JobManager::createStandardJob(): Invalid arguments");
       }
 
-      return this->createStandardJob(tasks, file_locations, {}, {}, {});
+      return this->createStandardJob(std::move(tasks), std::move(file_locations), {}, {}, {});
     }
 
     /**
@@ -196,9 +199,7 @@ namespace wrench {
         throw std::invalid_argument("JobManager::createStandardJob(): Invalid arguments");
       }
 
-      std::vector<WorkflowTask *> tasks;
-      tasks.push_back(task);
-      return this->createStandardJob(tasks, file_locations);
+      return this->createStandardJob(std::vector<WorkflowTask *>({task}), std::move(file_locations));
     }
 
     /**
@@ -297,12 +298,17 @@ namespace wrench {
       // so that it will getMessage the initial callback
       job->pushCallbackMailbox(this->mailbox_name);
 
+      // The job is submitted when the submission starts (the compute service may start
+      // the job before it answers)
+      double submit_date = S4U_Simulation::getClock();
+
       // Update the job state and insert it into the pending list
       switch (job->getType()) {
         case WorkflowJob::STANDARD: {
           ((StandardJob *) job)->state = StandardJob::PENDING;
-          for (auto t : ((StandardJob *) job)->tasks) {
+          for (auto const &t : ((StandardJob *) job)->tasks) {
             t->setState(WorkflowTask::State::PENDING);
+            t->setSubmitDate(submit_date);
           }
           this->pending_standard_jobs.insert((StandardJob *) job);
           break;
@@ -316,11 +322,15 @@ namespace wrench {
 
       // Submit the job to the service
       try {
-        compute_service->submitJob(job, service_specific_args);
+        job->setSubmitDate(submit_date);
+        job->setStartDate(-1.0);
+        compute_service->submitJob(job, std::move(service_specific_args));
         job->setParentComputeService(compute_service);
       } catch (WorkflowExecutionException &e) {
         throw;
       }
+      this->simulation->output.addDatedTimestamp<SimulationTimestampJobSubmission>(submit_date, job->getName(),
+                                                                                   compute_service);
 
     }
 
@@ -493,6 +503,8 @@ namespace wrench {
           // update job state
           StandardJob *job = msg->job;
           job->state = StandardJob::State::COMPLETED;
+          this->simulation->output.addTimestamp<SimulationTimestampJobCompletion>(
+                  job->getName(), msg->compute_service, job->getSubmitDate(), job->getStartDate());
 
           // move the job from the "pending" list to the "completed" list
           this->pending_standard_jobs.erase(job);
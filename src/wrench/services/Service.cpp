@@ -112,12 +112,13 @@ namespace wrench {
       WRENCH_INFO("Telling the daemon listening on (%s) to terminate", this->mailbox_name.c_str());
 
       // Send a termination message to the daemon's mailbox_name - SYNCHRONOUSLY
-      std::string ack_mailbox = S4U_Mailbox::generateUniqueMailboxName("stop");
+      std::string ack_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new ServiceStopDaemonMessage(
                                         ack_mailbox,
-                                        this->getPropertyValueAsDouble(ServiceProperty::STOP_DAEMON_MESSAGE_PAYLOAD)));
+                                        this->getPropertyValueAsDouble(ServiceProperty::STOP_DAEMON_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -126,7 +127,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(ack_mailbox);
+        message = S4U_Mailbox::getReply(ack_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -141,6 +142,25 @@ namespace wrench {
       this->state = Service::DOWN;
     }
 
+    /**
+     * @brief Send a request to the daemon without waiting for the answer, which is to be
+     *        sent to the reply mailbox of a future with its correlation id
+     *
+     * @param future: the future answer
+     * @param request: the request message (whose answer mailbox should be the future's reply mailbox)
+     *
+     * @throw WorkflowExecutionException
+     */
+    void Service::sendRequestAsynchronously(ServiceFutureBase *future, SimulationMessage *request) {
+      try {
+        S4U_Mailbox::dputMessage(this->mailbox_name, request, future->getCorrelationId());
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        throw WorkflowExecutionException(cause);
+      } catch (std::shared_ptr<FatalFailure> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+    }
+
     /**
     * @brief Get the name of the host on which the service is running
     * @return the hostname
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/exceptions/WorkflowExecutionException.h"
+#include "wrench/services/ServiceFuture.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/workflow/execution_events/FailureCause.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     */
+    ServiceFutureBase::ServiceFutureBase() :
+            reply_mailbox(S4U_Mailbox::generateReplyMailboxName()),
+            correlation_id(S4U_Mailbox::generateCorrelationId()) {
+      // The answer must be kept if the actor receives it while waiting for another reply
+      S4U_Mailbox::expectReplies(this->correlation_id);
+    }
+
+    /**
+     * @brief Destructor (an answer that is still in flight is discarded once it is received)
+     */
+    ServiceFutureBase::~ServiceFutureBase() {
+      S4U_Mailbox::ignoreReplies(this->correlation_id);
+    }
+
+    /**
+     * @brief Get the mailbox to which the answer should be sent
+     *
+     * @return a mailbox name
+     */
+    std::string ServiceFutureBase::getReplyMailbox() {
+      return this->reply_mailbox;
+    }
+
+    /**
+     * @brief Get the correlation id with which the request, and thus the answer, should be sent
+     *
+     * @return a correlation id
+     */
+    unsigned long ServiceFutureBase::getCorrelationId() {
+      return this->correlation_id;
+    }
+
+    /**
+     * @brief Determine, without blocking, whether the answer has been received (or has failed to
+     *        be received). Answers are received by get(), waitAll(), and waitAny(), and are also
+     *        kept when the actor receives them while waiting for other replies.
+     *
+     * @return true or false
+     */
+    bool ServiceFutureBase::isReady() {
+      if (this->answer or this->failure_cause) {
+        return true;
+      }
+      this->answer = S4U_Mailbox::takeKeptReply(this->correlation_id);
+      return (this->answer != nullptr);
+    }
+
+    /**
+     * @brief Wait until the answers of all futures have arrived (or have failed to arrive)
+     *
+     * @param futures: a list of futures
+     */
+    void ServiceFutureBase::waitAll(const std::vector<ServiceFutureBase *> &futures) {
+      // The answers that arrive before the one being waited for are kept
+      for (auto const &future : futures) {
+        future->receive();
+      }
+    }
+
+    /**
+     * @brief Wait until the answer of one of the futures has arrived (or has failed to arrive)
+     *
+     * @param futures: a list of futures
+     * @return the index, in the list, of a future whose answer has arrived (the
+     *         lowest such index if several answers have already arrived)
+     *
+     * @throw std::invalid_argument
+     * @throw WorkflowExecutionException: if a message failed to be received (in which case none
+     *        of the futures is failed, and they can all be waited for again)
+     */
+    unsigned long ServiceFutureBase::waitAny(const std::vector<ServiceFutureBase *> &futures) {
+
+      if (futures.empty()) {
+        throw std::invalid_argument("ServiceFutureBase::waitAny(): invalid argument");
+      }
+
+      std::vector<unsigned long> correlation_ids;
+      for (unsigned long i = 0; i < futures.size(); i++) {
+        if (futures[i]->isReady()) {
+          return i;
+        }
+        correlation_ids.push_back(futures[i]->correlation_id);
+      }
+
+      std::unique_ptr<SimulationMessage> answer;
+      try {
+        answer = S4U_Mailbox::getAnyReply(futures[0]->reply_mailbox, correlation_ids);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        // There is no telling which answer (if any) failed to arrive, so the futures are left as they are
+        throw WorkflowExecutionException(cause);
+      } catch (std::shared_ptr<FatalFailure> &cause) {
+        throw WorkflowExecutionException(cause);
+      }
+
+      for (unsigned long i = 0; i < futures.size(); i++) {
+        if (futures[i]->correlation_id == answer->correlation_id) {
+          futures[i]->answer = std::move(answer);
+          return i;
+        }
+      }
+      throw std::runtime_error("ServiceFutureBase::waitAny(): Unexpected [" + answer->getName() + "] message");
+    }
+
+    /**
+     * @brief Get the answer message, waiting for it if need be
+     *
+     * @return the answer message (owned by the future)
+     *
+     * @throw WorkflowExecutionException
+     */
+    SimulationMessage *ServiceFutureBase::getAnswer() {
+      this->receive();
+      if (this->failure_cause) {
+        throw WorkflowExecutionException(this->failure_cause);
+      }
+      return this->answer.get();
+    }
+
+    /**
+     * @brief Wait for the answer message, if it hasn't been received yet, and record
+     *        it (or record the failure to receive it)
+     */
+    void ServiceFutureBase::receive() {
+      if (this->answer or this->failure_cause) {
+        return;
+      }
+      try {
+        this->answer = S4U_Mailbox::getReply(this->reply_mailbox, this->correlation_id);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        this->failure_cause = cause;
+      } catch (std::shared_ptr<FatalFailure> &cause) {
+        this->failure_cause = cause;
+      }
+    }
+
+};
@@ -309,6 +309,68 @@ namespace wrench {
       return dict["ttl"][0];
     }
 
+    /**
+     * @brief Asynchronously get core counts for each of the compute service's hosts
+     * @return a future core count list
+     *
+     * @throw WorkflowExecutionException
+     */
+    std::unique_ptr<ServiceFuture<std::vector<unsigned long>>> ComputeService::getNumCoresAsync() {
+      std::unique_ptr<ServiceFuture<std::vector<unsigned long>>> future(new ServiceFuture<std::vector<unsigned long>>(
+              [](SimulationMessage *message) {
+                return ComputeService::toUnsignedLongs(
+                        ComputeService::getServiceResourceInformationEntry(message, "num_cores"));
+              }));
+      this->sendServiceResourceInformationRequest(future.get());
+      return future;
+    }
+
+    /**
+     * @brief Asynchronously get idle core counts for each of the compute service's hosts
+     * @return a future idle core count list (could be empty)
+     *
+     * @throw WorkflowExecutionException
+     */
+    std::unique_ptr<ServiceFuture<std::vector<unsigned long>>> ComputeService::getNumIdleCoresAsync() {
+      std::unique_ptr<ServiceFuture<std::vector<unsigned long>>> future(new ServiceFuture<std::vector<unsigned long>>(
+              [](SimulationMessage *message) {
+                return ComputeService::toUnsignedLongs(
+                        ComputeService::getServiceResourceInformationEntry(message, "num_idle_cores"));
+              }));
+      this->sendServiceResourceInformationRequest(future.get());
+      return future;
+    }
+
+    /**
+     * @brief Asynchronously get the RAM capacities of the compute service's hosts
+     * @return a future RAM capacity list
+     *
+     * @throw WorkflowExecutionException
+     */
+    std::unique_ptr<ServiceFuture<std::vector<double>>> ComputeService::getMemoryCapacityAsync() {
+      std::unique_ptr<ServiceFuture<std::vector<double>>> future(new ServiceFuture<std::vector<double>>(
+              [](SimulationMessage *message) {
+                return ComputeService::getServiceResourceInformationEntry(message, "ram_capacities");
+              }));
+      this->sendServiceResourceInformationRequest(future.get());
+      return future;
+    }
+
+    /**
+     * @brief Asynchronously get the flop/sec rate of one core of each of the compute service's hosts
+     * @return a future flop rate list
+     *
+     * @throw WorkflowExecutionException
+     */
+    std::unique_ptr<ServiceFuture<std::vector<double>>> ComputeService::getCoreFlopRateAsync() {
+      std::unique_ptr<ServiceFuture<std::vector<double>>> future(new ServiceFuture<std::vector<double>>(
+              [](SimulationMessage *message) {
+                return ComputeService::getServiceResourceInformationEntry(message, "flop_rates");
+              }));
+      this->sendServiceResourceInformationRequest(future.get());
+      return future;
+    }
+
 
 ////    /**
 ////     * @brief Process a submit standard job request
@@ -384,6 +446,55 @@ namespace wrench {
       return this->default_storage_service;
     }
 
+    /**
+     * @brief Set a recorder of the core and RAM utilization of the compute service's hosts, which
+     *        is updated on every resource allocation change (to be called before the simulation is launched)
+     * @param recorder: a utilization recorder (nullptr for none)
+     */
+    void ComputeService::setUtilizationRecorder(std::shared_ptr<UtilizationRecorder> recorder) {
+      this->utilization_recorder = std::move(recorder);
+    }
+
+    /**
+     * @brief Get the recorder of the core and RAM utilization of the compute service's hosts
+     * @return a utilization recorder, or nullptr if none
+     */
+    std::shared_ptr<UtilizationRecorder> ComputeService::getUtilizationRecorder() {
+      return this->utilization_recorder;
+    }
+
+    /**
+     * @brief Record that cores and RAM have been allocated on a host, if utilization is recorded
+     * @param hostname: the host name
+     * @param num_cores: the number of allocated cores
+     * @param ram: the allocated RAM in bytes (ComputeService::ALL_RAM, the capacity of a host
+     *             without memory capacity specification, is recorded as 0)
+     */
+    void ComputeService::recordResourceAllocation(const std::string &hostname, unsigned long num_cores, double ram) {
+      if (this->utilization_recorder) {
+        if (ram == ComputeService::ALL_RAM) {
+          ram = 0.0;
+        }
+        this->utilization_recorder->allocate(S4U_Simulation::getClock(), hostname, num_cores, ram);
+      }
+    }
+
+    /**
+     * @brief Record that cores and RAM have been released on a host, if utilization is recorded
+     * @param hostname: the host name
+     * @param num_cores: the number of released cores
+     * @param ram: the released RAM in bytes (ComputeService::ALL_RAM, the capacity of a host
+     *             without memory capacity specification, is recorded as 0)
+     */
+    void ComputeService::recordResourceRelease(const std::string &hostname, unsigned long num_cores, double ram) {
+      if (this->utilization_recorder) {
+        if (ram == ComputeService::ALL_RAM) {
+          ram = 0.0;
+        }
+        this->utilization_recorder->release(S4U_Simulation::getClock(), hostname, num_cores, ram);
+      }
+    }
+
     /**
      * @brief Get information about the compute service as a dictionary of vectors
      * @return service information
@@ -395,13 +506,14 @@ namespace wrench {
       }
 
       // send a "info request" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("get_service_info");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name, new ComputeServiceResourceInformationRequestMessage(
                 answer_mailbox,
                 this->getPropertyValueAsDouble(
-                        ComputeServiceProperty::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD)));
+                        ComputeServiceProperty::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -409,7 +521,7 @@ namespace wrench {
       // Get the reply
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -422,4 +534,56 @@ namespace wrench {
                 "MultihostMulticoreComputeService::getServiceResourceInformation(): unexpected [" + msg->getName() + "] message");
       }
     }
+
+    /**
+     * @brief Send an "info request" message to the daemon without waiting for the answer
+     * @param future: the future answer
+     *
+     * @throw WorkflowExecutionException
+     */
+    void ComputeService::sendServiceResourceInformationRequest(ServiceFutureBase *future) {
+
+      if (this->state == Service::DOWN) {
+        throw WorkflowExecutionException(new ServiceIsDown(this));
+      }
+
+      this->sendRequestAsynchronously(future, new ComputeServiceResourceInformationRequestMessage(
+              future->getReplyMailbox(),
+              this->getPropertyValueAsDouble(ComputeServiceProperty::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD)));
+    }
+
+    /**
+     * @brief Get an entry of the service information dictionary carried by an "info answer" message
+     * @param message: the message
+     * @param key: the entry's key
+     * @return the entry (empty if the dictionary has no such entry)
+     *
+     * @throw std::runtime_error
+     */
+    std::vector<double> ComputeService::getServiceResourceInformationEntry(SimulationMessage *message,
+                                                                           const std::string &key) {
+      if (auto msg = dynamic_cast<ComputeServiceResourceInformationAnswerMessage *>(message)) {
+        auto it = msg->info.find(key);
+        if (it == msg->info.end()) {
+          return {};
+        }
+        return it->second;
+      } else {
+        throw std::runtime_error(
+                "ComputeService::getServiceResourceInformationEntry(): unexpected [" + message->getName() + "] message");
+      }
+    }
+
+    /**
+     * @brief Convert a list of (integral) doubles into a list of unsigned longs
+     * @param values: the list of doubles
+     * @return the list of unsigned longs
+     */
+    std::vector<unsigned long> ComputeService::toUnsignedLongs(const std::vector<double> &values) {
+      std::vector<unsigned long> to_return;
+      for (auto x : values) {
+        to_return.push_back((unsigned long) x);
+      }
+      return to_return;
+    }
 };
@@ -0,0 +1,363 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+#include "wrench/services/compute/HostCapacityIndex.h"
+
+namespace wrench {
+
+    /**
+     * @brief Set the free capacity of a host (adding the host to the index if needed)
+     *
+     * @param hostname: the host's name
+     * @param num_cores: the host's number of idle cores
+     * @param ram: the host's amount of available RAM in bytes
+     */
+    void HostCapacityIndex::setCapacity(const std::string &hostname, unsigned long num_cores, double ram) {
+      auto it = this->capacities.find(hostname);
+      if (it != this->capacities.end()) {
+        this->entries.erase(Entry(it->second.first, it->second.second, hostname));
+        it->second = std::make_pair(num_cores, ram);
+      } else {
+        this->capacities.insert(std::make_pair(hostname, std::make_pair(num_cores, ram)));
+      }
+      this->entries.insert(Entry(num_cores, ram, hostname));
+
+      auto position = this->positions.find(hostname);
+      if (position == this->positions.end()) {
+        position = this->positions.insert(std::make_pair(hostname, this->hostnames.size())).first;
+        this->hostnames.push_back(hostname);
+      }
+      this->setFirstFitCapacity(position->second, num_cores, ram);
+    }
+
+    /**
+     * @brief Remove a host from the index
+     *
+     * @param hostname: the host's name
+     */
+    void HostCapacityIndex::remove(const std::string &hostname) {
+      auto it = this->capacities.find(hostname);
+      if (it == this->capacities.end()) {
+        return;
+      }
+      this->entries.erase(Entry(it->second.first, it->second.second, hostname));
+      this->capacities.erase(it);
+      this->setFirstFitCapacity(this->positions[hostname], 0, std::numeric_limits<double>::lowest());
+    }
+
+    /**
+     * @brief Remove all hosts from the index
+     */
+    void HostCapacityIndex::clear() {
+      this->entries.clear();
+      this->capacities.clear();
+      this->positions.clear();
+      this->hostnames.clear();
+      this->first_fit_tree.clear();
+    }
+
+    /**
+     * @brief Get the number of idle cores of a host
+     *
+     * @param hostname: the host's name
+     * @return a number of cores
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned long HostCapacityIndex::getNumCores(const std::string &hostname) const {
+      auto it = this->capacities.find(hostname);
+      if (it == this->capacities.end()) {
+        throw std::invalid_argument("HostCapacityIndex::getNumCores(): Unknown host " + hostname);
+      }
+      return it->second.first;
+    }
+
+    /**
+     * @brief Get the amount of available RAM of a host
+     *
+     * @param hostname: the host's name
+     * @return a number of bytes
+     *
+     * @throw std::invalid_argument
+     */
+    double HostCapacityIndex::getRam(const std::string &hostname) const {
+      auto it = this->capacities.find(hostname);
+      if (it == this->capacities.end()) {
+        throw std::invalid_argument("HostCapacityIndex::getRam(): Unknown host " + hostname);
+      }
+      return it->second.second;
+    }
+
+    /**
+     * @brief Find the host that leaves the fewest idle cores when given the desired number
+     *        of cores or, if no host has that many idle cores, the host with the most idle cores
+     *        (ties are broken by picking the host with the least available RAM, and then by hostname)
+     *
+     * @param min_num_cores: the minimum number of cores
+     * @param desired_num_cores: the desired number of cores
+     * @param ram: the amount of RAM in bytes
+     * @return a hostname, or "" if no host has at least min_num_cores idle cores and ram bytes of available RAM
+     */
+    std::string HostCapacityIndex::findBestFit(unsigned long min_num_cores, unsigned long desired_num_cores,
+                                               double ram) const {
+      auto it = this->findFirstAtLeast(std::max(min_num_cores, desired_num_cores), ram);
+      if (it == this->entries.end()) {
+        it = this->findLastBefore(
+                this->entries.lower_bound(Entry(std::max(min_num_cores, desired_num_cores),
+                                                std::numeric_limits<double>::lowest(), "")),
+                min_num_cores, ram);
+      }
+      if (it == this->entries.end()) {
+        return "";
+      }
+      return std::get<2>(*it);
+    }
+
+    /**
+     * @brief Find the first host, in the order in which hosts were added to the index, that meets
+     *        the minimum requirements. The search skips the ranges of hosts in which no host has
+     *        enough idle cores, or no host has enough available RAM, which takes O(log H) time
+     *        unless many hosts have enough of one but not of the other
+     *
+     * @param min_num_cores: the minimum number of cores
+     * @param ram: the amount of RAM in bytes
+     * @return a hostname, or "" if no host has at least min_num_cores idle cores and ram bytes of available RAM
+     */
+    std::string HostCapacityIndex::findFirstFit(unsigned long min_num_cores, double ram) const {
+      if (this->first_fit_tree.empty()) {
+        return "";
+      }
+      unsigned long position = this->findFirstFitPosition(1, min_num_cores, ram);
+      if (position >= this->hostnames.size()) {
+        return "";
+      }
+      return this->hostnames[position];
+    }
+
+    /**
+     * @brief Find the host with the most idle cores that meets the minimum requirements
+     *        (ties are broken by picking the host with the least available RAM, and then by hostname)
+     *
+     * @param min_num_cores: the minimum number of cores
+     * @param ram: the amount of RAM in bytes
+     * @return a hostname, or "" if no host has at least min_num_cores idle cores and ram bytes of available RAM
+     */
+    std::string HostCapacityIndex::findWorstFit(unsigned long min_num_cores, double ram) const {
+      auto it = this->findLastBefore(this->entries.end(), min_num_cores, ram);
+      if (it == this->entries.end()) {
+        return "";
+      }
+      return std::get<2>(*it);
+    }
+
+    /**
+     * @brief Find the host that packs a request best in both dimensions (cores and RAM), i.e., the
+     *        host that, among those that meet the minimum requirements:
+     *          - displaces the fewest reservations (reservations are requests expected to come later,
+     *            e.g., large-memory tasks that are not running yet): using a host that has room for
+     *            a reservation, but would no longer have room afterwards, displaces one of the
+     *            identical reservations if fewer other hosts have room for them than there are
+     *            such reservations;
+     *          - then, can give the most cores (up to the desired number of cores);
+     *          - then, leaves the least idle cores and available RAM, each relative to a scale (e.g., the
+     *            largest host's number of cores and RAM), so that no dimension gets fragmented;
+     *          - then, comes first by hostname.
+     *        Unlike the other queries, this one scans all hosts (in O(H * R) time, where R is
+     *        the number of distinct reservations)
+     *
+     * @param min_num_cores: the minimum number of cores
+     * @param desired_num_cores: the desired number of cores
+     * @param ram: the amount of RAM in bytes
+     * @param core_scale: the number of cores relative to which idle cores are counted
+     * @param ram_scale: the amount of RAM relative to which available RAM is counted
+     * @param reservations: <minimum number of cores, RAM> pairs
+     * @return a hostname, or "" if no host has at least min_num_cores idle cores and ram bytes of available RAM
+     */
+    std::string HostCapacityIndex::findPackingFit(unsigned long min_num_cores, unsigned long desired_num_cores,
+                                                  double ram, unsigned long core_scale, double ram_scale,
+                                                  const std::vector<std::pair<unsigned long, double>> &reservations) const {
+
+      // Group identical reservations, and count the hosts that have room for each group:
+      // <cores, RAM> -> <number of reservations, number of hosts with room>
+      std::map<std::pair<unsigned long, double>, std::pair<unsigned long, unsigned long>> reservation_classes;
+      for (auto const &r : reservations) {
+        reservation_classes[r].first++;
+      }
+      for (auto &rc : reservation_classes) {
+        for (auto const &c : this->capacities) {
+          if ((c.second.first >= rc.first.first) and (c.second.second >= rc.first.second)) {
+            rc.second.second++;
+          }
+        }
+      }
+
+      std::string target_host = "";
+      std::tuple<unsigned long, unsigned long, double> target_score; // <displaced reservations, -cores, slack>
+      for (auto const &c : this->capacities) {
+        unsigned long num_cores = c.second.first;
+        double available_ram = c.second.second;
+        if ((num_cores < min_num_cores) or (available_ram < ram)) {
+          continue;
+        }
+        unsigned long allocated_num_cores = std::min(num_cores, desired_num_cores);
+        unsigned long remaining_num_cores = num_cores - allocated_num_cores;
+        double remaining_ram = available_ram - ram;
+
+        // Reservation classes that would be left with fewer hosts with room than reservations
+        unsigned long num_displaced_reservations = 0;
+        for (auto const &rc : reservation_classes) {
+          unsigned long rc_num_cores = rc.first.first;
+          double rc_ram = rc.first.second;
+          if ((num_cores >= rc_num_cores) and (available_ram >= rc_ram) and
+              ((remaining_num_cores < rc_num_cores) or (remaining_ram < rc_ram)) and
+              (rc.second.second - 1 < rc.second.first)) {
+            num_displaced_reservations++;
+          }
+        }
+
+        double slack = 0.0;
+        if (core_scale > 0) {
+          slack += (double) remaining_num_cores / (double) core_scale;
+        }
+        if (ram_scale > 0) {
+          slack += remaining_ram / ram_scale;
+        }
+
+        auto score = std::make_tuple(num_displaced_reservations,
+                                     std::numeric_limits<unsigned long>::max() - allocated_num_cores, slack);
+        if ((target_host.empty()) or (score < target_score) or
+            ((score == target_score) and (c.first < target_host))) {
+          target_host = c.first;
+          target_score = score;
+        }
+      }
+      return target_host;
+    }
+
+    /**
+     * @brief Find the entry with the fewest idle cores, among those with at least
+     *        some number of idle cores and some amount of available RAM
+     *
+     * @param min_num_cores: the minimum number of cores
+     * @param ram: the amount of RAM in bytes
+     * @return an entry iterator (end() if there is no such entry)
+     */
+    std::set<HostCapacityIndex::Entry>::const_iterator
+    HostCapacityIndex::findFirstAtLeast(unsigned long min_num_cores, double ram) const {
+      auto it = this->entries.lower_bound(Entry(min_num_cores, ram, ""));
+      // Each iteration either succeeds or skips (in O(log H)) the rest of a free core bucket
+      // in which no host has enough RAM
+      while (it != this->entries.end()) {
+        if (std::get<1>(*it) >= ram) {
+          return it;
+        }
+        it = this->entries.lower_bound(Entry(std::get<0>(*it), ram, ""));
+      }
+      return this->entries.end();
+    }
+
+    /**
+     * @brief Find the entry with the most idle cores, among the entries before a given one
+     *        that have at least some number of idle cores and some amount of available RAM
+     *
+     * @param it: an entry iterator (only the entries before it are considered)
+     * @param min_num_cores: the minimum number of cores
+     * @param ram: the amount of RAM in bytes
+     * @return an entry iterator (end() if there is no such entry)
+     */
+    std::set<HostCapacityIndex::Entry>::const_iterator
+    HostCapacityIndex::findLastBefore(std::set<Entry>::const_iterator it,
+                                      unsigned long min_num_cores, double ram) const {
+      // Go down free core buckets, looking in each for the first host with enough RAM
+      while (it != this->entries.begin()) {
+        unsigned long num_cores = std::get<0>(*std::prev(it));
+        if (num_cores < min_num_cores) {
+          break;
+        }
+        auto candidate = this->entries.lower_bound(Entry(num_cores, ram, ""));
+        if ((candidate != this->entries.end()) and (std::get<0>(*candidate) == num_cores)) {
+          return candidate;
+        }
+        it = this->entries.lower_bound(Entry(num_cores, std::numeric_limits<double>::lowest(), ""));
+      }
+      return this->entries.end();
+    }
+
+    /**
+     * @brief Set the free capacity of the host at some position in the first-fit tree
+     *        (growing the tree if needed)
+     *
+     * @param position: the host's position
+     * @param num_cores: the host's number of idle cores (0 if the host was removed)
+     * @param ram: the host's amount of available RAM in bytes (the lowest double if the host was removed)
+     */
+    void HostCapacityIndex::setFirstFitCapacity(unsigned long position, unsigned long num_cores, double ram) {
+      auto no_capacity = std::make_pair(0UL, std::numeric_limits<double>::lowest());
+
+      unsigned long num_leaves = this->first_fit_tree.size() / 2;
+      if (position >= num_leaves) {
+        unsigned long new_num_leaves = std::max(1UL, num_leaves);
+        while (position >= new_num_leaves) {
+          new_num_leaves *= 2;
+        }
+        std::vector<std::pair<unsigned long, double>> tree(2 * new_num_leaves, no_capacity);
+        std::copy(this->first_fit_tree.begin() + num_leaves, this->first_fit_tree.end(),
+                  tree.begin() + new_num_leaves);
+        for (unsigned long i = new_num_leaves - 1; i >= 1; i--) {
+          tree[i] = std::make_pair(std::max(tree[2 * i].first, tree[2 * i + 1].first),
+                                   std::max(tree[2 * i].second, tree[2 * i + 1].second));
+        }
+        this->first_fit_tree = std::move(tree);
+        num_leaves = new_num_leaves;
+      }
+
+      unsigned long i = num_leaves + position;
+      this->first_fit_tree[i] = std::make_pair(num_cores, ram);
+      for (i /= 2; i >= 1; i /= 2) {
+        this->first_fit_tree[i] = std::make_pair(
+                std::max(this->first_fit_tree[2 * i].first, this->first_fit_tree[2 * i + 1].first),
+                std::max(this->first_fit_tree[2 * i].second, this->first_fit_tree[2 * i + 1].second));
+      }
+    }
+
+    /**
+     * @brief Find the first position, in a subtree of the first-fit tree, of a host that has at
+     *        least some number of idle cores and some amount of available RAM
+     *
+     * @param node: the subtree's root
+     * @param min_num_cores: the minimum number of cores
+     * @param ram: the amount of RAM in bytes
+     * @return a position (the number of positions if there is no such host)
+     */
+    unsigned long HostCapacityIndex::findFirstFitPosition(unsigned long node, unsigned long min_num_cores,
+                                                          double ram) const {
+      if ((this->first_fit_tree[node].first < min_num_cores) or (this->first_fit_tree[node].second < ram)) {
+        return this->hostnames.size();
+      }
+      unsigned long num_leaves = this->first_fit_tree.size() / 2;
+      if (node >= num_leaves) {
+        unsigned long position = node - num_leaves;
+        if ((position >= this->hostnames.size()) or (this->capacities.count(this->hostnames[position]) == 0)) {
+          return this->hostnames.size();
+        }
+        return position;
+      }
+      unsigned long position = this->findFirstFitPosition(2 * node, min_num_cores, ram);
+      if (position < this->hostnames.size()) {
+        return position;
+      }
+      return this->findFirstFitPosition(2 * node + 1, min_num_cores, ram);
+    }
+
+};
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <queue>
+#include <set>
+#include <stdexcept>
+
+#include "wrench/services/compute/MoldableCoreAllocator.h"
+#include "wrench/workflow/WorkflowTask.h"
+
+namespace wrench {
+
+    /**
+     * @brief Estimate the execution time of a task on some number of cores, as simulated
+     *        by a workunit executor given the task's speedup (on cores that compute one flop per second)
+     *
+     * @param task: the task
+     * @param num_cores: the number of cores
+     * @return a time in seconds
+     *
+     * @throw std::invalid_argument
+     */
+    double MoldableCoreAllocator::estimateExecutionTime(WorkflowTask *task, unsigned long num_cores) {
+      if ((task == nullptr) or (num_cores == 0)) {
+        throw std::invalid_argument("MoldableCoreAllocator::estimateExecutionTime(): Invalid arguments");
+      }
+      return task->getFlops() / task->getSpeedup(num_cores);
+    }
+
+    /**
+     * @brief Allocate cores to tasks that run concurrently on a set of hosts, so as to reduce the
+     *        estimated time at which they have all completed. Tasks are admitted in the given order
+     *        (skipping those that do not fit) with their minimum numbers of cores, each on the host
+     *        with the most idle cores. Then, as long as the host of the task that would complete last
+     *        has idle cores, one more core is given to that task, until it cannot get more cores or
+     *        would not complete earlier with one more core. Remaining cores are left idle, rather
+     *        than given to tasks that would not complete earlier than the others anyway. This is a
+     *        heuristic: tasks are not moved between hosts once admitted, and neither RAM nor the
+     *        hosts on which tasks eventually run are taken into account.
+     *
+     * @param tasks: the tasks, in order of priority
+     * @param host_num_cores: the numbers of idle cores of the hosts
+     * @return a map of admitted tasks to numbers of cores
+     *
+     * @throw std::invalid_argument
+     */
+    std::map<WorkflowTask *, unsigned long> MoldableCoreAllocator::allocate(const std::vector<WorkflowTask *> &tasks,
+                                                                            const std::vector<unsigned long> &host_num_cores) {
+      std::map<WorkflowTask *, unsigned long> allocation;
+      std::vector<WorkflowTask *> admitted_tasks;
+      std::vector<unsigned long> admitted_task_hosts;
+
+      // Admit tasks with their minimum numbers of cores, each on the host with the most idle cores
+      // (ties are broken in favor of the first host)
+      std::vector<unsigned long> num_idle_cores = host_num_cores;
+      std::set<std::pair<unsigned long, long>> hosts; // <idle cores, -host index>
+      for (unsigned long i = 0; i < num_idle_cores.size(); i++) {
+        hosts.insert(std::make_pair(num_idle_cores[i], -((long) i)));
+      }
+      for (auto const &task : tasks) {
+        if (task == nullptr) {
+          throw std::invalid_argument("MoldableCoreAllocator::allocate(): Invalid arguments");
+        }
+        unsigned long min_num_cores = std::max<unsigned long>(1, task->getMinNumCores());
+        if (hosts.empty() or (hosts.rbegin()->first < min_num_cores) or (allocation.find(task) != allocation.end())) {
+          continue;
+        }
+        unsigned long host = (unsigned long) (-(hosts.rbegin()->second));
+        hosts.erase(std::prev(hosts.end()));
+        num_idle_cores[host] -= min_num_cores;
+        hosts.insert(std::make_pair(num_idle_cores[host], -((long) host)));
+
+        allocation[task] = min_num_cores;
+        admitted_tasks.push_back(task);
+        admitted_task_hosts.push_back(host);
+      }
+
+      // Give cores, one at a time, to the task that would complete last
+      // (ties are broken in favor of the task admitted first)
+      typedef std::pair<double, unsigned long> Completion; // <estimated execution time, admitted_tasks.size() - index>
+      std::priority_queue<Completion> completions;
+      for (unsigned long i = 0; i < admitted_tasks.size(); i++) {
+        completions.push(std::make_pair(estimateExecutionTime(admitted_tasks[i], allocation[admitted_tasks[i]]),
+                                        admitted_tasks.size() - i));
+      }
+      while (not completions.empty()) {
+        Completion completion = completions.top();
+        unsigned long index = admitted_tasks.size() - completion.second;
+        WorkflowTask *task = admitted_tasks[index];
+        unsigned long &task_num_cores = allocation[task];
+        if ((task_num_cores >= task->getMaxNumCores()) or (num_idle_cores[admitted_task_hosts[index]] == 0)) {
+          break;
+        }
+        double execution_time = estimateExecutionTime(task, task_num_cores + 1);
+        if (execution_time >= completion.first) {
+          break;
+        }
+        completions.pop();
+        task_num_cores++;
+        num_idle_cores[admitted_task_hosts[index]]--;
+        completions.push(std::make_pair(execution_time, completion.second));
+      }
+
+      return allocation;
+    }
+
+};
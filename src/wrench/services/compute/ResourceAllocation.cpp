@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "wrench/services/compute/ResourceAllocation.h"
+#include "wrench/simgrid_S4U_util/S4U_HostRegistry.h"
+
+namespace wrench {
+
+    /**
+     * @brief Get the name of the host
+     * @return a hostname
+     */
+    const std::string &ResourceAllocation::HostResources::getHostname() const {
+      return S4U_HostRegistry::getHostname(this->host_id);
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param resources: a list of <hostname, num_cores, ram> tuples
+     *
+     * @throw std::invalid_argument
+     */
+    ResourceAllocation::ResourceAllocation(
+            std::initializer_list<std::tuple<std::string, unsigned long, double>> resources) {
+      this->hosts.reserve(resources.size());
+      for (auto const &r : resources) {
+        this->add(std::get<0>(r), std::get<1>(r), std::get<2>(r));
+      }
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param resources: a set of <hostname, num_cores, ram> tuples
+     *
+     * @throw std::invalid_argument
+     */
+    ResourceAllocation::ResourceAllocation(const std::set<std::tuple<std::string, unsigned long, double>> &resources) {
+      this->hosts.reserve(resources.size());
+      for (auto const &r : resources) {
+        this->add(std::get<0>(r), std::get<1>(r), std::get<2>(r));
+      }
+    }
+
+    /**
+     * @brief Add resources on a host
+     *
+     * @param host_id: the host's id
+     * @param num_cores: the number of cores
+     * @param ram: the amount of RAM in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    void ResourceAllocation::add(unsigned long host_id, unsigned long num_cores, double ram) {
+      auto it = std::lower_bound(this->hosts.begin(), this->hosts.end(), host_id,
+                                 [](const HostResources &h, unsigned long id) { return h.host_id < id; });
+      if ((it != this->hosts.end()) and (it->host_id == host_id)) {
+        throw std::invalid_argument("ResourceAllocation::add(): Host " + S4U_HostRegistry::getHostname(host_id) +
+                                    " is already in the allocation");
+      }
+      this->hosts.insert(it, HostResources{host_id, num_cores, ram});
+    }
+
+    /**
+     * @brief Add resources on a host
+     *
+     * @param hostname: the host's name
+     * @param num_cores: the number of cores
+     * @param ram: the amount of RAM in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    void ResourceAllocation::add(const std::string &hostname, unsigned long num_cores, double ram) {
+      this->add(S4U_HostRegistry::getHostId(hostname), num_cores, ram);
+    }
+
+    /**
+     * @brief Find the resources allocated on a host
+     *
+     * @param host_id: the host's id
+     * @return the resources, or nullptr if the host is not in the allocation
+     */
+    const ResourceAllocation::HostResources *ResourceAllocation::find(unsigned long host_id) const {
+      auto it = std::lower_bound(this->hosts.begin(), this->hosts.end(), host_id,
+                                 [](const HostResources &h, unsigned long id) { return h.host_id < id; });
+      if ((it == this->hosts.end()) or (it->host_id != host_id)) {
+        return nullptr;
+      }
+      return &(*it);
+    }
+
+    /**
+     * @brief Find the resources allocated on a host
+     *
+     * @param hostname: the host's name
+     * @return the resources, or nullptr if the host is not in the allocation
+     */
+    const ResourceAllocation::HostResources *ResourceAllocation::find(const std::string &hostname) const {
+      unsigned long host_id = S4U_HostRegistry::findHostId(hostname);
+      if (host_id == S4U_HostRegistry::NO_HOST) {
+        return nullptr;
+      }
+      return this->find(host_id);
+    }
+
+    /**
+     * @brief Get the total number of cores
+     * @return a number of cores
+     */
+    unsigned long ResourceAllocation::getTotalNumCores() const {
+      unsigned long total = 0;
+      for (auto const &h : this->hosts) {
+        total += h.num_cores;
+      }
+      return total;
+    }
+
+    /**
+     * @brief Get the total amount of RAM
+     * @return a number of bytes
+     */
+    double ResourceAllocation::getTotalRam() const {
+      double total = 0.0;
+      for (auto const &h : this->hosts) {
+        total += h.ram;
+      }
+      return total;
+    }
+
+};
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <stdexcept>
+
+#include "wrench/services/compute/UtilizationRecorder.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor, for a recorder that records every utilization change
+     */
+    UtilizationRecorder::UtilizationRecorder() : max_num_samples_per_host(0), initial_period(0.0) {
+    }
+
+    /**
+     * @brief Constructor, for a recorder that downsamples utilization series
+     *
+     * @param max_num_samples_per_host: the maximum number of samples in a host's series (at least 2)
+     * @param initial_period: the initial period length in seconds
+     *
+     * @throw std::invalid_argument
+     */
+    UtilizationRecorder::UtilizationRecorder(unsigned long max_num_samples_per_host, double initial_period) {
+      if ((max_num_samples_per_host < 2) or (initial_period <= 0)) {
+        throw std::invalid_argument("UtilizationRecorder::UtilizationRecorder(): invalid arguments");
+      }
+      // An even maximum ensures that merged periods stay aligned with the current period
+      this->max_num_samples_per_host = max_num_samples_per_host - (max_num_samples_per_host % 2);
+      this->initial_period = initial_period;
+    }
+
+    /**
+     * @brief Determine whether the recorder downsamples utilization series
+     * @return true or false
+     */
+    bool UtilizationRecorder::isDownsampling() {
+      return (this->max_num_samples_per_host > 0);
+    }
+
+    /**
+     * @brief Get the names of the hosts for which utilization has been recorded
+     * @return a list of host names
+     */
+    std::vector<std::string> UtilizationRecorder::getHostnames() {
+      std::vector<std::string> hostnames;
+      for (auto const &s : this->series) {
+        hostnames.push_back(s.first);
+      }
+      return hostnames;
+    }
+
+    /**
+     * @brief Get the utilization series of a host
+     *
+     * @param hostname: the host name
+     * @return a piecewise-constant utilization series, in chronological order (in downsampling mode,
+     *         the current, incomplete, period is included, as is the current utilization)
+     *
+     * @throw std::invalid_argument
+     */
+    std::vector<UtilizationSample> UtilizationRecorder::getSamples(const std::string &hostname) {
+      auto it = this->series.find(hostname);
+      if (it == this->series.end()) {
+        throw std::invalid_argument("UtilizationRecorder::getSamples(): unknown host '" + hostname + "'");
+      }
+      HostSeries &series = it->second;
+
+      if (not this->isDownsampling()) {
+        return series.samples;
+      }
+
+      std::vector<UtilizationSample> samples = series.samples;
+      double duration = series.last_change_date - series.period_start;
+      if (duration > 0) {
+        samples.push_back({series.period_start, series.busy_core_integral / duration,
+                           series.used_ram_integral / duration});
+      }
+      samples.push_back({series.last_change_date, series.busy_cores, series.used_ram});
+      return samples;
+    }
+
+    /**
+     * @brief Get the current period length of a host's series in downsampling mode
+     *
+     * @param hostname: the host name
+     * @return a period length in seconds (0.0 if not downsampling)
+     *
+     * @throw std::invalid_argument
+     */
+    double UtilizationRecorder::getPeriod(const std::string &hostname) {
+      auto it = this->series.find(hostname);
+      if (it == this->series.end()) {
+        throw std::invalid_argument("UtilizationRecorder::getPeriod(): unknown host '" + hostname + "'");
+      }
+      return it->second.period;
+    }
+
+    /**
+     * @brief Record that cores and RAM have been allocated on a host
+     *
+     * @param date: the allocation date
+     * @param hostname: the host name
+     * @param num_cores: the number of allocated cores
+     * @param ram: the allocated RAM in bytes
+     */
+    void UtilizationRecorder::allocate(double date, const std::string &hostname, unsigned long num_cores, double ram) {
+      this->update(date, hostname, (double) num_cores, ram);
+    }
+
+    /**
+     * @brief Record that cores and RAM have been released on a host
+     *
+     * @param date: the release date
+     * @param hostname: the host name
+     * @param num_cores: the number of released cores
+     * @param ram: the released RAM in bytes
+     */
+    void UtilizationRecorder::release(double date, const std::string &hostname, unsigned long num_cores, double ram) {
+      this->update(date, hostname, -((double) num_cores), -ram);
+    }
+
+    /**
+     * @brief Apply a utilization change to a host's series
+     *
+     * @param date: the change date
+     * @param hostname: the host name
+     * @param core_delta: the change in the number of busy cores
+     * @param ram_delta: the change in the used RAM
+     */
+    void UtilizationRecorder::update(double date, const std::string &hostname, double core_delta, double ram_delta) {
+      auto it = this->series.find(hostname);
+      if (it == this->series.end()) {
+        it = this->series.insert(std::make_pair(hostname, HostSeries())).first;
+        it->second.last_change_date = date;
+        it->second.period_start = date;
+        it->second.period = this->initial_period;
+      }
+      HostSeries &series = it->second;
+
+      if (this->isDownsampling()) {
+        this->advance(series, date);
+      }
+      series.busy_cores += core_delta;
+      series.used_ram += ram_delta;
+      series.last_change_date = date;
+
+      if (not this->isDownsampling()) {
+        if ((not series.samples.empty()) and (series.samples.back().date == date)) {
+          series.samples.back().busy_cores = series.busy_cores;
+          series.samples.back().used_ram = series.used_ram;
+        } else {
+          series.samples.push_back({date, series.busy_cores, series.used_ram});
+        }
+      }
+    }
+
+    /**
+     * @brief Integrate a host's (constant) utilization up to a date, closing all periods that end
+     *        before that date (downsampling mode only)
+     *
+     * @param series: the host's series
+     * @param date: the date
+     */
+    void UtilizationRecorder::advance(HostSeries &series, double date) {
+      double from = series.last_change_date;
+
+      while (date >= series.period_start + series.period) {
+        double period_end = series.period_start + series.period;
+        series.busy_core_integral += series.busy_cores * (period_end - from);
+        series.used_ram_integral += series.used_ram * (period_end - from);
+        series.samples.push_back({series.period_start, series.busy_core_integral / series.period,
+                                  series.used_ram_integral / series.period});
+        series.period_start = period_end;
+        series.busy_core_integral = 0.0;
+        series.used_ram_integral = 0.0;
+        from = period_end;
+
+        // Merge adjacent periods when the series is full (there is an even number of them)
+        if (series.samples.size() >= this->max_num_samples_per_host) {
+          for (unsigned long i = 0; i < series.samples.size() / 2; i++) {
+            series.samples[i].date = series.samples[2 * i].date;
+            series.samples[i].busy_cores = (series.samples[2 * i].busy_cores + series.samples[2 * i + 1].busy_cores) / 2;
+            series.samples[i].used_ram = (series.samples[2 * i].used_ram + series.samples[2 * i + 1].used_ram) / 2;
+          }
+          series.samples.resize(series.samples.size() / 2);
+          series.period *= 2;
+        }
+      }
+
+      series.busy_core_integral += series.busy_cores * (date - from);
+      series.used_ram_integral += series.used_ram * (date - from);
+    }
+
+};
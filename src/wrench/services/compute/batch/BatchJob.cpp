@@ -80,16 +80,16 @@ namespace wrench {
       this->ending_time_stamp = time_stamp;
     }
 
-    std::set<std::tuple<std::string, unsigned long, double>> BatchJob::getResourcesAllocated() {
+    const ResourceAllocation &BatchJob::getResourcesAllocated() {
       return this->resources_allocated;
     }
 
-    void BatchJob::setAllocatedResources(std::set<std::tuple<std::string, unsigned long, double>> resources) {
+    void BatchJob::setAllocatedResources(ResourceAllocation resources) {
       if (resources.empty()) {
         throw std::invalid_argument(
                 "BatchJob::setAllocatedResources(): Empty Resources allocated"
         );
       }
-      this->resources_allocated = resources;
+      this->resources_allocated = std::move(resources);
     }
 }
@@ -206,6 +206,7 @@ namespace wrench {
           this->available_nodes_to_cores.insert({h, S4U_Simulation::getNumCores(h)});
         }
         this->host_id_to_names[i++] = h;
+        this->indexAvailableCores(h);
       }
 
       this->total_num_of_nodes = compute_hosts.size();
@@ -292,12 +293,13 @@ namespace wrench {
                                      num_hosts, num_cores_per_host, -1, S4U_Simulation::getClock());
 
       // Send a "run a batch job" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("batch_standard_job_mailbox");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new BatchServiceJobRequestMessage(answer_mailbox, batch_job,
                                                                   this->getPropertyValueAsDouble(
-                                                                          BatchServiceProperty::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                                                          BatchServiceProperty::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -305,7 +307,7 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -401,12 +403,13 @@ namespace wrench {
                                      nodes_asked_for, num_cores_per_hosts, -1, S4U_Simulation::getClock());
 
       //  send a "run a batch job" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("batch_pilot_job_mailbox");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new BatchServiceJobRequestMessage(answer_mailbox, batch_job,
                                                                   this->getPropertyValueAsDouble(
-                                                                          BatchServiceProperty::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                                                          BatchServiceProperty::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -414,7 +417,7 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -542,13 +545,37 @@ namespace wrench {
       }
     }
 
-    void BatchService::updateResources(std::set<std::tuple<std::string, unsigned long, double>> resources) {
+    /**
+     * @brief Update the host selection index with the number of available cores of a host
+     *
+     * @param hostname: the host's name
+     */
+    void BatchService::indexAvailableCores(const std::string &hostname) {
+      this->available_nodes_index.setCapacity(hostname, this->available_nodes_to_cores[hostname], 0);
+    }
+
+    /**
+     * @brief Get the RAM actually reserved on a host for a job
+     *
+     * @param hostname: the host's name
+     * @param ram_per_node: the RAM asked for (or ComputeService::ALL_RAM for the whole node)
+     * @return the RAM in bytes (the host's memory capacity for the whole node)
+     */
+    double BatchService::getAllocatedRam(const std::string &hostname, double ram_per_node) {
+      if (ram_per_node == ComputeService::ALL_RAM) {
+        return Simulation::getHostMemoryCapacity(hostname);
+      }
+      return ram_per_node;
+    }
+
+    void BatchService::updateResources(const ResourceAllocation &resources) {
       if (resources.empty()) {
         return;
       }
-      std::set<std::pair<std::string, unsigned long>>::iterator resource_it;
-      for (auto r : resources) {
-        this->available_nodes_to_cores[std::get<0>(r)] += std::get<1>(r);
+      for (auto const &r : resources) {
+        this->available_nodes_to_cores[r.getHostname()] += r.num_cores;
+        this->indexAvailableCores(r.getHostname());
+        this->recordResourceRelease(r.getHostname(), r.num_cores, r.ram);
       }
     }
 
@@ -562,9 +589,11 @@ namespace wrench {
         if ((*it)->getWorkflowJob() == job) {
           job_on_the_list = true;
           job_id = std::to_string(it->get()->getJobID());
-          std::set<std::tuple<std::string, unsigned long, double>> resources = (*it)->getResourcesAllocated();
-          for (auto r : resources) {
-            this->available_nodes_to_cores[std::get<0>(r)] += std::get<1>(r);
+          const ResourceAllocation &resources = (*it)->getResourcesAllocated();
+          for (auto const &r : resources) {
+            this->available_nodes_to_cores[r.getHostname()] += r.num_cores;
+            this->indexAvailableCores(r.getHostname());
+            this->recordResourceRelease(r.getHostname(), r.num_cores, r.ram);
           }
           this->running_jobs.erase(it);
           break;
@@ -586,7 +615,7 @@ namespace wrench {
       for (it = this->running_jobs.begin(); it != this->running_jobs.end(); it++) {
         if ((*it)->getWorkflowJob() == job) {
           // Update the cores count in the available resources
-          std::set<std::tuple<std::string, unsigned long, double>> resources = (*it)->getResourcesAllocated();
+          const ResourceAllocation &resources = (*it)->getResourcesAllocated();
           job_id = std::to_string((*it)->getJobID());
           this->updateResources(resources);
           this->running_jobs.erase(it);
@@ -677,7 +706,7 @@ namespace wrench {
       return;
     }
 
-    std::set<std::tuple<std::string, unsigned long, double>>
+    ResourceAllocation
     BatchService::scheduleOnHosts(std::string host_selection_algorithm,
                                   unsigned long num_nodes,
                                   unsigned long cores_per_node,
@@ -693,7 +722,7 @@ namespace wrench {
         throw std::runtime_error("BatchService::scheduleOnHosts(): Asking for too many cores per host");
       }
 
-      std::set<std::tuple<std::string, unsigned long, double>> resources = {};
+      ResourceAllocation resources;
       std::vector<std::string> hosts_assigned = {};
       if (host_selection_algorithm == "FIRSTFIT") {
         std::map<std::string, unsigned long>::iterator it;
@@ -703,48 +732,29 @@ namespace wrench {
           if ((*it).second >= cores_per_node) {
             //Remove that many cores from the available_nodes_to_core
             (*it).second -= cores_per_node;
+            this->indexAvailableCores((*it).first);
             hosts_assigned.push_back((*it).first);
-            resources.insert(std::make_tuple((*it).first, cores_per_node, ram_per_node));
+            resources.add((*it).first, cores_per_node, this->getAllocatedRam((*it).first, ram_per_node));
             if (++host_count >= num_nodes) {
               break;
             }
           }
         }
         if (resources.size() < num_nodes) {
-          resources = {};
+          resources = ResourceAllocation();
           std::vector<std::string>::iterator it;
           for (it = hosts_assigned.begin(); it != hosts_assigned.end(); it++) {
             available_nodes_to_cores[*it] += cores_per_node;
+            this->indexAvailableCores(*it);
           }
         }
       } else if (host_selection_algorithm == "BESTFIT") {
         while (resources.size() < num_nodes) {
-          unsigned long target_slack = 0;
-          std::string target_host = "";
-          unsigned long target_num_cores = 0;
-
-          for (auto h : this->available_nodes_to_cores) {
-            std::string hostname = std::get<0>(h);
-            unsigned long num_available_cores = std::get<1>(h);
-            if (num_available_cores < cores_per_node) {
-              continue;
-            }
-            unsigned long tentative_target_num_cores = MIN(num_available_cores, cores_per_node);
-            unsigned long tentative_target_slack =
-                    num_available_cores - tentative_target_num_cores;
-
-            if (target_host.empty() ||
-                (tentative_target_num_cores > target_num_cores) ||
-                ((tentative_target_num_cores == target_num_cores) &&
-                 (target_slack > tentative_target_slack))) {
-              target_host = hostname;
-              target_num_cores = tentative_target_num_cores;
-              target_slack = tentative_target_slack;
-            }
-          }
+          // The host with the fewest available cores among those with enough of them
+          std::string target_host = this->available_nodes_index.findBestFit(cores_per_node, cores_per_node, 0);
           if (target_host == "") {
             WRENCH_INFO("Didn't find a suitable host");
-            resources = {};
+            resources = ResourceAllocation();
             std::vector<std::string>::iterator it;
             for (it = hosts_assigned.begin(); it != hosts_assigned.end(); it++) {
               available_nodes_to_cores[*it] += cores_per_node;
@@ -752,8 +762,13 @@ namespace wrench {
             break;
           }
           this->available_nodes_to_cores[target_host] -= cores_per_node;
+          // Index the host as full until the end of the loop, so that it is not picked twice for this job
+          this->available_nodes_index.setCapacity(target_host, 0, 0);
           hosts_assigned.push_back(target_host);
-          resources.insert(std::make_tuple(target_host, cores_per_node, 0)); // TODO: RAM is set to 0 for now
+          resources.add(target_host, cores_per_node, this->getAllocatedRam(target_host, ram_per_node));
+        }
+        for (auto const &h : hosts_assigned) {
+          this->indexAvailableCores(h);
         }
       } else {
         throw std::invalid_argument(
@@ -833,9 +848,9 @@ namespace wrench {
 
       //Try to schedule hosts based on FIRSTFIT OR BESTFIT
       // Asking for the FULL RAM (TODO: Change this?)
-      std::set<std::tuple<std::string, unsigned long, double>> resources = this->scheduleOnHosts(
+      ResourceAllocation resources = this->scheduleOnHosts(
               this->getPropertyValueAsString(BatchServiceProperty::HOST_SELECTION_ALGORITHM),
-              num_nodes_asked_for, cores_per_node_asked_for, ComputeService::ALL_CORES);
+              num_nodes_asked_for, cores_per_node_asked_for, ComputeService::ALL_RAM);
 
       if (resources.empty()) {
         return false;
@@ -918,14 +933,15 @@ namespace wrench {
         throw WorkflowExecutionException(new ServiceIsDown(this));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_pilot_job");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       // Send a "terminate a pilot job" message to the daemon's mailbox_name
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new ComputeServiceTerminatePilotJobRequestMessage(answer_mailbox, job,
                                                                                   this->getPropertyValueAsDouble(
-                                                                                          BatchServiceProperty::TERMINATE_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                                                                          BatchServiceProperty::TERMINATE_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -934,7 +950,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -1074,7 +1090,8 @@ namespace wrench {
         try {
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getPropertyValueAsDouble(
-                                          BatchServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                                          BatchServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)),
+                                  msg->correlation_id);
 
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
@@ -1082,7 +1099,7 @@ namespace wrench {
         return false;
 
       } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-        processGetResourceInformation(msg->answer_mailbox);
+        processGetResourceInformation(msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<BatchSchedReadyMessage *>(message.get())) {
@@ -1094,7 +1111,7 @@ namespace wrench {
         return true;
 
       } else if (auto msg = dynamic_cast<BatchServiceJobRequestMessage *>(message.get())) {
-        processJobSubmission(msg->job, msg->answer_mailbox);
+        processJobSubmission(msg->job, msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<StandardJobExecutorDoneMessage *>(message.get())) {
@@ -1109,7 +1126,7 @@ namespace wrench {
         processPilotJobCompletion(msg->job);
         return true;
       } else if (auto msg = dynamic_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get())) {
-        processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
+        processPilotJobTerminationRequest(msg->job, msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<AlarmJobTimeOutMessage *>(message.get())) {
@@ -1156,8 +1173,9 @@ namespace wrench {
      *
      * @param job: the batch job object
      * @param answer_mailbox: the mailbox to which answer messages should be sent
+     * @param correlation_id: the id of the request/reply exchange
      */
-    void BatchService::processJobSubmission(BatchJob *job, std::string answer_mailbox) {
+    void BatchService::processJobSubmission(BatchJob *job, std::string answer_mailbox, unsigned long correlation_id) {
 
       WRENCH_INFO("Asked to run a batch job with id %ld", job->getJobID());
 
@@ -1174,7 +1192,8 @@ namespace wrench {
                                                            job->getWorkflowJob(),
                                                            this)),
                                            this->getPropertyValueAsDouble(
-                                                   BatchServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                                   BatchServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                                   correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1191,7 +1210,8 @@ namespace wrench {
                                                            job->getWorkflowJob(),
                                                            this)),
                                            this->getPropertyValueAsDouble(
-                                                   BatchServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                                   BatchServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                                   correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1227,7 +1247,8 @@ namespace wrench {
                                                                job->getWorkflowJob(),
                                                                this)),
                                                this->getPropertyValueAsDouble(
-                                                       BatchServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                                       BatchServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                                       correlation_id);
             } catch (std::shared_ptr<NetworkError> &cause) {}
             return;
           }
@@ -1248,7 +1269,8 @@ namespace wrench {
                                                            job->getWorkflowJob(),
                                                            this)),
                                            this->getPropertyValueAsDouble(
-                                                   BatchServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                                   BatchServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                                   correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {}
         return;
       }
@@ -1263,7 +1285,8 @@ namespace wrench {
                                            true,
                                            nullptr,
                                            this->getPropertyValueAsDouble(
-                                                   BatchServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                                   BatchServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                                   correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1275,7 +1298,8 @@ namespace wrench {
                                            true,
                                            nullptr,
                                            this->getPropertyValueAsDouble(
-                                                   BatchServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                                   BatchServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                                   correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1299,9 +1323,11 @@ namespace wrench {
           job_on_the_list = true;
           job_id = std::to_string((*it)->getJobID());
           // Update the cores count in the available resources
-          std::set<std::tuple<std::string, unsigned long, double>> resources = (*it)->getResourcesAllocated();
-          for (auto r : resources) {
-            this->available_nodes_to_cores[std::get<0>(r)] += std::get<1>(r);
+          const ResourceAllocation &resources = (*it)->getResourcesAllocated();
+          for (auto const &r : resources) {
+            this->available_nodes_to_cores[r.getHostname()] += r.num_cores;
+            this->indexAvailableCores(r.getHostname());
+            this->recordResourceRelease(r.getHostname(), r.num_cores, r.ram);
           }
           this->running_jobs.erase(it);
           this->pilot_job_alarms[job->getName()]->kill();
@@ -1322,6 +1348,8 @@ namespace wrench {
       this->notifyJobEventsToBatSched(job_id, "SUCCESS", "COMPLETED_SUCCESSFULLY", "");
 #endif
 
+      this->simulation->output.addTimestamp<SimulationTimestampPilotJobExpiration>(job->getName(), this);
+
       // Forward the notification
       try {
         S4U_Mailbox::dputMessage(job->popCallbackMailbox(),
@@ -1342,8 +1370,9 @@ namespace wrench {
      *
      * @param job: the job to terminate
      * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param correlation_id: the id of the request/reply exchange
      */
-    void BatchService::processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox) {
+    void BatchService::processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox, unsigned long correlation_id) {
 
 
       std::deque<std::unique_ptr<BatchJob>>::iterator it;
@@ -1357,7 +1386,7 @@ namespace wrench {
                   this->getPropertyValueAsDouble(
                           BatchServiceProperty::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD));
           try {
-            S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+            S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return;
           }
@@ -1379,7 +1408,7 @@ namespace wrench {
                   this->getPropertyValueAsDouble(
                           BatchServiceProperty::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD));
           try {
-            S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+            S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return;
           }
@@ -1397,16 +1426,18 @@ namespace wrench {
           job_id = std::to_string(it1->get()->getJobID());
           this->processPilotJobTimeout((PilotJob *) (*it1)->getWorkflowJob());
           // Update the cores count in the available resources
-          std::set<std::tuple<std::string, unsigned long, double>> resources = (*it1)->getResourcesAllocated();
-          for (auto r : resources) {
-            this->available_nodes_to_cores[std::get<0>(r)] += std::get<1>(r);
+          const ResourceAllocation &resources = (*it1)->getResourcesAllocated();
+          for (auto const &r : resources) {
+            this->available_nodes_to_cores[r.getHostname()] += r.num_cores;
+            this->indexAvailableCores(r.getHostname());
+            this->recordResourceRelease(r.getHostname(), r.num_cores, r.ram);
           }
           ComputeServiceTerminatePilotJobAnswerMessage *answer_message = new ComputeServiceTerminatePilotJobAnswerMessage(
                   job, this, true, nullptr,
                   this->getPropertyValueAsDouble(
                           BatchServiceProperty::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD));
           try {
-            S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+            S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return;
           }
@@ -1429,7 +1460,7 @@ namespace wrench {
               this->getPropertyValueAsDouble(
                       BatchServiceProperty::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD));
       try {
-        S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+        S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -1658,11 +1689,15 @@ namespace wrench {
 
 
     void
-    BatchService::processExecution(std::set<std::tuple<std::string, unsigned long, double>> resources,
+    BatchService::processExecution(const ResourceAllocation &resources,
                                    WorkflowJob *workflow_job,
                                    BatchJob *batch_job, unsigned long num_nodes_allocated,
                                    unsigned long time_in_minutes,
                                    unsigned long cores_per_node_asked_for) {
+      for (auto const &r : resources) {
+        this->recordResourceAllocation(r.getHostname(), r.num_cores, r.ram);
+      }
+
       switch (workflow_job->getType()) {
         case WorkflowJob::STANDARD: {
           auto job = (StandardJob *) workflow_job;
@@ -1673,14 +1708,28 @@ namespace wrench {
                   new StandardJobExecutor(
                           this->simulation,
                           this->mailbox_name,
-                          std::get<0>(*resources.begin()),
+                          resources[0].getHostname(),
                           (StandardJob *) workflow_job,
                           resources,
                           this->default_storage_service,
                           {{StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD,
                                    this->getPropertyValueAsString(
-                                           BatchServiceProperty::THREAD_STARTUP_OVERHEAD)}}));
+                                           BatchServiceProperty::THREAD_STARTUP_OVERHEAD)},
+                           {StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE,
+                                   this->getPropertyValueAsString(
+                                           BatchServiceProperty::MULTICORE_EXECUTION_MODE)},
+                           {StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE,
+                                   this->getPropertyValueAsString(
+                                           BatchServiceProperty::WORKUNIT_EXECUTOR_MODE)},
+                           {StandardJobExecutorProperty::FILE_OPERATION_MODE,
+                                   this->getPropertyValueAsString(
+                                           BatchServiceProperty::FILE_OPERATION_MODE)},
+                           {StandardJobExecutorProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS,
+                                   this->getPropertyValueAsString(
+                                           BatchServiceProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS)}}));
           executor->start(executor, true);
+          job->setStartDate(S4U_Simulation::getClock());
+          this->simulation->output.addTimestamp<SimulationTimestampJobStart>(job->getName(), this);
 
           this->running_standard_job_executors.insert(executor);
           batch_job->setEndingTimeStamp(S4U_Simulation::getClock() + time_in_minutes * 60);
@@ -1709,8 +1758,8 @@ namespace wrench {
                       num_nodes_allocated, cores_per_node_asked_for);
 
           std::vector<std::string> nodes_for_pilot_job = {};
-          for (auto r : resources) {
-            nodes_for_pilot_job.push_back(std::get<0>(r));
+          for (auto const &r : resources) {
+            nodes_for_pilot_job.push_back(r.getHostname());
           }
           std::string host_to_run_on = nodes_for_pilot_job[0];
 
@@ -1724,6 +1773,7 @@ namespace wrench {
                   new MultihostMulticoreComputeService(host_to_run_on,
                                                        true, false,
                                                        resources,
+                                                       {}, -1, nullptr, "",
                                                        this->default_storage_service
                   ));
           cs->setSimulation(this->simulation);
@@ -1734,6 +1784,8 @@ namespace wrench {
           } catch (std::runtime_error &e) {
             throw;
           }
+          job->setStartDate(S4U_Simulation::getClock());
+          this->simulation->output.addTimestamp<SimulationTimestampPilotJobStart>(job->getName(), this);
 
           // Put the job in the running queue
 //          this->running_jobs.insert(std::move(batch_job_ptr));
@@ -1822,14 +1874,16 @@ namespace wrench {
       unsigned long time_in_minutes = batch_job->getAllocatedTime();
       unsigned long cores_per_node_asked_for = batch_job->getAllocatedCoresPerNode();
 
-      std::set<std::tuple<std::string, unsigned long, double>> resources = {};
+      ResourceAllocation resources;
       std::vector<std::string> hosts_assigned = {};
       std::map<std::string, unsigned long>::iterator it;
 
       for (auto node:node_resources) {
         this->available_nodes_to_cores[this->host_id_to_names[node]] -= cores_per_node_asked_for;
-        resources.insert(std::make_tuple(this->host_id_to_names[node], cores_per_node_asked_for,
-                                         0)); // TODO: Is setting RAM to 0 ok here?
+        this->indexAvailableCores(this->host_id_to_names[node]);
+        // Batsched allocates whole nodes, RAM included
+        resources.add(this->host_id_to_names[node], cores_per_node_asked_for,
+                      this->getAllocatedRam(this->host_id_to_names[node], ComputeService::ALL_RAM));
       }
 
       processExecution(resources, workflow_job, batch_job, num_nodes_allocated, time_in_minutes,
@@ -1981,14 +2035,14 @@ namespace wrench {
     }
 
     std::string
-    BatchService::convertResourcesToJsonString(std::set<std::tuple<std::string, unsigned long, double>> resources) {
+    BatchService::convertResourcesToJsonString(const ResourceAllocation &resources) {
       // We completely ignore RAM here
       std::string output = "";
       std::string convrt = "";
       std::string result = "";
-      for (auto r : resources) {
-        convrt = std::to_string(std::get<1>(r));
-        output += std::get<0>(r) + ":" + (convrt) + ", ";
+      for (auto const &r : resources) {
+        convrt = std::to_string(r.num_cores);
+        output += r.getHostname() + ":" + (convrt) + ", ";
       }
       result = output.substr(0, output.size() - 2);
       return result;
@@ -1997,8 +2051,9 @@ namespace wrench {
     /**
     * @brief Process a "get resource description message"
     * @param answer_mailbox: the mailbox to which the description message should be sent
+    * @param correlation_id: the id of the request/reply exchange
     */
-    void BatchService::processGetResourceInformation(const std::string &answer_mailbox) {
+    void BatchService::processGetResourceInformation(const std::string &answer_mailbox, unsigned long correlation_id) {
       // Build a dictionary
       std::map<std::string, std::vector<double>> dict;
 
@@ -2057,7 +2112,7 @@ namespace wrench {
               this->getPropertyValueAsDouble(
                       ComputeServiceProperty::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD));
       try {
-        S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+        S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
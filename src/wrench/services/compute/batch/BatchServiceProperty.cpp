@@ -6,6 +6,10 @@
 
 namespace wrench {
     SET_PROPERTY_NAME(BatchServiceProperty, THREAD_STARTUP_OVERHEAD);
+    SET_PROPERTY_NAME(BatchServiceProperty, MULTICORE_EXECUTION_MODE);
+    SET_PROPERTY_NAME(BatchServiceProperty, WORKUNIT_EXECUTOR_MODE);
+    SET_PROPERTY_NAME(BatchServiceProperty, FILE_OPERATION_MODE);
+    SET_PROPERTY_NAME(BatchServiceProperty, MAX_NUM_CONCURRENT_FILE_OPERATIONS);
 //    SET_PROPERTY_NAME(BatchServiceProperty, STANDARD_JOB_DONE_MESSAGE_PAYLOAD);
 //    SET_PROPERTY_NAME(BatchServiceProperty, STANDARD_JOB_FAILED_MESSAGE_PAYLOAD);
 //    SET_PROPERTY_NAME(BatchServiceProperty, SUBMIT_BATCH_JOB_ANSWER_MESSAGE_PAYLOAD);
@@ -72,14 +72,15 @@ namespace wrench {
       serviceSanityCheck();
 
       // send a "get execution hosts" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("get_execution_hosts");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new CloudServiceGetExecutionHostsRequestMessage(
                                         answer_mailbox,
                                         this->getPropertyValueAsDouble(
-                                                CloudServiceProperty::GET_EXECUTION_HOSTS_REQUEST_MESSAGE_PAYLOAD)));
+                                                CloudServiceProperty::GET_EXECUTION_HOSTS_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -88,7 +89,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -122,7 +123,8 @@ namespace wrench {
       serviceSanityCheck();
 
       // send a "create vm" message to the daemon's mailbox_name
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("create_vm");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
@@ -130,7 +132,7 @@ namespace wrench {
                                         answer_mailbox, pm_hostname, vm_hostname, supports_standard_jobs,
                                         supports_pilot_jobs, num_cores, ram_memory, plist,
                                         this->getPropertyValueAsDouble(
-                                                CloudServiceProperty::CREATE_VM_REQUEST_MESSAGE_PAYLOAD)));
+                                                CloudServiceProperty::CREATE_VM_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -139,7 +141,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -164,7 +166,8 @@ namespace wrench {
 
       serviceSanityCheck();
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       //  send a "run a standard job" message to the daemon's mailbox_name
       try {
@@ -172,7 +175,7 @@ namespace wrench {
                                 new ComputeServiceSubmitStandardJobRequestMessage(
                                         answer_mailbox, job, service_specific_args,
                                         this->getPropertyValueAsDouble(
-                                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -180,7 +183,7 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -209,7 +212,8 @@ namespace wrench {
 
       serviceSanityCheck();
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       // Send a "run a pilot job" message to the daemon's mailbox_name
       try {
@@ -217,7 +221,7 @@ namespace wrench {
                 this->mailbox_name,
                 new ComputeServiceSubmitPilotJobRequestMessage(
                         answer_mailbox, job, this->getPropertyValueAsDouble(
-                                CloudServiceProperty::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                CloudServiceProperty::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -226,7 +230,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -316,31 +320,32 @@ namespace wrench {
         try {
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getPropertyValueAsDouble(
-                                          CloudServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                                          CloudServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)),
+                                  msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
         }
         return false;
 
       } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-        processGetResourceInformation(msg->answer_mailbox);
+        processGetResourceInformation(msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<CloudServiceGetExecutionHostsRequestMessage *>(message.get())) {
-        processGetExecutionHosts(msg->answer_mailbox);
+        processGetExecutionHosts(msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<CloudServiceCreateVMRequestMessage *>(message.get())) {
         processCreateVM(msg->answer_mailbox, msg->pm_hostname, msg->vm_hostname, msg->supports_standard_jobs,
-                        msg->supports_pilot_jobs, msg->num_cores, msg->ram_memory, msg->plist);
+                        msg->supports_pilot_jobs, msg->num_cores, msg->ram_memory, msg->plist, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-        processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+        processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-        processSubmitPilotJob(msg->answer_mailbox, msg->job);
+        processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->correlation_id);
         return true;
 
       } else {
@@ -352,8 +357,9 @@ namespace wrench {
      * @brief Get a list of execution hosts to run VMs
      *
      * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param correlation_id: the id of the request/reply exchange
      */
-    void CloudService::processGetExecutionHosts(const std::string &answer_mailbox) {
+    void CloudService::processGetExecutionHosts(const std::string &answer_mailbox, unsigned long correlation_id) {
 
       try {
         S4U_Mailbox::dputMessage(
@@ -361,7 +367,8 @@ namespace wrench {
                 new CloudServiceGetExecutionHostsAnswerMessage(
                         this->execution_hosts,
                         this->getPropertyValueAsDouble(
-                                CloudServiceProperty::GET_EXECUTION_HOSTS_ANSWER_MESSAGE_PAYLOAD)));
+                                CloudServiceProperty::GET_EXECUTION_HOSTS_ANSWER_MESSAGE_PAYLOAD)),
+                correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -378,6 +385,7 @@ namespace wrench {
      * @param num_cores: the number of cores the service can use (0 means "use as many as there are cores on the host")
      * @param ram_memory: the VM RAM memory capacity (0 means "use all memory available on the host", this can be lead to out of memory issue)
      * @param plist: a property list ({} means "use all defaults")
+     * @param correlation_id: the id of the request/reply exchange
      *
      * @throw std::runtime_error
      */
@@ -388,7 +396,8 @@ namespace wrench {
                                        bool supports_pilot_jobs,
                                        unsigned long num_cores,
                                        double ram_memory,
-                                       std::map<std::string, std::string> plist) {
+                                       std::map<std::string, std::string> plist,
+                                       unsigned long correlation_id) {
 
       WRENCH_INFO("Asked to create a VM on %s with %d cores", pm_hostname.c_str(), (int) num_cores);
 
@@ -441,13 +450,15 @@ namespace wrench {
                   answer_mailbox,
                   new CloudServiceCreateVMAnswerMessage(
                           true,
-                          this->getPropertyValueAsDouble(CloudServiceProperty::CREATE_VM_ANSWER_MESSAGE_PAYLOAD)));
+                          this->getPropertyValueAsDouble(CloudServiceProperty::CREATE_VM_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } else {
           S4U_Mailbox::dputMessage(
                   answer_mailbox,
                   new CloudServiceCreateVMAnswerMessage(
                           false,
-                          this->getPropertyValueAsDouble(CloudServiceProperty::CREATE_VM_ANSWER_MESSAGE_PAYLOAD)));
+                          this->getPropertyValueAsDouble(CloudServiceProperty::CREATE_VM_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         }
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
@@ -460,11 +471,13 @@ namespace wrench {
      * @param answer_mailbox: the mailbox to which the answer message should be sent
      * @param job: the job
      * @param service_specific_args: service specific arguments
+     * @param correlation_id: the id of the request/reply exchange
      *
      * @throw std::runtime_error
      */
     void CloudService::processSubmitStandardJob(const std::string &answer_mailbox, StandardJob *job,
-                                                std::map<std::string, std::string> &service_specific_args) {
+                                                std::map<std::string, std::string> &service_specific_args,
+                                                unsigned long correlation_id) {
 
       WRENCH_INFO("Asked to run a standard job with %ld tasks", job->getNumTasks());
       if (not this->supportsStandardJobs()) {
@@ -474,7 +487,8 @@ namespace wrench {
                   new ComputeServiceSubmitStandardJobAnswerMessage(
                           job, this, false, std::shared_ptr<FailureCause>(new JobTypeNotSupported(job, this)),
                           this->getPropertyValueAsDouble(
-                                  ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                  ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -494,7 +508,8 @@ namespace wrench {
                     answer_mailbox,
                     new ComputeServiceSubmitStandardJobAnswerMessage(
                             job, this, true, nullptr, this->getPropertyValueAsDouble(
-                                    ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                    ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                    correlation_id);
             return;
           } catch (std::shared_ptr<NetworkError> &cause) {
             return;
@@ -509,7 +524,8 @@ namespace wrench {
                 new ComputeServiceSubmitStandardJobAnswerMessage(
                         job, this, false, std::shared_ptr<FailureCause>(new NotEnoughComputeResources(job, this)),
                         this->getPropertyValueAsDouble(
-                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -520,10 +536,11 @@ namespace wrench {
      *
      * @param answer_mailbox: the mailbox to which the answer message should be sent
      * @param job: the job
+     * @param correlation_id: the id of the request/reply exchange
      *
      * @throw std::runtime_error
      */
-    void CloudService::processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job) {
+    void CloudService::processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job, unsigned long correlation_id) {
 
       WRENCH_INFO("Asked to run a pilot job with %ld hosts and %ld cores per host for %lf seconds",
                   job->getNumHosts(), job->getNumCoresPerHost(), job->getDuration());
@@ -534,7 +551,8 @@ namespace wrench {
                   answer_mailbox, new ComputeServiceSubmitPilotJobAnswerMessage(
                           job, this, false, std::shared_ptr<FailureCause>(new JobTypeNotSupported(job, this)),
                           this->getPropertyValueAsDouble(
-                                  CloudServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                  CloudServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -562,7 +580,8 @@ namespace wrench {
                   answer_mailbox, new ComputeServiceSubmitPilotJobAnswerMessage(
                           job, this, false, std::shared_ptr<FailureCause>(new NotEnoughComputeResources(job, this)),
                           this->getPropertyValueAsDouble(
-                                  CloudServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                  CloudServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -575,7 +594,8 @@ namespace wrench {
                 answer_mailbox, new ComputeServiceSubmitPilotJobAnswerMessage(
                         job, this, true, nullptr,
                         this->getPropertyValueAsDouble(
-                                CloudServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                CloudServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -584,8 +604,9 @@ namespace wrench {
     /**
      * @brief Process a "get resource information message"
      * @param answer_mailbox: the mailbox to which the description message should be sent
+     * @param correlation_id: the id of the request/reply exchange
      */
-    void CloudService::processGetResourceInformation(const std::string &answer_mailbox) {
+    void CloudService::processGetResourceInformation(const std::string &answer_mailbox, unsigned long correlation_id) {
       // Build a dictionary
       std::map<std::string, std::vector<double>> dict;
 
@@ -635,7 +656,7 @@ namespace wrench {
               this->getPropertyValueAsDouble(
                       ComputeServiceProperty::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD));
       try {
-        S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+        S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
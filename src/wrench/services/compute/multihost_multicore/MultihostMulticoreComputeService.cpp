@@ -7,6 +7,7 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <map>
 #include <wrench/util/PointerUtil.h>
 
@@ -14,8 +15,10 @@
 #include "wrench/services/compute/ComputeServiceMessage.h"
 #include "services/compute/standard_job_executor/StandardJobExecutorMessage.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simgrid_S4U_util/S4U_HostRegistry.h"
 #include "wrench/exceptions/WorkflowExecutionException.h"
 #include "wrench/logging/TerminalOutput.h"
+#include "wrench/services/compute/MoldableCoreAllocator.h"
 #include "wrench/services/compute/multihost_multicore/MultihostMulticoreComputeService.h"
 #include "wrench/services/storage/StorageService.h"
 #include "wrench/simulation/Simulation.h"
@@ -41,7 +44,8 @@ namespace wrench {
         throw WorkflowExecutionException(new ServiceIsDown(this));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       //  send a "run a standard job" message to the daemon's mailbox_name
       try {
@@ -49,7 +53,7 @@ namespace wrench {
                                 new ComputeServiceSubmitStandardJobRequestMessage(
                                         answer_mailbox, job, service_specific_args,
                                         this->getPropertyValueAsDouble(
-                                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -57,7 +61,7 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -99,7 +103,8 @@ namespace wrench {
         throw WorkflowExecutionException(new ServiceIsDown(this));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       // Send a "run a pilot job" message to the daemon's mailbox_name
       try {
@@ -107,7 +112,7 @@ namespace wrench {
                 this->mailbox_name,
                 new ComputeServiceSubmitPilotJobRequestMessage(
                         answer_mailbox, job, this->getPropertyValueAsDouble(
-                                MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -116,7 +121,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -167,7 +172,7 @@ namespace wrench {
       initiateInstance(hostname,
                        supports_standard_jobs,
                        supports_pilot_jobs,
-                       std::move(compute_resources),
+                       ResourceAllocation(compute_resources),
                        plist, -1, nullptr,
                        default_storage_service);
     }
@@ -196,15 +201,15 @@ namespace wrench {
                            supports_pilot_jobs,
                            default_storage_service) {
 
-      std::set<std::tuple<std::string, unsigned long, double>> compute_resources;
-      for (auto h : compute_hosts) {
-        compute_resources.insert(std::make_tuple(h, ComputeService::ALL_CORES, ComputeService::ALL_RAM));
+      ResourceAllocation compute_resources;
+      for (auto const &h : compute_hosts) {
+        compute_resources.add(h, ComputeService::ALL_CORES, ComputeService::ALL_RAM);
       }
 
       initiateInstance(hostname,
                        supports_standard_jobs,
                        supports_pilot_jobs,
-                       compute_resources,
+                       std::move(compute_resources),
                        std::move(plist), -1, nullptr,
                        default_storage_service);
     }
@@ -229,7 +234,7 @@ namespace wrench {
             const std::string &hostname,
             bool supports_standard_jobs,
             bool supports_pilot_jobs,
-            std::set<std::tuple<std::string, unsigned long, double>> compute_resources,
+            ResourceAllocation compute_resources,
             std::map<std::string, std::string> plist,
             double ttl,
             PilotJob *pj,
@@ -270,7 +275,7 @@ namespace wrench {
             const std::string &hostname,
             bool supports_standard_jobs,
             bool supports_pilot_jobs,
-            std::set<std::tuple<std::string, unsigned long, double>> compute_resources,
+            ResourceAllocation compute_resources,
             std::map<std::string, std::string> plist,
             double ttl,
             PilotJob *pj,
@@ -284,15 +289,10 @@ namespace wrench {
 
 
       // Check that there is at least one core per host and that hosts have enough cores
-      for (auto host : compute_resources) {
-        std::string hname = std::get<0>(host);
-        unsigned long requested_cores = std::get<1>(host);
-        unsigned long available_cores;
-        try {
-          available_cores = S4U_Simulation::getNumCores(hname);
-        } catch (std::runtime_error &e) {
-          throw std::invalid_argument("MultihostMulticoreComputeService::initiateInstance(): Host '" + hname + "' does not exist");
-        }
+      for (auto const &host : compute_resources) {
+        std::string const &hname = host.getHostname();
+        unsigned long requested_cores = host.num_cores;
+        unsigned long available_cores = S4U_HostRegistry::getNumCores(host.host_id);
         if (requested_cores == ComputeService::ALL_CORES) {
           requested_cores = available_cores;
         }
@@ -308,8 +308,8 @@ namespace wrench {
         }
 
 
-        double requested_ram = std::get<2>(host);
-        double available_ram = S4U_Simulation::getHostMemoryCapacity(hname);
+        double requested_ram = host.ram;
+        double available_ram = S4U_HostRegistry::getMemoryCapacity(host.host_id);
         if (requested_ram < 0) {
           throw std::invalid_argument(
                   "MultihostMulticoreComputeService::MultihostMulticoreComputeService(): requested ram should be non-negative");
@@ -326,17 +326,14 @@ namespace wrench {
                   std::to_string(requested_ram) + " are requested");
         }
 
-        this->compute_resources.insert(std::make_tuple(hname, requested_cores, requested_ram));
+        this->compute_resources.add(host.host_id, requested_cores, requested_ram);
       }
 
       // Compute the total number of cores and set initial core (and ram) availabilities
-      this->total_num_cores = 0;
-      for (auto host : this->compute_resources) {
-        this->total_num_cores += std::get<1>(host);
-        this->core_and_ram_availabilities.insert(std::make_pair(std::get<0>(host), std::make_pair(std::get<1>(host),
-                                                                                                  S4U_Simulation::getHostMemoryCapacity(
-                                                                                                          std::get<0>(
-                                                                                                                  host)))));
+      this->total_num_cores = this->compute_resources.getTotalNumCores();
+      for (auto const &host : this->compute_resources) {
+        this->core_and_ram_availabilities.insert(std::make_pair(host.host_id, std::make_pair(
+                host.num_cores, S4U_HostRegistry::getMemoryCapacity(host.host_id))));
       }
 
       this->ttl = ttl;
@@ -426,7 +423,7 @@ namespace wrench {
  * @param job: the job
  * @return the resource allocation
  */
-    std::set<std::tuple<std::string, unsigned long, double>>
+    ResourceAllocation
     MultihostMulticoreComputeService::computeResourceAllocation(StandardJob *job) {
 
       std::string resource_allocation_policy =
@@ -446,21 +443,40 @@ namespace wrench {
  * @param job: the job
  * @return the resource allocation
  */
-    std::set<std::tuple<std::string, unsigned long, double>>
+    ResourceAllocation
     MultihostMulticoreComputeService::computeResourceAllocationAggressive(StandardJob *job) {
 
       WRENCH_INFO("COMPUTING RESOURCE ALLOCATION: %ld", this->core_and_ram_availabilities.size());
       // Make a copy of core_and_ram_availabilities
-      std::map<std::string, std::pair<unsigned long, double>> tentative_core_and_ram_availabilities;
-      for (auto r : this->core_and_ram_availabilities) {
-        tentative_core_and_ram_availabilities.insert(
-                std::make_pair(r.first, std::make_pair(std::get<0>(r.second), std::get<1>(r.second))));
-      }
+      std::map<unsigned long, std::pair<unsigned long, double>> tentative_core_and_ram_availabilities =
+              this->core_and_ram_availabilities;
 
       // Make a copy of the tasks
-      std::set<WorkflowTask *> tasks;
-      for (auto t : job->getTasks()) {
-        tasks.insert(t);
+      const std::vector<WorkflowTask *> &job_tasks = job->getTasks();
+      std::set<WorkflowTask *> tasks(job_tasks.begin(), job_tasks.end());
+
+      std::string core_allocation_algorithm = this->getPropertyValueAsString(
+              MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_CORE_ALLOCATION_ALGORITHM);
+      bool use_maximum_num_cores = (core_allocation_algorithm == "maximum");
+
+      // With the "moldable" algorithm, the numbers of cores of the tasks that can start right away
+      // (i.e., whose parents have completed) are picked together
+      std::map<WorkflowTask *, unsigned long> moldable_num_cores;
+      if (core_allocation_algorithm == "moldable") {
+        std::vector<WorkflowTask *> ready_tasks;
+        for (auto const &t : job_tasks) {
+          std::vector<WorkflowTask *> parents = t->getWorkflow()->getTaskParents(t);
+          if (std::all_of(parents.begin(), parents.end(), [](WorkflowTask *parent) {
+              return parent->getState() == WorkflowTask::State::COMPLETED;
+          })) {
+            ready_tasks.push_back(t);
+          }
+        }
+        std::vector<unsigned long> host_num_cores;
+        for (auto const &r : tentative_core_and_ram_availabilities) {
+          host_num_cores.push_back(std::get<0>(r.second));
+        }
+        moldable_num_cores = MoldableCoreAllocator::allocate(ready_tasks, host_num_cores);
       }
 
       // Find the task that can use the most cores somewhere, update availabilities, repeat
@@ -469,20 +485,20 @@ namespace wrench {
         keep_going = false;
 
         WorkflowTask *picked_task = nullptr;
-        std::string picked_picked_host;
+        unsigned long picked_picked_host = S4U_HostRegistry::NO_HOST;
         unsigned long picked_picked_num_cores = 0;
         double picked_picked_ram = 0.0;
 
         for (auto t : tasks) {
 //          WRENCH_INFO("LOOKING AT TASK %s", t->getId().c_str());
-          std::string picked_host;
+          unsigned long picked_host = S4U_HostRegistry::NO_HOST;
           unsigned long picked_num_cores = 0;
           double picked_ram = 0.0;
 
 //          WRENCH_INFO("---> %ld", tentative_availabilities.size());
-          for (auto r : tentative_core_and_ram_availabilities) {
-//            WRENCH_INFO("   LOOKING AT HOST %s", r.first.c_str());
-            std::string hostname = r.first;
+          for (auto const &r : tentative_core_and_ram_availabilities) {
+//            WRENCH_INFO("   LOOKING AT HOST %s", S4U_HostRegistry::getHostname(r.first).c_str());
+            unsigned long host_id = r.first;
             unsigned long num_available_cores = std::get<0>(r.second);
             double available_ram = std::get<1>(r.second);
 
@@ -492,15 +508,16 @@ namespace wrench {
             }
 
             unsigned long desired_num_cores;
-            if (this->getPropertyValueAsString(
-                    MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_CORE_ALLOCATION_ALGORITHM) == "maximum") {
+            if (use_maximum_num_cores) {
               desired_num_cores = t->getMaxNumCores();
+            } else if (moldable_num_cores.find(t) != moldable_num_cores.end()) {
+              desired_num_cores = moldable_num_cores[t];
             } else {
               desired_num_cores = t->getMinNumCores();
             }
 
             if ((picked_num_cores == 0) || (picked_num_cores < MIN(num_available_cores, desired_num_cores))) {
-              picked_host = hostname;
+              picked_host = host_id;
               picked_num_cores = MIN(num_available_cores, desired_num_cores);
               picked_ram = t->getMemoryRequirement();
             }
@@ -513,7 +530,7 @@ namespace wrench {
 
           if (picked_num_cores > picked_picked_num_cores) {
 //            WRENCH_INFO("PICKED TASK %s on HOST %s with %ld cores",
-//                        t->getId().c_str(), picked_host.c_str(), picked_num_cores);
+//                        t->getId().c_str(), S4U_HostRegistry::getHostname(picked_host).c_str(), picked_num_cores);
             picked_task = t;
             picked_picked_num_cores = picked_num_cores;
             picked_picked_ram = picked_ram;
@@ -534,18 +551,16 @@ namespace wrench {
 
 
       // Come up with allocation based on tentative availabilities!
-      std::set<std::tuple<std::string, unsigned long, double>> allocation;
-      for (auto r : tentative_core_and_ram_availabilities) {
-        std::string hostname = r.first;
+      ResourceAllocation allocation;
+      for (auto const &r : tentative_core_and_ram_availabilities) {
+        unsigned long host_id = r.first;
         unsigned long num_cores = std::get<0>(r.second);
         double ram = std::get<1>(r.second);
+        std::pair<unsigned long, double> const &availability = this->core_and_ram_availabilities[host_id];
 
-        if ((num_cores <= std::get<0>(this->core_and_ram_availabilities[hostname])) and
-            (ram <= std::get<1>(this->core_and_ram_availabilities[hostname]))) {
-//          WRENCH_INFO("ALLOCATION %s/%ld-%.2lf", hostname.c_str(), std::get<0>(this->core_and_ram_availabilities[hostname]) - num_cores, std::get<1>(this->core_and_ram_availabilities[hostname]) - ram);
-          allocation.insert(
-                  std::make_tuple(hostname, std::get<0>(this->core_and_ram_availabilities[hostname]) - num_cores,
-                                  std::get<1>(this->core_and_ram_availabilities[hostname]) - ram));
+        if ((num_cores <= std::get<0>(availability)) and (ram <= std::get<1>(availability))) {
+//          WRENCH_INFO("ALLOCATION %s/%ld-%.2lf", S4U_HostRegistry::getHostname(host_id).c_str(), std::get<0>(availability) - num_cores, std::get<1>(availability) - ram);
+          allocation.add(host_id, std::get<0>(availability) - num_cores, std::get<1>(availability) - ram);
         }
       }
 
@@ -573,9 +588,9 @@ namespace wrench {
       }
 
       // Find the list of hosts with the required number of cores AND the required RAM
-      std::set<std::string> possible_hosts;
+      std::set<unsigned long> possible_hosts;
       for (auto it = this->core_and_ram_availabilities.begin(); it != this->core_and_ram_availabilities.end(); it++) {
-//        WRENCH_INFO("%s: %ld %.2lf", it->first.c_str(), std::get<0>(it->second), std::get<1>(it->second));
+//        WRENCH_INFO("%s: %ld %.2lf", S4U_HostRegistry::getHostname(it->first).c_str(), std::get<0>(it->second), std::get<1>(it->second));
         if ((std::get<0>(it->second) >= max_min_required_num_cores) and
             (std::get<1>(it->second) >= max_min_required_ram)) {
           possible_hosts.insert(it->first);
@@ -605,23 +620,19 @@ namespace wrench {
 //      WRENCH_INFO("MAXIMUM NUMBER OF CORES = %ld", maximum_num_cores);
 
       // Allocate resources for the job based on resource allocation strategies
-      std::set<std::tuple<std::string, unsigned long, double>> compute_resources;
-      compute_resources = computeResourceAllocation(job);
+      ResourceAllocation compute_resources = computeResourceAllocation(job);
 
-      // Update core availabilities (and compute total number of cores for printing)
-      unsigned long total_cores = 0;
-      double total_ram = 0.0;
-      for (auto r : compute_resources) {
-        std::get<0>(this->core_and_ram_availabilities[std::get<0>(r)]) -= std::get<1>(r);
-        std::get<1>(this->core_and_ram_availabilities[std::get<0>(r)]) -= std::get<2>(r);
-        total_cores += std::get<1>(r);
-        total_ram += std::get<2>(r);
+      // Update core availabilities
+      for (auto const &r : compute_resources) {
+        std::get<0>(this->core_and_ram_availabilities[r.host_id]) -= r.num_cores;
+        std::get<1>(this->core_and_ram_availabilities[r.host_id]) -= r.ram;
+        this->recordResourceAllocation(r.getHostname(), r.num_cores, r.ram);
       }
 
 
       WRENCH_INFO(
               "Creating a StandardJobExecutor on %ld hosts (total of %ld cores and %.2lf bytes of RAM) for a standard job",
-              compute_resources.size(), total_cores, total_ram);
+              compute_resources.size(), compute_resources.getTotalNumCores(), compute_resources.getTotalRam());
       // Create and start a standard job executor
       std::shared_ptr<StandardJobExecutor> executor = std::shared_ptr<StandardJobExecutor>(new StandardJobExecutor(
               this->simulation,
@@ -632,15 +643,39 @@ namespace wrench {
               this->default_storage_service,
               {{StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD,   this->getPropertyValueAsString(
                       MultihostMulticoreComputeServiceProperty::THREAD_STARTUP_OVERHEAD)},
+               {StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE,  this->getPropertyValueAsString(
+                       MultihostMulticoreComputeServiceProperty::MULTICORE_EXECUTION_MODE)},
+               {StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE,    this->getPropertyValueAsString(
+                       MultihostMulticoreComputeServiceProperty::WORKUNIT_EXECUTOR_MODE)},
+               {StandardJobExecutorProperty::FILE_OPERATION_MODE,       this->getPropertyValueAsString(
+                       MultihostMulticoreComputeServiceProperty::FILE_OPERATION_MODE)},
+               {StandardJobExecutorProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS, this->getPropertyValueAsString(
+                       MultihostMulticoreComputeServiceProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS)},
                {StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM, this->getPropertyValueAsString(
                        MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_CORE_ALLOCATION_ALGORITHM)},
                {StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM,  this->getPropertyValueAsString(
                        MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_TASK_SELECTION_ALGORITHM)},
                {StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM,  this->getPropertyValueAsString(
-                       MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_HOST_SELECTION_ALGORITHM)}}));
-
+                       MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_HOST_SELECTION_ALGORITHM)},
+               {StandardJobExecutorProperty::HOST_SELECTION_LOOK_AHEAD, this->getPropertyValueAsString(
+                       MultihostMulticoreComputeServiceProperty::TASK_SCHEDULING_HOST_SELECTION_LOOK_AHEAD)}}));
+
+      // Share a pool of workunit executors among all jobs, if need be
+      if (this->getPropertyValueAsString(MultihostMulticoreComputeServiceProperty::WORKUNIT_EXECUTOR_MODE) ==
+          "pooled") {
+        if (this->workunit_executor_pool == nullptr) {
+          this->workunit_executor_pool = std::make_shared<WorkunitExecutorPool>(
+                  this->simulation,
+                  this->getPropertyValueAsDouble(MultihostMulticoreComputeServiceProperty::THREAD_STARTUP_OVERHEAD),
+                  this->getPropertyValueAsString(MultihostMulticoreComputeServiceProperty::MULTICORE_EXECUTION_MODE) ==
+                  "single_actor");
+        }
+        executor->setWorkunitExecutorPool(this->workunit_executor_pool);
+      }
 
       executor->start(executor, true);
+      job->setStartDate(S4U_Simulation::getClock());
+      this->simulation->output.addTimestamp<SimulationTimestampJobStart>(job->getName(), this);
 
       this->standard_job_executors.insert(executor);
       this->running_jobs.insert(job);
@@ -659,7 +694,7 @@ namespace wrench {
     bool MultihostMulticoreComputeService::dispatchPilotJob(PilotJob *job) {
 
       // Find a list of hosts with the required number of cores and ram
-      std::vector<std::string> chosen_hosts;
+      std::vector<unsigned long> chosen_hosts;
       for (auto &core_availability : this->core_and_ram_availabilities) {
         if ((std::get<0>(core_availability.second) >= job->getNumCoresPerHost()) and
             (std::get<1>(core_availability.second) >= job->getMemoryPerHost())) {
@@ -682,12 +717,13 @@ namespace wrench {
       for (auto const &h : chosen_hosts) {
         std::get<0>(this->core_and_ram_availabilities[h]) -= job->getNumCoresPerHost();
         std::get<1>(this->core_and_ram_availabilities[h]) -= job->getMemoryPerHost();
+        this->recordResourceAllocation(S4U_HostRegistry::getHostname(h), job->getNumCoresPerHost(), job->getMemoryPerHost());
       }
 
       // Creates a compute service (that does not support pilot jobs!!)
-      std::set<std::tuple<std::string, unsigned long, double>> compute_resources;
+      ResourceAllocation compute_resources;
       for (auto const &h : chosen_hosts) {
-        compute_resources.insert(std::make_tuple(h, job->getNumCoresPerHost(), job->getMemoryPerHost()));
+        compute_resources.add(h, job->getNumCoresPerHost(), job->getMemoryPerHost());
       }
 
       std::shared_ptr<ComputeService> cs = std::shared_ptr<ComputeService>(new MultihostMulticoreComputeService(this->hostname,
@@ -767,18 +803,19 @@ namespace wrench {
         try {
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getPropertyValueAsDouble(
-                                          MultihostMulticoreComputeServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                                          MultihostMulticoreComputeServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)),
+                                  msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
         }
         return false;
 
       } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-        processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+        processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-        processSubmitPilotJob(msg->answer_mailbox, msg->job);
+        processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
@@ -786,15 +823,15 @@ namespace wrench {
         return true;
 
       } else if (auto *msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-        processGetResourceInformation(msg->answer_mailbox);
+        processGetResourceInformation(msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto *msg = dynamic_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get())) {
-        processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
+        processStandardJobTerminationRequest(msg->job, msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto *msg = dynamic_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get())) {
-        processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
+        processPilotJobTerminationRequest(msg->job, msg->answer_mailbox, msg->correlation_id);
         return true;
 
       } else if (auto msg = dynamic_cast<StandardJobExecutorDoneMessage *>(message.get())) {
@@ -962,10 +999,12 @@ namespace wrench {
 
       // Update the number of available cores
       for (auto const &r : compute_service->compute_resources) {
-        std::string hostname = std::get<0>(r);
-        unsigned long num_cores = std::get<1>(r);
+        unsigned long num_cores = r.num_cores;
+        double ram = r.ram;
 
-        std::get<0>(this->core_and_ram_availabilities[hostname]) -= num_cores;
+        std::get<0>(this->core_and_ram_availabilities[r.host_id]) += num_cores;
+        std::get<1>(this->core_and_ram_availabilities[r.host_id]) += ram;
+        this->recordResourceRelease(r.getHostname(), num_cores, ram);
       }
     }
 
@@ -1003,13 +1042,12 @@ namespace wrench {
     MultihostMulticoreComputeService::processStandardJobCompletion(StandardJobExecutor *executor, StandardJob *job) {
 
       // Update core and ram availabilities
-      for (auto r : executor->getComputeResources()) {
-        std::string hostname = std::get<0>(r);
-        unsigned long num_cores = std::get<1>(r);
-        double ram = std::get<2>(r);
-        std::get<0>(this->core_and_ram_availabilities[hostname]) += num_cores;
-        std::get<1>(this->core_and_ram_availabilities[hostname]) += ram;
-
+      for (auto const &r : executor->getComputeResources()) {
+        unsigned long num_cores = r.num_cores;
+        double ram = r.ram;
+        std::get<0>(this->core_and_ram_availabilities[r.host_id]) += num_cores;
+        std::get<1>(this->core_and_ram_availabilities[r.host_id]) += ram;
+        this->recordResourceRelease(r.getHostname(), num_cores, ram);
       }
 
       // Remove the executor from the executor list
@@ -1062,13 +1100,12 @@ namespace wrench {
                                                                      std::shared_ptr<FailureCause> cause) {
 
       // Update core and ram availabilities
-      for (auto r : executor->getComputeResources()) {
-        std::string hostname = std::get<0>(r);
-        unsigned long num_cores = std::get<1>(r);
-        double ram = std::get<2>(r);
-        std::get<0>(this->core_and_ram_availabilities[hostname]) += num_cores;
-        std::get<1>(this->core_and_ram_availabilities[hostname]) += ram;
-
+      for (auto const &r : executor->getComputeResources()) {
+        unsigned long num_cores = r.num_cores;
+        double ram = r.ram;
+        std::get<0>(this->core_and_ram_availabilities[r.host_id]) += num_cores;
+        std::get<1>(this->core_and_ram_availabilities[r.host_id]) += ram;
+        this->recordResourceRelease(r.getHostname(), num_cores, ram);
       }
 
 
@@ -1118,6 +1155,11 @@ namespace wrench {
       WRENCH_INFO("Terminate all pilot jobs");
       this->terminateAllPilotJobs();
 
+      // Kill the idle pooled workunit executors, if any
+      if (this->workunit_executor_pool) {
+        this->workunit_executor_pool->killIdleExecutors();
+      }
+
       // Am I myself a pilot job?
       if (notify_pilot_job_submitters && this->containing_pilot_job) {
 
@@ -1150,12 +1192,12 @@ namespace wrench {
 
       // Update core and ram availabilities
       for (auto const &r : cs->compute_resources) {
-        std::string hostname = std::get<0>(r);
         unsigned long num_cores = job->getNumCoresPerHost();
         double ram = job->getMemoryPerHost();
 
-        std::get<0>(this->core_and_ram_availabilities[hostname]) += num_cores;
-        std::get<1>(this->core_and_ram_availabilities[hostname]) += ram;
+        std::get<0>(this->core_and_ram_availabilities[r.host_id]) += num_cores;
+        std::get<1>(this->core_and_ram_availabilities[r.host_id]) += ram;
+        this->recordResourceRelease(r.getHostname(), num_cores, ram);
       }
 
       // Forward the notification
@@ -1182,14 +1224,15 @@ namespace wrench {
         throw WorkflowExecutionException(new ServiceIsDown(this));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_standard_job");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       //  send a "terminate a standard job" message to the daemon's mailbox_name
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new ComputeServiceTerminateStandardJobRequestMessage(
                                         answer_mailbox, job, this->getPropertyValueAsDouble(
-                                                MultihostMulticoreComputeServiceProperty::TERMINATE_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                                MultihostMulticoreComputeServiceProperty::TERMINATE_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -1197,7 +1240,7 @@ namespace wrench {
       // Get the answer
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -1228,14 +1271,15 @@ namespace wrench {
         throw WorkflowExecutionException(new ServiceIsDown(this));
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_pilot_job");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       // Send a "terminate a pilot job" message to the daemon's mailbox_name
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new ComputeServiceTerminatePilotJobRequestMessage(
                                         answer_mailbox, job, this->getPropertyValueAsDouble(
-                                                MultihostMulticoreComputeServiceProperty::TERMINATE_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
+                                                MultihostMulticoreComputeServiceProperty::TERMINATE_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -1244,7 +1288,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -1267,9 +1311,11 @@ namespace wrench {
  *
  * @param job: the job to terminate
  * @param answer_mailbox: the mailbox to which the answer message should be sent
+ * @param correlation_id: the id of the request/reply exchange
  */
     void MultihostMulticoreComputeService::processStandardJobTerminationRequest(StandardJob *job,
-                                                                                std::string answer_mailbox) {
+                                                                                std::string answer_mailbox,
+                                                                                unsigned long correlation_id) {
 
       // Check whether job is pending
       for (auto it = this->pending_jobs.begin(); it < this->pending_jobs.end(); it++) {
@@ -1280,7 +1326,7 @@ namespace wrench {
                   this->getPropertyValueAsDouble(
                           MultihostMulticoreComputeServiceProperty::TERMINATE_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD));
           try {
-            S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+            S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return;
           }
@@ -1300,7 +1346,7 @@ namespace wrench {
                 this->getPropertyValueAsDouble(
                         MultihostMulticoreComputeServiceProperty::TERMINATE_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD));
         try {
-          S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+          S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1314,7 +1360,7 @@ namespace wrench {
               this->getPropertyValueAsDouble(
                       MultihostMulticoreComputeServiceProperty::TERMINATE_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD));
       try {
-        S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+        S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -1325,9 +1371,10 @@ namespace wrench {
  *
  * @param job: the job to terminate
  * @param answer_mailbox: the mailbox to which the answer message should be sent
+ * @param correlation_id: the id of the request/reply exchange
  */
     void
-    MultihostMulticoreComputeService::processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox) {
+    MultihostMulticoreComputeService::processPilotJobTerminationRequest(PilotJob *job, std::string answer_mailbox, unsigned long correlation_id) {
 
       // Check whether job is pending
       for (auto it = this->pending_jobs.begin(); it < this->pending_jobs.end(); it++) {
@@ -1338,7 +1385,7 @@ namespace wrench {
                   this->getPropertyValueAsDouble(
                           MultihostMulticoreComputeServiceProperty::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD));
           try {
-            S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+            S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return;
           }
@@ -1355,7 +1402,7 @@ namespace wrench {
                 this->getPropertyValueAsDouble(
                         MultihostMulticoreComputeServiceProperty::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD));
         try {
-          S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+          S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1369,7 +1416,7 @@ namespace wrench {
               this->getPropertyValueAsDouble(
                       MultihostMulticoreComputeServiceProperty::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD));
       try {
-        S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+        S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -1421,12 +1468,14 @@ namespace wrench {
  * @param answer_mailbox: the mailbox to which the answer message should be sent
  * @param job: the job
  * @param service_specific_args: service specific arguments
+ * @param correlation_id: the id of the request/reply exchange
  *
  * @throw std::runtime_error
  */
     void MultihostMulticoreComputeService::processSubmitStandardJob(
             const std::string &answer_mailbox, StandardJob *job,
-            std::map<std::string, std::string> &service_specific_arguments) {
+            std::map<std::string, std::string> &service_specific_arguments,
+            unsigned long correlation_id) {
       WRENCH_INFO("Asked to run a standard job with %ld tasks", job->getNumTasks());
 
       // Do we support standard jobs?
@@ -1437,7 +1486,8 @@ namespace wrench {
                   new ComputeServiceSubmitStandardJobAnswerMessage(
                           job, this, false, std::shared_ptr<FailureCause>(new JobTypeNotSupported(job, this)),
                           this->getPropertyValueAsDouble(
-                                  ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                  ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1452,10 +1502,8 @@ namespace wrench {
         unsigned long required_num_cores = t->getMinNumCores();
         double required_ram = t->getMemoryRequirement();
 
-        for (auto r : this->compute_resources) {
-          unsigned long num_cores = std::get<1>(r);
-          double ram = std::get<2>(r);
-          if ((num_cores >= required_num_cores) and (ram >= required_ram)) {
+        for (auto const &r : this->compute_resources) {
+          if ((r.num_cores >= required_num_cores) and (r.ram >= required_ram)) {
             enough_resources = true;
           }
         }
@@ -1468,7 +1516,8 @@ namespace wrench {
                   new ComputeServiceSubmitStandardJobAnswerMessage(
                           job, this, false, std::shared_ptr<FailureCause>(new NotEnoughComputeResources(job, this)),
                           this->getPropertyValueAsDouble(
-                                  MultihostMulticoreComputeServiceProperty::NOT_ENOUGH_CORES_MESSAGE_PAYLOAD)));
+                                  MultihostMulticoreComputeServiceProperty::NOT_ENOUGH_CORES_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1484,7 +1533,8 @@ namespace wrench {
                 answer_mailbox,
                 new ComputeServiceSubmitStandardJobAnswerMessage(
                         job, this, true, nullptr, this->getPropertyValueAsDouble(
-                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                ComputeServiceProperty::SUBMIT_STANDARD_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -1495,10 +1545,11 @@ namespace wrench {
  *
  * @param answer_mailbox: the mailbox to which the answer message should be sent
  * @param job: the job
+ * @param correlation_id: the id of the request/reply exchange
  *
  * @throw std::runtime_error
  */
-    void MultihostMulticoreComputeService::processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job) {
+    void MultihostMulticoreComputeService::processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job, unsigned long correlation_id) {
       WRENCH_INFO("Asked to run a pilot job with %ld hosts and %ld cores per host for %lf seconds",
                   job->getNumHosts(), job->getNumCoresPerHost(), job->getDuration());
 
@@ -1508,7 +1559,8 @@ namespace wrench {
                   answer_mailbox, new ComputeServiceSubmitPilotJobAnswerMessage(
                           job, this, false, std::shared_ptr<FailureCause>(new JobTypeNotSupported(job, this)),
                           this->getPropertyValueAsDouble(
-                                  MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                  MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1518,7 +1570,7 @@ namespace wrench {
       // count the number of hosts that have enough cores
       unsigned long num_possible_hosts = 0;
       for (const auto &compute_resource : this->compute_resources) {
-        if (std::get<1>(compute_resource) >= job->getNumCoresPerHost()) {
+        if (compute_resource.num_cores >= job->getNumCoresPerHost()) {
           num_possible_hosts++;
         }
       }
@@ -1530,7 +1582,8 @@ namespace wrench {
                   answer_mailbox, new ComputeServiceSubmitPilotJobAnswerMessage(
                           job, this, false, std::shared_ptr<FailureCause>(new NotEnoughComputeResources(job, this)),
                           this->getPropertyValueAsDouble(
-                                  MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                  MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return;
         }
@@ -1544,7 +1597,8 @@ namespace wrench {
                 answer_mailbox, new ComputeServiceSubmitPilotJobAnswerMessage(
                         job, this, true, nullptr,
                         this->getPropertyValueAsDouble(
-                                MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)));
+                                MultihostMulticoreComputeServiceProperty::SUBMIT_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD)),
+                correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
@@ -1553,8 +1607,9 @@ namespace wrench {
 /**
  * @brief Process a "get resource description message"
  * @param answer_mailbox: the mailbox to which the description message should be sent
+ * @param correlation_id: the id of the request/reply exchange
  */
-    void MultihostMulticoreComputeService::processGetResourceInformation(const std::string &answer_mailbox) {
+    void MultihostMulticoreComputeService::processGetResourceInformation(const std::string &answer_mailbox, unsigned long correlation_id) {
       // Build a dictionary
       std::map<std::string, std::vector<double>> dict;
 
@@ -1563,38 +1618,47 @@ namespace wrench {
       num_hosts.push_back((double)(this->compute_resources.size()));
       dict.insert(std::make_pair("num_hosts", num_hosts));
 
+      // All per-host lists are in hostname order
+      std::vector<unsigned long> host_ids;
+      for (auto const &r : this->compute_resources) {
+        host_ids.push_back(r.host_id);
+      }
+      std::sort(host_ids.begin(), host_ids.end(), [](unsigned long a, unsigned long b) {
+          return S4U_HostRegistry::getHostname(a) < S4U_HostRegistry::getHostname(b);
+      });
+
       // Num cores per hosts
       std::vector<double> num_cores;
-      for (auto r : this->compute_resources) {
-        num_cores.push_back((double) (std::get<1>(r)));
+      for (auto const &host_id : host_ids) {
+        num_cores.push_back((double) (this->compute_resources.find(host_id)->num_cores));
       }
       dict.insert(std::make_pair("num_cores", num_cores));
 
       // Num idle cores per hosts
       std::vector<double> num_idle_cores;
-      for (auto r : this->core_and_ram_availabilities) {
-        num_idle_cores.push_back(std::get<0>(r.second));
+      for (auto const &host_id : host_ids) {
+        num_idle_cores.push_back(std::get<0>(this->core_and_ram_availabilities[host_id]));
       }
       dict.insert(std::make_pair("num_idle_cores", num_idle_cores));
 
       // Flop rate per host
       std::vector<double> flop_rates;
-      for (auto h : this->compute_resources) {
-        flop_rates.push_back(S4U_Simulation::getFlopRate(std::get<0>(h)));
+      for (auto const &host_id : host_ids) {
+        flop_rates.push_back(S4U_HostRegistry::getFlopRate(host_id));
       }
       dict.insert(std::make_pair("flop_rates", flop_rates));
 
       // RAM capacity per host
       std::vector<double> ram_capacities;
-      for (auto h : this->compute_resources) {
-        ram_capacities.push_back(S4U_Simulation::getHostMemoryCapacity(std::get<0>(h)));
+      for (auto const &host_id : host_ids) {
+        ram_capacities.push_back(S4U_HostRegistry::getMemoryCapacity(host_id));
       }
       dict.insert(std::make_pair("ram_capacities", ram_capacities));
 
       // RAM availability per host
       std::vector<double> ram_availabilities;
-      for (auto r : this->core_and_ram_availabilities) {
-        ram_availabilities.push_back(std::get<1>(r.second));
+      for (auto const &host_id : host_ids) {
+        ram_availabilities.push_back(std::get<1>(this->core_and_ram_availabilities[host_id]));
       }
       dict.insert(std::make_pair("ram_availabilities", ram_availabilities));
 
@@ -1613,7 +1677,7 @@ namespace wrench {
               this->getPropertyValueAsDouble(
                       ComputeServiceProperty::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD));
       try {
-        S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
+        S4U_Mailbox::dputMessage(answer_mailbox, answer_message, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return;
       }
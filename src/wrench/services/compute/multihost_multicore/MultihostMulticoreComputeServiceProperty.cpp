@@ -16,6 +16,10 @@ namespace wrench {
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, FLOP_RATE_ANSWER_MESSAGE_PAYLOAD);
 
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, THREAD_STARTUP_OVERHEAD);
+    SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, MULTICORE_EXECUTION_MODE);
+    SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, WORKUNIT_EXECUTOR_MODE);
+    SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, FILE_OPERATION_MODE);
+    SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, MAX_NUM_CONCURRENT_FILE_OPERATIONS);
 
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, JOB_SELECTION_POLICY);
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, RESOURCE_ALLOCATION_POLICY);
@@ -23,6 +27,7 @@ namespace wrench {
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, TASK_SCHEDULING_CORE_ALLOCATION_ALGORITHM);
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, TASK_SCHEDULING_TASK_SELECTION_ALGORITHM);
     SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, TASK_SCHEDULING_HOST_SELECTION_ALGORITHM);
+    SET_PROPERTY_NAME(MultihostMulticoreComputeServiceProperty, TASK_SCHEDULING_HOST_SELECTION_LOOK_AHEAD);
 
 
 };
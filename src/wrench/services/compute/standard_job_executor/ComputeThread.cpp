@@ -30,12 +30,15 @@ namespace wrench {
      * @param hostname: the host on which the compute thread should run
      * @param flops: the number of flops to perform
      * @param reply_mailbox: the mailbox to which the "done/failed" message should be sent
+     * @param correlation_id: the id with which the "done/failed" message should be sent
      */
-    ComputeThread::ComputeThread(Simulation *simulation, std::string hostname, double flops, std::string reply_mailbox) :
+    ComputeThread::ComputeThread(Simulation *simulation, std::string hostname, double flops, std::string reply_mailbox,
+                                 unsigned long correlation_id) :
             Service(hostname, "compute_thread", "compute_thread") {
       this->simulation = simulation;
       this->flops = flops;
       this->reply_mailbox = reply_mailbox;
+      this->correlation_id = correlation_id;
     }
 
     int ComputeThread::main() {
@@ -48,7 +51,7 @@ namespace wrench {
       }
       #ifndef S4U_KILL_JOIN_WORKS
       try {
-        S4U_Mailbox::putMessage(this->reply_mailbox, new ComputeThreadDoneMessage());
+        S4U_Mailbox::putMessage(this->reply_mailbox, new ComputeThreadDoneMessage(), this->correlation_id);
       } catch (std::shared_ptr<NetworkError> &e) {
         WRENCH_INFO("Couldn't report on my completion to my parent");
       } catch (std::shared_ptr<FatalFailure> &e) {
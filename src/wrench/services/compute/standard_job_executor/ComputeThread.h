@@ -34,7 +34,8 @@ namespace wrench {
 
         ~ComputeThread();
 
-        ComputeThread(Simulation *simulation, std::string hostname, double flops, std::string reply_mailbox);
+        ComputeThread(Simulation *simulation, std::string hostname, double flops, std::string reply_mailbox,
+                      unsigned long correlation_id);
 
         int main();
 
@@ -45,6 +46,7 @@ namespace wrench {
     private:
         double flops;
         std::string reply_mailbox;
+        unsigned long correlation_id;
 
     };
 
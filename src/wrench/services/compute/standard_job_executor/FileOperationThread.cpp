@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include "FileOperationThread.h"
+#include "StandardJobExecutorMessage.h"
+
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(file_operation_thread, "Log category for FileOperationThread");
+
+namespace wrench {
+
+    FileOperationThread::~FileOperationThread() {
+    }
+
+    /**
+     * @brief Constructor
+     * @param simulation: a pointer to the simulation object
+     * @param hostname: the host on which the file operation thread should run
+     * @param operation: the file operation to perform
+     * @param file: the file
+     * @param storage_service: the storage service to write/copy the file to
+     * @param src_storage_service: the storage service to copy the file from (COPY only)
+     * @param reply_mailbox: the mailbox to which the "done" message should be sent
+     * @param correlation_id: the id with which the "done" message should be sent
+     */
+    FileOperationThread::FileOperationThread(Simulation *simulation, std::string hostname, Operation operation,
+                                             WorkflowFile *file, StorageService *storage_service,
+                                             StorageService *src_storage_service, std::string reply_mailbox,
+                                             unsigned long correlation_id) :
+            Service(hostname, "file_operation_thread", "file_operation_thread") {
+      this->simulation = simulation;
+      this->operation = operation;
+      this->file = file;
+      this->storage_service = storage_service;
+      this->src_storage_service = src_storage_service;
+      this->reply_mailbox = reply_mailbox;
+      this->correlation_id = correlation_id;
+    }
+
+    int FileOperationThread::main() {
+      std::shared_ptr<FailureCause> failure_cause = nullptr;
+      try {
+        switch (this->operation) {
+          case WRITE:
+            WRENCH_INFO("Writing file %s to storage service %s",
+                        this->file->getId().c_str(), this->storage_service->getName().c_str());
+            this->storage_service->writeFile(this->file);
+            break;
+          case COPY:
+            WRENCH_INFO("Copying file %s from %s to %s", this->file->getId().c_str(),
+                        this->src_storage_service->getName().c_str(), this->storage_service->getName().c_str());
+            this->storage_service->copyFile(this->file, this->src_storage_service);
+            break;
+        }
+      } catch (WorkflowExecutionException &e) {
+        failure_cause = e.getCause();
+      } catch (std::exception &e) {
+        WRENCH_INFO("Probably got killed while I was performing a file operation");
+        return 0;
+      }
+
+      try {
+        S4U_Mailbox::putMessage(this->reply_mailbox, new FileOperationThreadDoneMessage(failure_cause),
+                                this->correlation_id);
+      } catch (std::shared_ptr<NetworkError> &e) {
+        WRENCH_INFO("Couldn't report on my completion to my parent");
+      } catch (std::shared_ptr<FatalFailure> &e) {
+        WRENCH_INFO("Couldn't report on my completion to my parent");
+      }
+
+      return 0;
+    }
+
+    /**
+     * @brief Kill the file operation thread
+     */
+    void FileOperationThread::kill() {
+      try {
+        this->killActor();
+      } catch (std::shared_ptr<FatalFailure> &e) {
+        WRENCH_INFO("Failed to kill a file operation thread.. .perhaps it's already dead... nevermind");
+      }
+    }
+
+};
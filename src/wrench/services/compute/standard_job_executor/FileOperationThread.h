@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+
+#ifndef WRENCH_FILEOPERATIONTHREAD_H
+#define WRENCH_FILEOPERATIONTHREAD_H
+
+#include "wrench/services/Service.h"
+
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    class Simulation;
+    class StorageService;
+    class WorkflowFile;
+
+    /**
+     * @brief A file operation thread, which performs one file write or copy on behalf
+     *        of a workunit executor so that several such operations can overlap (file reads
+     *        overlap within the workunit executor, see StorageService::readFiles())
+     */
+    class FileOperationThread : public Service {
+
+    public:
+
+        /** @brief File operation types */
+        enum Operation {
+            /** @brief Write the file to the storage service */
+            WRITE,
+            /** @brief Copy the file from the source storage service to the storage service */
+            COPY
+        };
+
+        ~FileOperationThread();
+
+        FileOperationThread(Simulation *simulation, std::string hostname, Operation operation,
+                            WorkflowFile *file, StorageService *storage_service,
+                            StorageService *src_storage_service, std::string reply_mailbox,
+                            unsigned long correlation_id);
+
+        int main();
+
+        void kill();
+
+    private:
+        Operation operation;
+        WorkflowFile *file;
+        StorageService *storage_service;
+        StorageService *src_storage_service;
+        std::string reply_mailbox;
+        unsigned long correlation_id;
+
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+};
+
+#endif //WRENCH_FILEOPERATIONTHREAD_H
@@ -0,0 +1,330 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+#include "wrench/services/compute/standard_job_executor/ReadyWorkunitQueue.h"
+#include "wrench/services/compute/standard_job_executor/Workunit.h"
+#include "wrench/workflow/WorkflowTask.h"
+
+namespace wrench {
+
+    /**
+     * @brief Get the selection policy corresponding to a value of the
+     *        StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM property
+     *
+     * @param selection_algorithm: "maximum_flops" or "maximum_minimum_cores"
+     * @return a selection policy
+     *
+     * @throw std::invalid_argument
+     */
+    ReadyWorkunitQueue::SelectionPolicy ReadyWorkunitQueue::getSelectionPolicy(const std::string &selection_algorithm) {
+      if (selection_algorithm == "maximum_flops") {
+        return MAXIMUM_FLOPS;
+      } else if (selection_algorithm == "maximum_minimum_cores") {
+        return MAXIMUM_MINIMUM_CORES;
+      } else {
+        throw std::invalid_argument("Unknown StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM property '"
+                                    + selection_algorithm + "'");
+      }
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param policy: the selection policy
+     */
+    ReadyWorkunitQueue::ReadyWorkunitQueue(SelectionPolicy policy) {
+      this->policy = policy;
+    }
+
+    /**
+     * @brief Add a workunit to the queue
+     *
+     * @param workunit: the workunit (whose priority is computed once, here)
+     */
+    void ReadyWorkunitQueue::push(std::unique_ptr<Workunit> workunit) {
+      // A workunit that is queued again keeps its original rank among equal-priority workunits
+      if (workunit->ready_queue_sequence_number == 0) {
+        workunit->ready_queue_sequence_number = this->next_sequence_number++;
+      }
+
+      Entry entry;
+      entry.computational = not workunit->tasks.empty();
+      entry.key = 0.0;
+      if (entry.computational) {
+        switch (this->policy) {
+          case MAXIMUM_FLOPS:
+            entry.key = workunit->tasks[0]->getFlops();
+            break;
+          case MAXIMUM_MINIMUM_CORES:
+            entry.key = (double) workunit->tasks[0]->getMinNumCores();
+            break;
+        }
+      }
+      entry.sequence_number = workunit->ready_queue_sequence_number;
+      entry.workunit = std::move(workunit);
+
+      this->insertEntry(std::move(entry));
+    }
+
+    /**
+     * @brief Get all queued workunits (blocked workunits included), without removing them from the queue
+     *
+     * @return the workunits, in order of priority
+     */
+    std::vector<Workunit *> ReadyWorkunitQueue::getWorkunits() const {
+      std::vector<const Entry *> entries;
+      for (auto const &entry : this->heap) {
+        entries.push_back(&entry);
+      }
+      for (auto const &b : this->blocked) {
+        entries.push_back(&(b.second));
+      }
+      std::sort(entries.begin(), entries.end(), [this](const Entry *e1, const Entry *e2) {
+          return this->isBefore(*e1, *e2);
+      });
+      std::vector<Workunit *> workunits;
+      for (auto const &entry : entries) {
+        workunits.push_back(entry->workunit.get());
+      }
+      return workunits;
+    }
+
+    /**
+     * @brief Visit the (non-blocked) workunits in order of priority, without removing them from the
+     *        queue, until the visitor returns false. Visiting the first k workunits takes O(k log k) time,
+     *        as only the heap entries whose parents have been visited are candidates for the next visit
+     *
+     * @param visitor: a function that is called on each workunit, and returns whether to go on
+     */
+    void ReadyWorkunitQueue::visitInOrder(const std::function<bool(Workunit *)> &visitor) const {
+      auto is_after = [this](unsigned long i, unsigned long j) {
+          return this->isBefore(this->heap[j], this->heap[i]);
+      };
+      std::priority_queue<unsigned long, std::vector<unsigned long>, decltype(is_after)> candidates(is_after);
+      if (not this->heap.empty()) {
+        candidates.push(0);
+      }
+      while (not candidates.empty()) {
+        unsigned long i = candidates.top();
+        candidates.pop();
+        if (not visitor(this->heap[i].workunit.get())) {
+          return;
+        }
+        for (unsigned long child = 2 * i + 1; (child <= 2 * i + 2) and (child < this->heap.size()); child++) {
+          candidates.push(child);
+        }
+      }
+    }
+
+    /**
+     * @brief Block a queued workunit, i.e., set it aside until unblock() finds that it fits
+     *        (blocked workunits are not returned by top() and pop())
+     *
+     * @param workunit: the workunit
+     * @param min_num_cores: the minimum number of cores the workunit needs
+     * @param ram: the RAM the workunit needs
+     *
+     * @throw std::invalid_argument
+     */
+    void ReadyWorkunitQueue::block(Workunit *workunit, unsigned long min_num_cores, double ram) {
+      unsigned long i = workunit->ready_queue_index;
+      if ((i >= this->heap.size()) or (this->heap[i].workunit.get() != workunit)) {
+        throw std::invalid_argument("ReadyWorkunitQueue::block(): the workunit is not in the queue, or is blocked");
+      }
+      this->blocked.insert(std::make_pair(std::make_pair(min_num_cores, ram), this->removeEntry(i)));
+    }
+
+    /**
+     * @brief Put back in the queue the blocked workunits that now fit
+     *
+     * @param fits: a function that, given a minimum number of cores and a RAM footprint, returns
+     *        whether some host could run a workunit with these requirements
+     */
+    void ReadyWorkunitQueue::unblock(const std::function<bool(unsigned long, double)> &fits) {
+      auto it = this->blocked.begin();
+      while (it != this->blocked.end()) {
+        unsigned long min_num_cores = it->first.first;
+        if (not fits(min_num_cores, it->first.second)) {
+          // Blocked workunits that need as many cores and more RAM don't fit either
+          it = this->blocked.lower_bound(
+                  std::make_pair(min_num_cores + 1, std::numeric_limits<double>::lowest()));
+          continue;
+        }
+        Entry entry = std::move(it->second);
+        it = this->blocked.erase(it);
+        this->insertEntry(std::move(entry));
+      }
+    }
+
+    /**
+     * @brief Get the highest priority (non-blocked) workunit, without removing it from the queue
+     *
+     * @return a workunit, or nullptr if there is no such workunit
+     */
+    Workunit *ReadyWorkunitQueue::top() {
+      if (this->heap.empty()) {
+        return nullptr;
+      }
+      return this->heap[0].workunit.get();
+    }
+
+    /**
+     * @brief Remove the highest priority (non-blocked) workunit from the queue
+     *
+     * @return the workunit
+     *
+     * @throw std::runtime_error
+     */
+    std::unique_ptr<Workunit> ReadyWorkunitQueue::pop() {
+      if (this->heap.empty()) {
+        throw std::runtime_error("ReadyWorkunitQueue::pop(): the queue is empty");
+      }
+      return this->removeEntry(0).workunit;
+    }
+
+    /**
+     * @brief Remove a workunit (blocked or not) from the queue
+     *
+     * @param workunit: the workunit
+     * @return the workunit
+     *
+     * @throw std::invalid_argument
+     */
+    std::unique_ptr<Workunit> ReadyWorkunitQueue::remove(Workunit *workunit) {
+      unsigned long i = workunit->ready_queue_index;
+      if ((i < this->heap.size()) and (this->heap[i].workunit.get() == workunit)) {
+        return this->removeEntry(i).workunit;
+      }
+      for (auto it = this->blocked.begin(); it != this->blocked.end(); ++it) {
+        if (it->second.workunit.get() == workunit) {
+          std::unique_ptr<Workunit> removed = std::move(it->second.workunit);
+          this->blocked.erase(it);
+          return removed;
+        }
+      }
+      throw std::invalid_argument("ReadyWorkunitQueue::remove(): the workunit is not in the queue");
+    }
+
+    /**
+     * @brief Remove (and destroy) all workunits
+     */
+    void ReadyWorkunitQueue::clear() {
+      this->heap.clear();
+      this->blocked.clear();
+    }
+
+    /**
+     * @brief Add an entry to the heap
+     *
+     * @param entry: the entry
+     */
+    void ReadyWorkunitQueue::insertEntry(Entry entry) {
+      entry.workunit->ready_queue_index = this->heap.size();
+      this->heap.push_back(std::move(entry));
+      this->siftUp(this->heap.size() - 1);
+    }
+
+    /**
+     * @brief Remove an entry from the heap
+     *
+     * @param i: the entry's index
+     * @return the entry
+     */
+    ReadyWorkunitQueue::Entry ReadyWorkunitQueue::removeEntry(unsigned long i) {
+      unsigned long last = this->heap.size() - 1;
+      if (i != last) {
+        this->swapEntries(i, last);
+      }
+      Entry removed = std::move(this->heap.back());
+      this->heap.pop_back();
+
+      if (i < this->heap.size()) {
+        this->siftUp(i);
+        this->siftDown(i);
+      }
+      return removed;
+    }
+
+    /**
+     * @brief Determine whether an entry has higher priority than another one
+     *
+     * @param e1: an entry
+     * @param e2: another entry
+     * @return true if e1 has higher priority
+     */
+    bool ReadyWorkunitQueue::isBefore(const Entry &e1, const Entry &e2) const {
+      // Non-computational workunits have higher priority
+      if (e1.computational != e2.computational) {
+        return not e1.computational;
+      }
+      if (e1.key != e2.key) {
+        return e1.key > e2.key;
+      }
+      return e1.sequence_number < e2.sequence_number;
+    }
+
+    /**
+     * @brief Swap two heap entries, updating the workunits' handles
+     *
+     * @param i: an index
+     * @param j: another index
+     */
+    void ReadyWorkunitQueue::swapEntries(unsigned long i, unsigned long j) {
+      std::swap(this->heap[i], this->heap[j]);
+      this->heap[i].workunit->ready_queue_index = i;
+      this->heap[j].workunit->ready_queue_index = j;
+    }
+
+    /**
+     * @brief Move an entry up the heap until it is in place
+     *
+     * @param i: the entry's index
+     */
+    void ReadyWorkunitQueue::siftUp(unsigned long i) {
+      while (i > 0) {
+        unsigned long parent = (i - 1) / 2;
+        if (not this->isBefore(this->heap[i], this->heap[parent])) {
+          break;
+        }
+        this->swapEntries(i, parent);
+        i = parent;
+      }
+    }
+
+    /**
+     * @brief Move an entry down the heap until it is in place
+     *
+     * @param i: the entry's index
+     */
+    void ReadyWorkunitQueue::siftDown(unsigned long i) {
+      unsigned long n = this->heap.size();
+      while (true) {
+        unsigned long first = i;
+        unsigned long left = 2 * i + 1;
+        unsigned long right = 2 * i + 2;
+        if ((left < n) and this->isBefore(this->heap[left], this->heap[first])) {
+          first = left;
+        }
+        if ((right < n) and this->isBefore(this->heap[right], this->heap[first])) {
+          first = right;
+        }
+        if (first == i) {
+          break;
+        }
+        this->swapEntries(i, first);
+        i = first;
+      }
+    }
+
+};
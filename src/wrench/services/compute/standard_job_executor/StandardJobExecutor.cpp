@@ -7,7 +7,9 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <cfloat>
+#include "wrench/services/compute/MoldableCoreAllocator.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
 #include "wrench/services/compute/standard_job_executor/WorkunitMulticoreExecutor.h"
 #include "wrench/services/compute/standard_job_executor/Workunit.h"
@@ -15,6 +17,7 @@
 #include "wrench/workflow/job/StandardJob.h"
 
 #include "wrench/logging/TerminalOutput.h"
+#include "wrench/simgrid_S4U_util/S4U_HostRegistry.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simulation/SimulationMessage.h"
 #include "wrench/services/storage/StorageService.h"
@@ -24,7 +27,6 @@
 #include "wrench/workflow/job/PilotJob.h"
 #include "StandardJobExecutorMessage.h"
 
-#include "wrench/util/PointerUtil.h"
 XBT_LOG_NEW_DEFAULT_CATEGORY(standard_job_executor, "Log category for Standard Job Executor");
 
 namespace wrench {
@@ -42,8 +44,8 @@ namespace wrench {
      * @param simulation: the simulation
      * @param hostname: the hostname of the host that should run this executor (could be the first compute resources - see below)
      * @param job: the job to execute
-     * @param compute_resources: a non-empty list of <hostname, num_cores, memory> tuples, which represent
-     *           the compute resources the job should execute on
+     * @param compute_resources: a non-empty allocation (or list of <hostname, num_cores, memory> tuples),
+     *           which represents the compute resources the job should execute on
      *              - If num_cores == ComputeService::ALL_CORES, then ALL the cores of the host are used
      *              - If memory == ComputeService::ALL_RAM, then ALL the ram of the host is used
      * @param default_storage_service: a storage service (or nullptr)
@@ -56,7 +58,7 @@ namespace wrench {
                                              std::string callback_mailbox,
                                              std::string hostname,
                                              StandardJob *job,
-                                             std::set<std::tuple<std::string, unsigned long, double>> compute_resources,
+                                             const ResourceAllocation &compute_resources,
                                              StorageService *default_storage_service,
                                              std::map<std::string, std::string> plist) :
             Service(hostname, "standard_job_executor", "standard_job_executor") {
@@ -65,62 +67,60 @@ namespace wrench {
         throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): invalid arguments");
       }
 
-      // Check that hosts exist!
-      for (auto h : compute_resources) {
-        if (not simulation->hostExists(std::get<0>(h))) {
-          throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): Host '" + std::get<0>(h) + "' does not exit!");
-        }
-      }
+      // (Hosts exist, since the allocation refers to them by host id)
 
       // Check that there is at least one core per host but not too many cores
-      for (auto host : compute_resources) {
-        if (std::get<1>(host) == 0) {
+      for (auto const &host : compute_resources) {
+        if (host.num_cores == 0) {
           throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): there should be at least one core per host");
         }
-        if (std::get<1>(host) < ComputeService::ALL_CORES) {
-          if (std::get<1>(host) > S4U_Simulation::getNumCores(std::get<0>(host))) {
-            throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): host " + std::get<0>(host) +
-                                                " has only " + std::to_string(S4U_Simulation::getNumCores(std::get<0>(host))) + " cores");
+        // (ALL_CORES is replaced by the host's number of cores below)
+        if (host.num_cores < ComputeService::ALL_CORES) {
+          unsigned int host_num_cores = S4U_HostRegistry::getNumCores(host.host_id);
+          if (host.num_cores > host_num_cores) {
+            throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): host " + host.getHostname() +
+                                                " has only " + std::to_string(host_num_cores) + " cores");
           }
-        } else {
-          // Set the num_cores to the maximum
-          std::get<1>(host) = S4U_Simulation::getNumCores(std::get<0>(host));
         }
       }
 
       // Check that there is at least zero byte of memory per host, but not too many bytes
-      for (auto host : compute_resources) {
-        if (std::get<2>(host) < 0) {
+      for (auto const &host : compute_resources) {
+        if (host.ram < 0) {
           throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): the number of bytes per host should be non-negative");
         }
-        if (std::get<2>(host) < ComputeService::ALL_RAM) {
-          double host_memory_capacity = S4U_Simulation::getHostMemoryCapacity(std::get<0>(host));
-          if (std::get<2>(host) > host_memory_capacity) {
-            throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): host " + std::get<0>(host) +
-                                                " has only " + std::to_string(
-                    S4U_Simulation::getHostMemoryCapacity(std::get<0>(host))) + " bytes of RAM");
+        // (ALL_RAM is replaced by the host's memory capacity below)
+        if (host.ram < ComputeService::ALL_RAM) {
+          double host_memory_capacity = S4U_HostRegistry::getMemoryCapacity(host.host_id);
+          if (host.ram > host_memory_capacity) {
+            throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): host " + host.getHostname() +
+                                                " has only " + std::to_string(host_memory_capacity) + " bytes of RAM");
           }
-        } else {
-          // Set the memory to the maximum
-          std::get<2>(host) = S4U_Simulation::getHostMemoryCapacity(std::get<0>(host));
         }
       }
 
+      // Resolve ALL_CORES and ALL_RAM into my compute resources record
+      for (auto const &host : compute_resources) {
+        unsigned long num_cores = host.num_cores;
+        if (num_cores == ComputeService::ALL_CORES) {
+          num_cores = S4U_HostRegistry::getNumCores(host.host_id);
+        }
+        double ram = host.ram;
+        if (ram == ComputeService::ALL_RAM) {
+          ram = S4U_HostRegistry::getMemoryCapacity(host.host_id);
+        }
+        this->compute_resources.add(host.host_id, num_cores, ram);
+      }
 
       // Check that there are enough cores to run the computational tasks
       unsigned long max_min_required_num_cores = 0;
-      for (auto task : job->tasks) {
+      for (auto const &task : job->tasks) {
         max_min_required_num_cores = (max_min_required_num_cores < task->getMinNumCores() ? task->getMinNumCores() : max_min_required_num_cores);
       }
 
       bool enough_cores = false;
-      for (auto host : compute_resources) {
-        unsigned long num_cores_on_hosts = std::get<1>(host);
-        if (num_cores_on_hosts == ComputeService::ALL_CORES) {
-          num_cores_on_hosts = S4U_Simulation::getNumCores(std::get<0>(host));
-        }
-
-        if (num_cores_on_hosts >= max_min_required_num_cores) {
+      for (auto const &host : this->compute_resources) {
+        if (host.num_cores >= max_min_required_num_cores) {
           enough_cores = true;
           break;
         }
@@ -133,14 +133,14 @@ namespace wrench {
 
       // Check that there is enough RAM to run the computational tasks
       double max_required_ram = 0.0;
-      for (auto task : job->tasks) {
+      for (auto const &task : job->tasks) {
         max_required_ram = (max_required_ram < task->getMemoryRequirement() ? task->getMemoryRequirement() : max_required_ram);
       }
 
 
       bool enough_ram = false;
-      for (auto host : compute_resources) {
-        if (std::get<2>(host) >= max_required_ram) {
+      for (auto const &host : compute_resources) {
+        if (host.ram >= max_required_ram) {
           enough_ram = true;
           break;
         }
@@ -161,40 +161,20 @@ namespace wrench {
       // set properties
       this->setProperties(this->default_property_values, plist);
 
-      // Compute the total number of cores and set initial core availabilities
-      this->total_num_cores = 0;
-      for (auto host : compute_resources) {
-        unsigned long num_cores = std::get<1>(host);
-        if (num_cores == ComputeService::ALL_CORES) {
-          num_cores = simulation->getHostNumCores(std::get<0>(host));
-        }
-        this->total_num_cores += num_cores;
-        this->core_availabilities.insert(std::make_pair(std::get<0>(host), num_cores));
-      }
+      // Resolve the task selection algorithm once and for all
+      this->ready_workunits = ReadyWorkunitQueue(ReadyWorkunitQueue::getSelectionPolicy(
+              this->getPropertyValueAsString(StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM)));
 
-      // Compute the total ram and set initial ram availabilities
-      this->total_ram = 0.0;
-      for (auto host : compute_resources) {
-        double ram = std::get<2>(host);
-        if (ram == ComputeService::ALL_RAM) {
-          ram = simulation->getHostMemoryCapacity(std::get<0>(host));
-        }
-        this->total_ram += ram;
-        this->ram_availabilities.insert(std::make_pair(std::get<0>(host),  ram));
-      }
-
-      // Create my compute resources record
-      this->total_num_cores = 0;
-      for (auto host : compute_resources) {
-        unsigned long num_cores = std::get<1>(host);
-        if (num_cores == ComputeService::ALL_CORES) {
-          num_cores = simulation->getHostNumCores(std::get<0>(host));
-        }
-        double ram = std::get<2>(host);
-        if (ram == ComputeService::ALL_RAM) {
-          ram = simulation->getHostMemoryCapacity(std::get<0>(host));
-        }
-        this->compute_resources.insert(std::make_tuple(std::get<0>(host), num_cores, ram));
+      // Compute the total number of cores and ram, and set initial core and ram availabilities
+      this->total_num_cores = (int) this->compute_resources.getTotalNumCores();
+      this->num_idle_cores = this->compute_resources.getTotalNumCores();
+      this->total_ram = this->compute_resources.getTotalRam();
+      for (auto const &host : this->compute_resources) {
+        this->core_availabilities.insert(std::make_pair(host.host_id, host.num_cores));
+        this->ram_availabilities.insert(std::make_pair(host.host_id, host.ram));
+        this->host_capacities.setCapacity(host.getHostname(), host.num_cores, host.ram);
+        this->max_host_num_cores = MAX(this->max_host_num_cores, host.num_cores);
+        this->max_host_ram = MAX(this->max_host_ram, host.ram);
       }
 
     }
@@ -209,9 +189,15 @@ namespace wrench {
       // WEIRDLY, KILLING IN THIS ORDER WORKS BETTER IT SEEMS....
       // TODO: INVESTIGATE?
 
-      // Kill all Workunit executors
+      // Kill all Workunit executors (pooled executors that are running are killed as well, and
+      // are thus never given back to their pool)
       for (auto const &wue : this->running_workunit_executors) {
-        wue->kill();
+        wue.second->kill();
+      }
+
+      // Kill the idle executors of a private pool
+      if (this->owns_workunit_executor_pool) {
+        this->workunit_executor_pool->killIdleExecutors();
       }
 
       // Kill the StandardJobExecutor
@@ -230,7 +216,7 @@ namespace wrench {
       WRENCH_INFO("New StandardJobExecutor starting (%s) with %d cores and %.2lf bytes of RAM over %ld hosts: ",
                   this->mailbox_name.c_str(), this->total_num_cores, this->total_ram, this->core_availabilities.size());
       for (auto h : this->core_availabilities) {
-        WRENCH_INFO("  %s: %ld cores", std::get<0>(h).c_str(), std::get<1>(h));
+        WRENCH_INFO("  %s: %ld cores", S4U_HostRegistry::getHostname(std::get<0>(h)).c_str(), std::get<1>(h));
       }
 
       /** Create all Workunits **/
@@ -263,6 +249,11 @@ namespace wrench {
 
       }
 
+      // Kill the idle executors of a private pool
+      if (this->owns_workunit_executor_pool) {
+        this->workunit_executor_pool->killIdleExecutors();
+      }
+
       WRENCH_INFO("Standard Job Executor on host %s terminated!", S4U_Simulation::getHostName().c_str());
       return 0;
     }
@@ -290,23 +281,25 @@ namespace wrench {
     /**
      * @brief Computes the desired number of cores required to execute a work unit
      * @param wu: the work unit
+     * @param core_allocation_algorithm: the value of the StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM property
      * @return a number of cores
      *
      * @throw std::runtime_error
      */
-    unsigned long StandardJobExecutor::computeWorkUnitDesiredNumCores(Workunit *wu) {
+    unsigned long StandardJobExecutor::computeWorkUnitDesiredNumCores(Workunit *wu,
+                                                                      const std::string &core_allocation_algorithm) {
       unsigned long desired_num_cores;
       if (wu->tasks.empty()) {
         desired_num_cores = 1;
 
       } else if (wu->tasks.size() == 1) {
-        std::string core_allocation_algorithm =
-                this->getPropertyValueAsString(StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM);
-
         if (core_allocation_algorithm == "maximum") {
           desired_num_cores = wu->tasks[0]->getMaxNumCores();
         } else if (core_allocation_algorithm == "minimum") {
           desired_num_cores = wu->tasks[0]->getMinNumCores();
+        } else if (core_allocation_algorithm == "moldable") {
+          auto it = this->moldable_num_cores.find(wu->tasks[0]);
+          desired_num_cores = (it != this->moldable_num_cores.end() ? it->second : wu->tasks[0]->getMinNumCores());
         } else {
           throw std::runtime_error("StandardjobExecutor::computeWorkUnitDesiredNumCores(): Unknown StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM property '"
                                    + core_allocation_algorithm + "'");
@@ -357,20 +350,101 @@ namespace wrench {
         return;
       }
 
-      // Get an ordered (by the task selection algorithm) list of the ready workunits
-      std::vector<Workunit *> sorted_ready_workunits = sortReadyWorkunits();
+      // Workunits that were blocked because no host had enough idle cores and RAM for them are
+      // considered again only once some host does (blocked workunits are sorted by minimum number
+      // of cores and RAM, so that the ones that still don't fit are mostly not looked at)
+      this->ready_workunits.unblock([this](unsigned long min_num_cores, double ram) {
+          return not this->host_capacities.findFirstFit(min_num_cores, ram).empty();
+      });
+      if (this->ready_workunits.top() == nullptr) {
+        return;
+      }
 
-//      std::cerr << "** SORTED\n";
-//      for (auto wu : sorted_ready_workunits) {
-//        std::cerr << "WU: num_comp_tasks " << wu->tasks.size() << "\n";
-//        for (auto t : wu->tasks) {
-//          std::cerr << "    - flops = " << t->getFlops() << ", min_cores = " << t->getMinNumCores() << ", max_cores = " << t->getMaxNumCores() << "\n";
-//        }
-//      }
+      // Look up the properties that drive dispatching once, rather than for each workunit
+      std::string core_allocation_algorithm =
+              this->getPropertyValueAsString(StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM);
+
+      std::string execution_mode =
+              this->getPropertyValueAsString(StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE);
+      if ((execution_mode != "compute_threads") and (execution_mode != "single_actor")) {
+        throw std::runtime_error("Unknown StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE property '"
+                                 + execution_mode + "'");
+      }
+
+      std::string executor_mode =
+              this->getPropertyValueAsString(StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE);
+      if ((executor_mode != "one_per_workunit") and (executor_mode != "pooled")) {
+        throw std::runtime_error("Unknown StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE property '"
+                                 + executor_mode + "'");
+      }
+
+      std::string file_operation_mode =
+              this->getPropertyValueAsString(StandardJobExecutorProperty::FILE_OPERATION_MODE);
+      if ((file_operation_mode != "sequential") and (file_operation_mode != "overlapped")) {
+        throw std::runtime_error("Unknown StandardJobExecutorProperty::FILE_OPERATION_MODE property '"
+                                 + file_operation_mode + "'");
+      }
+      unsigned long max_num_concurrent_file_operations = (unsigned long)
+              this->getPropertyValueAsDouble(StandardJobExecutorProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS);
+
+      double thread_startup_overhead =
+              this->getPropertyValueAsDouble(StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD);
+
+      // With the "moldable" core allocation algorithm, pick the numbers of cores of the highest-priority
+      // ready tasks at once (only as many of them as can get their minimum numbers of cores on the idle
+      // cores are looked at), given the cores that workunits without tasks will use
+      if (core_allocation_algorithm == "moldable") {
+        std::vector<unsigned long> host_num_cores;
+        for (auto const &a : this->core_availabilities) {
+          host_num_cores.push_back(a.second);
+        }
+        std::vector<WorkflowTask *> ready_tasks;
+        unsigned long num_requested_cores = 0;
+        this->ready_workunits.visitInOrder([this, &host_num_cores, &ready_tasks, &num_requested_cores](Workunit *wu) {
+            if (wu->tasks.size() == 1) {
+              ready_tasks.push_back(wu->tasks[0]);
+              num_requested_cores += std::max<unsigned long>(1, wu->tasks[0]->getMinNumCores());
+            } else {
+              auto host = std::find_if(host_num_cores.begin(), host_num_cores.end(),
+                                       [](unsigned long n) { return n > 0; });
+              if (host != host_num_cores.end()) {
+                (*host)--;
+              }
+              num_requested_cores++;
+            }
+            return num_requested_cores < this->num_idle_cores;
+        });
+        this->moldable_num_cores = MoldableCoreAllocator::allocate(ready_tasks, host_num_cores);
+      }
+
+      // With the "cores_and_ram_best_fit" host selection algorithm, identify the ready workunits
+      // with the largest RAM requirements
+      std::string host_selection_algorithm =
+              this->getPropertyValueAsString(StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM);
+      unsigned long look_ahead =
+              (unsigned long) this->getPropertyValueAsDouble(StandardJobExecutorProperty::HOST_SELECTION_LOOK_AHEAD);
+      if ((host_selection_algorithm == "cores_and_ram_best_fit") and (look_ahead > 0)) {
+        for (auto const &wu : this->ready_workunits.getWorkunits()) {
+          if (computeWorkUnitMinMemory(wu) > 0.0) {
+            this->large_memory_workunits.push_back(wu);
+          }
+        }
+        // (stable, so that ties are broken in order of priority)
+        std::stable_sort(this->large_memory_workunits.begin(), this->large_memory_workunits.end(),
+                         [this](Workunit *wu1, Workunit *wu2) {
+                             return computeWorkUnitMinMemory(wu1) > computeWorkUnitMinMemory(wu2);
+                         });
+        if (this->large_memory_workunits.size() > look_ahead) {
+          this->large_memory_workunits.resize(look_ahead);
+        }
+      }
+
+      // Go through the workunits in order of priority (as defined by the task selection algorithm)
+      // and dispatch each of them to hosts/cores, if possible, until all cores are busy. Workunits
+      // that cannot be dispatched now are blocked (and keep their original rank)
+      while ((this->ready_workunits.top() != nullptr) and (this->num_idle_cores > 0)) {
 
-      // Go through the workunits in order of priority and dispatch each them to
-      // hosts/cores, if possible
-      for (auto wu : sorted_ready_workunits) {
+        Workunit *wu = this->ready_workunits.top();
 
 
 
@@ -381,7 +455,7 @@ namespace wrench {
 
         try {
           minimum_num_cores = computeWorkUnitMinNumCores(wu);
-          desired_num_cores = computeWorkUnitDesiredNumCores(wu);
+          desired_num_cores = computeWorkUnitDesiredNumCores(wu, core_allocation_algorithm);
           required_ram = computeWorkUnitMinMemory(wu);
         } catch (std::runtime_error &e) {
           throw;
@@ -420,46 +494,26 @@ namespace wrench {
 
         WRENCH_INFO("Looking for a host to run a work unit that needs at least %ld cores, and would like %ld cores, and requires %.2lf bytes of RAM",
                     minimum_num_cores, desired_num_cores, required_ram);
-        std::string host_selection_algorithm =
-                this->getPropertyValueAsString(StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM);
-
 //        std::cerr << "** FINDING A HOST USING " << host_selection_algorithm << "\n";
 
         if (host_selection_algorithm == "best_fit") {
-          unsigned long target_slack = 0;
-
-          for (auto const &h : this->core_availabilities) {
-            std::string const &hostname = std::get<0>(h);
-//              WRENCH_INFO("Looking at host %s", hostname.c_str());
-
-            // Does the host have enough cores?
-            unsigned long num_available_cores = this->core_availabilities[hostname];
-            if (num_available_cores < minimum_num_cores) {
-//              WRENCH_INFO("Not enough cores!");
-              continue;
-            }
-
-            // Does the host have enough RAM?
-            double available_ram = this->ram_availabilities[hostname];
-            if (available_ram < required_ram) {
-              WRENCH_INFO("Not enough RAM!");
-              continue;
-            }
-
-//            std::cerr << "    HOST COULD WORK \n";
-
-            unsigned long tentative_target_num_cores = MIN(num_available_cores, desired_num_cores);
-            unsigned long tentative_target_slack = num_available_cores - tentative_target_num_cores;
-
-            if ((target_host == "") ||
-                (tentative_target_num_cores > target_num_cores) ||
-                ((tentative_target_num_cores == target_num_cores) && (target_slack > tentative_target_slack))) {
-//              std::cerr << "YEAH!!!\n";
-              target_host = hostname;
-              target_num_cores = tentative_target_num_cores;
-              target_slack = tentative_target_slack;
+          target_host = this->host_capacities.findBestFit(minimum_num_cores, desired_num_cores, required_ram);
+        } else if (host_selection_algorithm == "first_fit") {
+          target_host = this->host_capacities.findFirstFit(minimum_num_cores, required_ram);
+        } else if (host_selection_algorithm == "worst_fit") {
+          target_host = this->host_capacities.findWorstFit(minimum_num_cores, required_ram);
+        } else if (host_selection_algorithm == "cores_and_ram_best_fit") {
+          // Leave room for the other large-memory ready workunits that have not been dispatched
+          std::vector<std::pair<unsigned long, double>> reservations;
+          for (auto const &other_wu : this->large_memory_workunits) {
+            if ((other_wu != wu) and (other_wu->workunit_executor == nullptr)) {
+              reservations.push_back(std::make_pair(computeWorkUnitMinNumCores(other_wu),
+                                                    computeWorkUnitMinMemory(other_wu)));
             }
           }
+          target_host = this->host_capacities.findPackingFit(minimum_num_cores, desired_num_cores, required_ram,
+                                                             this->max_host_num_cores, this->max_host_ram,
+                                                             reservations);
         } else {
           throw std::runtime_error("Unknown StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM property '"
                                    + host_selection_algorithm + "'");
@@ -469,8 +523,11 @@ namespace wrench {
         if (target_host == "") { // didn't find a suitable host
           WRENCH_INFO("Didn't find a suitable host");
 //          std::cerr << "DID NOT FIND A HOST, GOING TO NEXT WORK UNIT\n";
+          this->ready_workunits.block(wu, minimum_num_cores, required_ram);
           continue;
         }
+        unsigned long target_host_id = S4U_HostRegistry::getHostId(target_host);
+        target_num_cores = MIN(this->core_availabilities[target_host_id], desired_num_cores);
 
 //        std::cerr << "FOUND A HOST!!\n";
 
@@ -481,40 +538,60 @@ namespace wrench {
 
 //        std::cerr << "CREATING A WORKUNIT EXECUTOR\n";
 
-        std::shared_ptr<WorkunitMulticoreExecutor> workunit_executor = std::shared_ptr<WorkunitMulticoreExecutor>(
-                new WorkunitMulticoreExecutor(this->simulation,
-                                              target_host,
-                                              target_num_cores,
-                                              required_ram,
-                                              this->mailbox_name,
-                                              wu,
-                                              this->default_storage_service,
-                                              this->getPropertyValueAsDouble(
-                                                      StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD)));
-
-        workunit_executor->setSimulation(this->simulation);
-        workunit_executor->start(workunit_executor, true);
+        std::shared_ptr<WorkunitMulticoreExecutor> workunit_executor;
+        if (executor_mode == "pooled") {
+          if (this->workunit_executor_pool == nullptr) {
+            this->workunit_executor_pool = std::make_shared<WorkunitExecutorPool>(
+                    this->simulation,
+                    thread_startup_overhead,
+                    execution_mode == "single_actor");
+            this->owns_workunit_executor_pool = true;
+          }
+          workunit_executor = this->workunit_executor_pool->acquire(target_host);
+          workunit_executor->setFileOperationMode(file_operation_mode == "overlapped",
+                                                  max_num_concurrent_file_operations);
+          workunit_executor->assignWork(wu, target_num_cores, required_ram,
+                                        this->mailbox_name, this->default_storage_service);
+        } else {
+          workunit_executor = std::shared_ptr<WorkunitMulticoreExecutor>(
+                  new WorkunitMulticoreExecutor(this->simulation,
+                                                target_host,
+                                                target_num_cores,
+                                                required_ram,
+                                                this->mailbox_name,
+                                                wu,
+                                                this->default_storage_service,
+                                                thread_startup_overhead,
+                                                execution_mode == "single_actor"));
+
+          workunit_executor->setFileOperationMode(file_operation_mode == "overlapped",
+                                                  max_num_concurrent_file_operations);
+          workunit_executor->setSimulation(this->simulation);
+          workunit_executor->start(workunit_executor, true);
+        }
 
         // Update core availabilities
-        this->core_availabilities[target_host] -= target_num_cores;
+        this->core_availabilities[target_host_id] -= target_num_cores;
         // Update RAM availabilities
-        this->ram_availabilities[target_host] -= required_ram;
+        this->ram_availabilities[target_host_id] -= required_ram;
+        this->host_capacities.setCapacity(target_host, this->core_availabilities[target_host_id],
+                                          this->ram_availabilities[target_host_id]);
+        if (this->utilization_recorder) {
+          this->utilization_recorder->allocate(S4U_Simulation::getClock(), target_host, target_num_cores, required_ram);
+        }
 
 
         // Update data structures
-        this->running_workunit_executors.insert(workunit_executor);
-
-        for (auto it = this->ready_workunits.begin();
-                it != this->ready_workunits.end(); it++) {
-          if ((*it).get() == wu) {
-            PointerUtil::moveUniquePtrFromSetToSet(it, &(this->ready_workunits), &(this->running_workunits));
-            break;
-          }
-        }
+        this->num_idle_cores -= target_num_cores;
+        this->running_workunit_executors[workunit_executor.get()] = workunit_executor;
+        wu->workunit_executor = workunit_executor.get();
+        this->running_workunits.push_back(this->ready_workunits.pop());
+        wu->list_position = std::prev(this->running_workunits.end());
 
       }
 
-      sorted_ready_workunits.clear();
+      this->moldable_num_cores.clear();
+      this->large_memory_workunits.clear();
 
     }
 
@@ -576,31 +653,38 @@ namespace wrench {
             Workunit *workunit) {
 
       // Update core availabilities
-      this->core_availabilities[workunit_executor->getHostname()] += workunit_executor->getNumCores();
+      unsigned long host_id = S4U_HostRegistry::getHostId(workunit_executor->getHostname());
+      this->core_availabilities[host_id] += workunit_executor->getNumCores();
+      this->num_idle_cores += workunit_executor->getNumCores();
       // Update RAM availabilities
-      this->ram_availabilities[workunit_executor->getHostname()] += workunit_executor->getMemoryUtilization();
-
-      // Remove the workunit executor from the workunit executor list
-      for (auto it = this->running_workunit_executors.begin(); it != this->running_workunit_executors.end(); it++) {
-        if ((*it).get() == workunit_executor) {
-          PointerUtil::moveSharedPtrFromSetToSet(it, &(this->running_workunit_executors), &(this->finished_workunit_executors));
-          break;
+      this->ram_availabilities[host_id] += workunit_executor->getMemoryUtilization();
+      this->host_capacities.setCapacity(workunit_executor->getHostname(),
+                                        this->core_availabilities[host_id],
+                                        this->ram_availabilities[host_id]);
+      if (this->utilization_recorder) {
+        this->utilization_recorder->release(S4U_Simulation::getClock(), workunit_executor->getHostname(),
+                                            workunit_executor->getNumCores(),
+                                            workunit_executor->getMemoryUtilization());
+      }
+
+      // Remove the workunit executor from the workunit executor list (and give it back to the pool, if any)
+      auto executor_it = this->running_workunit_executors.find(workunit_executor);
+      if (executor_it != this->running_workunit_executors.end()) {
+        if (this->getPropertyValueAsString(StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE) == "pooled") {
+          this->workunit_executor_pool->release(executor_it->second);
+        } else {
+          this->finished_workunit_executors.insert(executor_it->second);
         }
+        this->running_workunit_executors.erase(executor_it);
       }
 
-      // Find the workunit in the running workunit queue
-      bool found_it = false;
-      for (auto it = this->running_workunits.begin(); it != this->running_workunits.end(); it++) {
-        if ((*it).get() == workunit) {
-          PointerUtil::moveUniquePtrFromSetToSet(it, &(this->running_workunits), &(this->completed_workunits));
-          found_it = true;
-          break;
-        }
-      }
-      if (!found_it) {
+      // Move the workunit from the running list to the completed list
+      if (workunit->workunit_executor != workunit_executor) {
         throw std::runtime_error(
                 "StandardJobExecutor::processWorkunitExecutorCompletion(): couldn't find a recently completed workunit in the running workunit list");
       }
+      workunit->workunit_executor = nullptr;
+      this->completed_workunits.splice(this->completed_workunits.end(), this->running_workunits, workunit->list_position);
 
       // Process task completions, if any
       for (auto task : workunit->tasks) {
@@ -635,27 +719,10 @@ namespace wrench {
           if (child->num_pending_parents == 0) {
             // Make the child ready!
 
-            // Find the workunit in the running workunig queue
-            bool found_it = false;
-            for (auto it = this->non_ready_workunits.begin(); it != this->non_ready_workunits.end(); it++) {
-              if ((*it).get() == child) {
-                PointerUtil::moveUniquePtrFromSetToSet(it, &(this->non_ready_workunits), &(this->ready_workunits));
-                found_it = true;
-                break;
-              }
-            }
-            if (!found_it) {
-              throw std::runtime_error(
-                      "MultihostMulticoreComputeService::processWorkCompletion(): couldn't find non-ready child in non-ready set!");
-            }
-
-
-//            if (this->non_ready_workunits.find(child) == this->non_ready_workunits.end()) {
-//              throw std::runtime_error(
-//                      "MultihostMulticoreComputeService::processWorkCompletion(): can't find non-ready child in non-ready set!");
-//            }
-//            this->non_ready_workunits.erase(child);
-//            this->ready_workunits.insert(child);
+            // Move the child from the non-ready list to the ready queue
+            std::unique_ptr<Workunit> ready_child = std::move(*(child->list_position));
+            this->non_ready_workunits.erase(child->list_position);
+            this->ready_workunits.push(std::move(ready_child));
           }
         }
       }
@@ -679,31 +746,38 @@ namespace wrench {
       WRENCH_INFO("A workunit executor has failed to complete a workunit on behalf of job '%s'", this->job->getName().c_str());
 
       // Update core availabilities
-      this->core_availabilities[workunit_executor->getHostname()] += workunit_executor->getNumCores();
+      unsigned long host_id = S4U_HostRegistry::getHostId(workunit_executor->getHostname());
+      this->core_availabilities[host_id] += workunit_executor->getNumCores();
+      this->num_idle_cores += workunit_executor->getNumCores();
       // Update RAM availabilities
-      this->ram_availabilities[workunit_executor->getHostname()] += workunit_executor->getMemoryUtilization();
+      this->ram_availabilities[host_id] += workunit_executor->getMemoryUtilization();
+      this->host_capacities.setCapacity(workunit_executor->getHostname(),
+                                        this->core_availabilities[host_id],
+                                        this->ram_availabilities[host_id]);
+      if (this->utilization_recorder) {
+        this->utilization_recorder->release(S4U_Simulation::getClock(), workunit_executor->getHostname(),
+                                            workunit_executor->getNumCores(),
+                                            workunit_executor->getMemoryUtilization());
+      }
 
       // Remove the workunit executor from the workunit executor list and put it in the failed list
-      for (auto it = this->running_workunit_executors.begin(); it != this->running_workunit_executors.end(); it++) {
-        if ((*it).get() == workunit_executor) {
-          PointerUtil::moveSharedPtrFromSetToSet(it, &(this->running_workunit_executors), &(this->failed_workunit_executors));
-          break;
+      // (a pooled executor has merely reported a failed workunit, and can be given back to the pool)
+      auto executor_it = this->running_workunit_executors.find(workunit_executor);
+      if (executor_it != this->running_workunit_executors.end()) {
+        if (this->getPropertyValueAsString(StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE) == "pooled") {
+          this->workunit_executor_pool->release(executor_it->second);
+        } else {
+          this->failed_workunit_executors.insert(executor_it->second);
         }
+        this->running_workunit_executors.erase(executor_it);
       }
 
-      // Remove the work from the running work queue
-      bool found_it = false;
-      for (auto it = this->running_workunits.begin(); it != this->running_workunits.end(); it++) {
-        if ((*it).get() == workunit) {
-          this->running_workunits.erase(it);
-          found_it = true;
-          break;
-        }
-      }
-      if (!found_it) {
+      // Remove the work from the running work list
+      if (workunit->workunit_executor != workunit_executor) {
         throw std::runtime_error(
                 "StandardJobExecutor::processWorkunitExecutorCompletion(): couldn't find a recently failed workunit in the running workunit list");
       }
+      this->running_workunits.erase(workunit->list_position);
 
       // Remove all other workunits for the job in the "not ready" state
       this->non_ready_workunits.clear();
@@ -717,12 +791,10 @@ namespace wrench {
           throw std::runtime_error(
                   "StandardJobExecutor::processWorkunitExecutorFailure(): trying to cancel a running workunit that's doing some file copy operations - not supported (for now)");
         }
-        // find the workunit executor  that's doing the work (lame iteration)
-        for (auto const &wue : this->running_workunit_executors) {
-          if (wue->workunit == wu.get()) {
-            wue->kill();
-            break;
-          }
+        // kill the workunit executor that's doing the work
+        auto executor_it = this->running_workunit_executors.find(wu->workunit_executor);
+        if (executor_it != this->running_workunit_executors.end()) {
+          executor_it->second->kill();
         }
       }
       this->running_workunits.clear();
@@ -770,21 +842,58 @@ namespace wrench {
         post_file_copies_work_unit = new Workunit({}, {}, {}, job->post_file_copies, {});
       }
 
-      // Create the task work units, if any
+      // Create the task work units, if any, each with only the file locations
+      // of its task's files (rather than a copy of the job's whole map)
       for (auto const &task : job->tasks) {
-        task_work_units.push_back(new Workunit({}, {task}, job->file_locations, {}, {}));
+        std::map<WorkflowFile *, StorageService *> task_file_locations;
+        if (not job->file_locations.empty()) {
+          auto add_file_location = [this, &task_file_locations](WorkflowFile *f) {
+            auto location = this->job->file_locations.find(f);
+            if (location != this->job->file_locations.end()) {
+              task_file_locations.insert(*location);
+            }
+          };
+          for (auto const &f : task->getInputFiles()) {
+            add_file_location(f);
+          }
+          for (auto const &f : task->getOutputFiles()) {
+            add_file_location(f);
+          }
+        }
+        task_work_units.push_back(new Workunit({}, {task}, std::move(task_file_locations), {}, {}));
       }
 
-      // Add dependencies from pre copies to possible successors
+      // Add dependencies from pre copies to possible successors. With overlapped file
+      // operations, only tasks that read a pre-copied file wait for the pre copies, and the
+      // other tasks start right away (the pre copies then precede the post copies or cleanup)
       if (pre_file_copies_work_unit != nullptr) {
-        if (not task_work_units.empty()) {
-          for (auto const &twu: task_work_units) {
+        bool overlapped =
+                (this->getPropertyValueAsString(StandardJobExecutorProperty::FILE_OPERATION_MODE) == "overlapped");
+        std::set<WorkflowFile *> pre_copied_files;
+        for (auto const &copy : job->pre_file_copies) {
+          pre_copied_files.insert(std::get<0>(copy));
+        }
+        bool some_task_is_independent = false;
+        for (auto const &twu: task_work_units) {
+          bool reads_pre_copied_file = not overlapped;
+          for (auto const &f : twu->tasks[0]->getInputFiles()) {
+            if (pre_copied_files.find(f) != pre_copied_files.end()) {
+              reads_pre_copied_file = true;
+              break;
+            }
+          }
+          if (reads_pre_copied_file) {
             Workunit::addDependency(pre_file_copies_work_unit, twu);
+          } else {
+            some_task_is_independent = true;
+          }
+        }
+        if (task_work_units.empty() or some_task_is_independent) {
+          if (post_file_copies_work_unit != nullptr) {
+            Workunit::addDependency(pre_file_copies_work_unit, post_file_copies_work_unit);
+          } else if (cleanup_workunit != nullptr) {
+            Workunit::addDependency(pre_file_copies_work_unit, cleanup_workunit);
           }
-        } else if (post_file_copies_work_unit != nullptr) {
-          Workunit::addDependency(pre_file_copies_work_unit, post_file_copies_work_unit);
-        } else if (cleanup_workunit != nullptr) {
-          Workunit::addDependency(pre_file_copies_work_unit, cleanup_workunit);
         }
       }
 
@@ -818,9 +927,10 @@ namespace wrench {
       // Insert work units in the ready or non-ready queues
       for (auto const &wu : all_work_units) {
         if (wu->num_pending_parents == 0) {
-          this->ready_workunits.insert(std::unique_ptr<Workunit>(wu));
+          this->ready_workunits.push(std::unique_ptr<Workunit>(wu));
         } else {
-          this->non_ready_workunits.insert(std::unique_ptr<Workunit>(wu));
+          this->non_ready_workunits.push_back(std::unique_ptr<Workunit>(wu));
+          wu->list_position = std::prev(this->non_ready_workunits.end());
         }
       }
 
@@ -828,56 +938,6 @@ namespace wrench {
     }
 
 
-    /**
-     * @brief Sort the a list of ready workunits based on the TASK_SELECTION_ALGORITHM property
-     *
-     * @return a sorted vector of ready tasks
-     */
-    std::vector<Workunit*> StandardJobExecutor::sortReadyWorkunits() {
-
-//      std::cerr << "In sortReadyWorkunits()\n";
-
-      std::vector<Workunit *> sorted_workunits;
-
-      for (auto const &wu : this->ready_workunits) {
-        sorted_workunits.push_back(wu.get());
-      }
-
-//      std::cerr << "SORTED LENGTH = " << sorted_workunits.size() << "\n";
-
-      std::string selection_algorithm =
-              this->getPropertyValueAsString(StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM);
-
-//      std::cerr << "SELECT ALG = " << selection_algorithm << "\n";
-
-      // using function as comp
-      std::sort(sorted_workunits.begin(), sorted_workunits.end(),
-                [selection_algorithm](const Workunit*  wu1, const Workunit*  wu2) -> bool
-                {
-//                    std::cerr << "IN LAMBDA\n";
-                    // Non-computational workunits have higher priority
-                    if (wu1->tasks.empty()) {
-                      return true;
-                    }
-                    if (wu2->tasks.empty()) {
-                      return false;
-                    }
-
-                    if (selection_algorithm == "maximum_flops") {
-                      return (wu1->tasks[0]->getFlops() >= wu2->tasks[0]->getFlops());
-                    } else if (selection_algorithm == "maximum_minimum_cores") {
-                      return (wu1->tasks[0]->getMinNumCores() >= wu2->tasks[0]->getMinNumCores());
-                    } else {
-                      throw std::runtime_error("Unknown StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM property '"
-                                               + selection_algorithm + "'");
-                    }
-                });
-
-//      std::cerr << "RETURNING FROM sortReadyWorkunits()\n";
-      return sorted_workunits;
-    }
-
-
     /**
      * @brief Retrieve the executor's job
      * @return a standard job
@@ -890,10 +950,30 @@ namespace wrench {
      * @brief Retrieve the executor's compute resources
      * @return a set of compute resources
      */
-    std::set<std::tuple<std::string, unsigned long, double>>  StandardJobExecutor::getComputeResources() {
+    const ResourceAllocation &StandardJobExecutor::getComputeResources() {
       return this->compute_resources;
     }
 
+    /**
+     * @brief Set a recorder of the core and RAM utilization of the executor's hosts, which is
+     *        updated every time a workunit starts or completes (to be called before the executor is started)
+     * @param recorder: a utilization recorder (nullptr for none)
+     */
+    void StandardJobExecutor::setUtilizationRecorder(std::shared_ptr<UtilizationRecorder> recorder) {
+      this->utilization_recorder = std::move(recorder);
+    }
+
+    /**
+     * @brief Set the pool from which workunit executors are acquired when the
+     *        StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE property is "pooled" (to be called
+     *        before the executor is started). Without a pool, the executor creates a private one.
+     * @param pool: a workunit executor pool, shared with other executors of the same compute service
+     */
+    void StandardJobExecutor::setWorkunitExecutorPool(std::shared_ptr<WorkunitExecutorPool> pool) {
+      this->workunit_executor_pool = std::move(pool);
+      this->owns_workunit_executor_pool = false;
+    }
+
 
 };
 
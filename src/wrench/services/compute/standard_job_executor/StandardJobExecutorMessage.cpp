@@ -92,6 +92,15 @@ namespace wrench {
 
     }
 
+    /**
+     * @brief Constructor
+     * @param workunit: the work to perform
+     */
+    WorkunitExecutorAssignWorkMessage::WorkunitExecutorAssignWorkMessage(Workunit *workunit) :
+            StandardJobExecutorMessage("WORK_UNIT_EXECUTOR_ASSIGN_WORK", 0) {
+      this->workunit = workunit;
+    }
+
     /**
      * @brief Constructor
      */
@@ -99,6 +108,15 @@ namespace wrench {
             StandardJobExecutorMessage("COMPUTE_THREAD_DONE", 0) {
     }
 
+    /**
+     * @brief Constructor
+     * @param failure_cause: the cause of the failure, or nullptr if the file operation succeeded
+     */
+    FileOperationThreadDoneMessage::FileOperationThreadDoneMessage(std::shared_ptr<FailureCause> failure_cause) :
+            StandardJobExecutorMessage("FILE_OPERATION_THREAD_DONE", 0) {
+      this->failure_cause = failure_cause;
+    }
+
 
 
 
@@ -110,6 +110,18 @@ namespace wrench {
 
     };
 
+    /**
+     * @brief WorkunitExecutorAssignWorkMessage class, which wakes up an idle
+     *        pooled workunit executor that has been assigned a workunit
+     */
+    class WorkunitExecutorAssignWorkMessage : public StandardJobExecutorMessage {
+    public:
+        explicit WorkunitExecutorAssignWorkMessage(Workunit *workunit);
+
+        /** @brief The work to perform */
+        Workunit *workunit;
+    };
+
     /**
      * @brief ComputeThreadDoneMessage class
      */
@@ -119,6 +131,17 @@ namespace wrench {
 
     };
 
+    /**
+     * @brief FileOperationThreadDoneMessage class
+     */
+    class FileOperationThreadDoneMessage : public StandardJobExecutorMessage {
+    public:
+        explicit FileOperationThreadDoneMessage(std::shared_ptr<FailureCause> failure_cause);
+
+        /** @brief The cause of the failure, or nullptr if the file operation succeeded */
+        std::shared_ptr<FailureCause> failure_cause;
+    };
+
 
     /***********************/
     /** \endcond           */
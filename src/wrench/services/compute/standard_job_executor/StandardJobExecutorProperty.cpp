@@ -13,10 +13,15 @@
 namespace wrench {
 
     SET_PROPERTY_NAME(StandardJobExecutorProperty, THREAD_STARTUP_OVERHEAD);
+    SET_PROPERTY_NAME(StandardJobExecutorProperty, MULTICORE_EXECUTION_MODE);
+    SET_PROPERTY_NAME(StandardJobExecutorProperty, WORKUNIT_EXECUTOR_MODE);
+    SET_PROPERTY_NAME(StandardJobExecutorProperty, FILE_OPERATION_MODE);
+    SET_PROPERTY_NAME(StandardJobExecutorProperty, MAX_NUM_CONCURRENT_FILE_OPERATIONS);
     SET_PROPERTY_NAME(StandardJobExecutorProperty, STANDARD_JOB_DONE_MESSAGE_PAYLOAD);
     SET_PROPERTY_NAME(StandardJobExecutorProperty, STANDARD_JOB_FAILED_MESSAGE_PAYLOAD);
 
     SET_PROPERTY_NAME(StandardJobExecutorProperty, CORE_ALLOCATION_ALGORITHM);
     SET_PROPERTY_NAME(StandardJobExecutorProperty, TASK_SELECTION_ALGORITHM);
     SET_PROPERTY_NAME(StandardJobExecutorProperty, HOST_SELECTION_ALGORITHM);
+    SET_PROPERTY_NAME(StandardJobExecutorProperty, HOST_SELECTION_LOOK_AHEAD);
 };
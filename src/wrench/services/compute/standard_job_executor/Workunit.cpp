@@ -29,12 +29,15 @@ namespace wrench {
             std::set<std::tuple<WorkflowFile *, StorageService *>> cleanup_file_deletions) {
 
       this->num_pending_parents = 0;
+      this->ready_queue_index = 0;
+      this->ready_queue_sequence_number = 0;
+      this->workunit_executor = nullptr;
 
-      this->pre_file_copies = pre_file_copies;
-      this->tasks = tasks;
-      this->file_locations = file_locations;
-      this->post_file_copies = post_file_copies;
-      this->cleanup_file_deletions = cleanup_file_deletions;
+      this->pre_file_copies = std::move(pre_file_copies);
+      this->tasks = std::move(tasks);
+      this->file_locations = std::move(file_locations);
+      this->post_file_copies = std::move(post_file_copies);
+      this->cleanup_file_deletions = std::move(cleanup_file_deletions);
 
     }
 
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/services/compute/standard_job_executor/WorkunitExecutorPool.h"
+#include "wrench/services/compute/standard_job_executor/WorkunitMulticoreExecutor.h"
+#include "wrench/logging/TerminalOutput.h"
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(workunit_executor_pool, "Log category for Workunit Executor Pool");
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     *
+     * @param simulation: a pointer to the simulation object
+     * @param thread_startup_overhead: the thread startup overhead of the pooled executors, in seconds
+     * @param single_actor_execution: whether the pooled executors simulate multicore computations
+     *        without compute threads
+     */
+    WorkunitExecutorPool::WorkunitExecutorPool(Simulation *simulation,
+                                               double thread_startup_overhead,
+                                               bool single_actor_execution) {
+      this->simulation = simulation;
+      this->thread_startup_overhead = thread_startup_overhead;
+      this->single_actor_execution = single_actor_execution;
+    }
+
+    /**
+     * @brief Get an idle workunit executor on a host, starting a new one if there is none
+     *
+     * @param hostname: the name of the host
+     * @return a persistent workunit executor, which must be given work (with
+     *         WorkunitMulticoreExecutor::assignWork()) and later released or dropped (if killed)
+     */
+    std::shared_ptr<WorkunitMulticoreExecutor> WorkunitExecutorPool::acquire(const std::string &hostname) {
+
+      std::vector<std::shared_ptr<WorkunitMulticoreExecutor>> &idle = this->idle_executors[hostname];
+      if (not idle.empty()) {
+        std::shared_ptr<WorkunitMulticoreExecutor> workunit_executor = std::move(idle.back());
+        idle.pop_back();
+        return workunit_executor;
+      }
+
+      WRENCH_INFO("Starting a new pooled workunit executor on host %s", hostname.c_str());
+      std::shared_ptr<WorkunitMulticoreExecutor> workunit_executor = std::shared_ptr<WorkunitMulticoreExecutor>(
+              new WorkunitMulticoreExecutor(this->simulation,
+                                            hostname,
+                                            this->thread_startup_overhead,
+                                            this->single_actor_execution));
+      workunit_executor->setSimulation(this->simulation);
+      workunit_executor->start(workunit_executor, true);
+      this->num_created_executors++;
+      return workunit_executor;
+    }
+
+    /**
+     * @brief Return a workunit executor that has reported on its work to the pool
+     *
+     * @param workunit_executor: the workunit executor
+     */
+    void WorkunitExecutorPool::release(std::shared_ptr<WorkunitMulticoreExecutor> workunit_executor) {
+      std::string hostname = workunit_executor->getHostname();
+      this->idle_executors[hostname].push_back(std::move(workunit_executor));
+    }
+
+    /**
+     * @brief Kill all idle workunit executors
+     */
+    void WorkunitExecutorPool::killIdleExecutors() {
+      for (auto const &h : this->idle_executors) {
+        for (auto const &workunit_executor : h.second) {
+          workunit_executor->kill();
+        }
+      }
+      this->idle_executors.clear();
+    }
+
+    /**
+     * @brief Get the number of idle workunit executors
+     * @return a number of workunit executors
+     */
+    unsigned long WorkunitExecutorPool::getNumIdleExecutors() {
+      unsigned long num_idle = 0;
+      for (auto const &h : this->idle_executors) {
+        num_idle += h.second.size();
+      }
+      return num_idle;
+    }
+
+    /**
+     * @brief Get the number of workunit executors that the pool has started
+     * @return a number of workunit executors
+     */
+    unsigned long WorkunitExecutorPool::getNumCreatedExecutors() {
+      return this->num_created_executors;
+    }
+
+};
@@ -21,6 +21,7 @@
 #include <wrench/simulation/SimulationTimestampTypes.h>
 #include "wrench/services/compute/standard_job_executor/Workunit.h"
 #include "ComputeThread.h"
+#include "FileOperationThread.h"
 #include "wrench/simulation/Simulation.h"
 
 #include <xbt/ex.hpp>
@@ -44,6 +45,8 @@ namespace wrench {
      * @param workunit: the workunit to perform
      * @param default_storage_service: the default storage service from which to read/write data (if any)
      * @param thread_startup_overhead: the thread_startup overhead, in seconds
+     * @param single_actor_execution: whether the multicore computation of each task should
+     *        be simulated by the executor itself rather than by one compute thread per core
      */
     WorkunitMulticoreExecutor::WorkunitMulticoreExecutor(
             Simulation *simulation,
@@ -53,7 +56,8 @@ namespace wrench {
             std::string callback_mailbox,
             Workunit *workunit,
             StorageService *default_storage_service,
-            double thread_startup_overhead) :
+            double thread_startup_overhead,
+            bool single_actor_execution) :
             Service(hostname, "workunit_multicore_executor", "workunit_multicore_executor") {
 
       if (thread_startup_overhead < 0) {
@@ -67,12 +71,103 @@ namespace wrench {
       this->callback_mailbox = callback_mailbox;
       this->workunit = workunit;
       this->thread_startup_overhead = thread_startup_overhead;
+      this->single_actor_execution = single_actor_execution;
       this->num_cores = num_cores;
       this->ram_utilization = ram_utilization;
       this->default_storage_service = default_storage_service;
+      this->persistent = false;
 
     }
 
+    /**
+     * @brief Constructor of a persistent (pooled) workunit executor, which starts on the host
+     *        without any work and then performs the workunits assigned to it, one after
+     *        the other, until it is killed
+     *
+     * @param simulation: a pointer to the simulation object
+     * @param hostname: the name of the host
+     * @param thread_startup_overhead: the thread_startup overhead, in seconds
+     * @param single_actor_execution: whether the multicore computation of each task should
+     *        be simulated by the executor itself rather than by one compute thread per core
+     */
+    WorkunitMulticoreExecutor::WorkunitMulticoreExecutor(
+            Simulation *simulation,
+            std::string hostname,
+            double thread_startup_overhead,
+            bool single_actor_execution) :
+            Service(hostname, "workunit_multicore_executor", "workunit_multicore_executor") {
+
+      if (thread_startup_overhead < 0) {
+        throw std::invalid_argument("WorkunitMulticoreExecutor::WorkunitMulticoreExecutor(): thread_startup_overhead must be >= 0");
+      }
+
+      this->simulation = simulation;
+      this->workunit = nullptr;
+      this->thread_startup_overhead = thread_startup_overhead;
+      this->single_actor_execution = single_actor_execution;
+      this->num_cores = 0;
+      this->ram_utilization = 0.0;
+      this->default_storage_service = nullptr;
+      this->persistent = true;
+    }
+
+    /**
+     * @brief Assign a workunit to an idle persistent workunit executor (to be called
+     *        by the actor that acquired the executor from its pool)
+     *
+     * @param workunit: the workunit to perform
+     * @param num_cores: the number of cores available to the executor
+     * @param ram_utilization: the number of bytes of RAM used by the executor
+     * @param callback_mailbox: the callback mailbox to which the executor
+     *        sends its "work done" or "work failed" message
+     * @param default_storage_service: the default storage service from which to read/write data (if any)
+     *
+     * @throw std::invalid_argument
+     * @throw std::runtime_error
+     * @throw std::shared_ptr<NetworkError>
+     */
+    void WorkunitMulticoreExecutor::assignWork(Workunit *workunit,
+                                               unsigned long num_cores,
+                                               double ram_utilization,
+                                               std::string callback_mailbox,
+                                               StorageService *default_storage_service) {
+      if (not this->persistent) {
+        throw std::runtime_error("WorkunitMulticoreExecutor::assignWork(): the executor is not a pooled executor");
+      }
+      if (num_cores < 1) {
+        throw std::invalid_argument("WorkunitMulticoreExecutor::assignWork(): num_cores must be >= 1");
+      }
+
+      this->workunit = workunit;
+      this->num_cores = num_cores;
+      this->ram_utilization = ram_utilization;
+      this->callback_mailbox = std::move(callback_mailbox);
+      this->default_storage_service = default_storage_service;
+
+      S4U_Mailbox::dputMessage(this->mailbox_name, new WorkunitExecutorAssignWorkMessage(workunit));
+    }
+
+    /**
+     * @brief Set how the executor performs file operations (to be called before
+     *        the executor is started, or before a workunit is assigned to it)
+     *
+     * @param overlapped: if false, all file operations are performed one after the other. If true,
+     *        file copies and each task's input file reads are performed concurrently, and each
+     *        task's output file writes proceed while the workunit's next task runs
+     * @param max_num_concurrent_file_operations: the maximum number of concurrent reads, writes,
+     *        or copies (when overlapped)
+     *
+     * @throw std::invalid_argument
+     */
+    void WorkunitMulticoreExecutor::setFileOperationMode(bool overlapped, unsigned long max_num_concurrent_file_operations) {
+      if (max_num_concurrent_file_operations < 1) {
+        throw std::invalid_argument(
+                "WorkunitMulticoreExecutor::setFileOperationMode(): max_num_concurrent_file_operations must be >= 1");
+      }
+      this->overlapped_file_operations = overlapped;
+      this->max_num_concurrent_file_operations = max_num_concurrent_file_operations;
+    }
+
     /**
      * @brief Kill the worker thread
      */
@@ -94,6 +189,11 @@ namespace wrench {
         WRENCH_INFO("Killing compute thread [%s]", compute_thread->getName().c_str());
         compute_thread->kill();
       }
+
+      // And all file operation threads, if any
+      for (auto const &file_operation_thread : this->file_operation_threads) {
+        file_operation_thread->kill();
+      }
 //      WRENCH_INFO("Clearing before everything got killed\n");
 //      this->compute_threads.clear();
 
@@ -113,6 +213,47 @@ namespace wrench {
 
       TerminalOutput::setThisProcessLoggingColor(WRENCH_LOGGING_COLOR_BLUE);
 
+      if (not this->persistent) {
+        performAndReportWork();
+        WRENCH_INFO("Work unit executor on host %s terminating!", S4U_Simulation::getHostName().c_str());
+        return 0;
+      }
+
+      WRENCH_INFO("New pooled WorkunitExecutor starting (%s)", this->mailbox_name.c_str());
+
+      while (true) {
+        std::unique_ptr<SimulationMessage> message;
+        try {
+          message = S4U_Mailbox::getMessage(this->mailbox_name);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          WRENCH_INFO("Pooled work unit executor got a network error while waiting for work... aborting!");
+          return 0;
+        } catch (std::shared_ptr<FatalFailure> &cause) {
+          WRENCH_INFO("Pooled work unit executor got a fatal failure while waiting for work... aborting!");
+          return 0;
+        }
+
+        if (dynamic_cast<WorkunitExecutorAssignWorkMessage *>(message.get()) == nullptr) {
+          throw std::runtime_error("WorkunitMulticoreExecutor::main(): Unexpected [" + message->getName() + "] message");
+        }
+
+        // Compute and file operation threads of the previous workunit, if any, are all done
+        this->compute_threads.clear();
+        this->file_operation_threads.clear();
+
+        if (not performAndReportWork()) {
+          return 0;
+        }
+      }
+    }
+
+    /**
+     * @brief Perform the current workunit and report on it to the callback mailbox
+     *
+     * @return false if the report could not be sent, true otherwise
+     */
+    bool WorkunitMulticoreExecutor::performAndReportWork() {
+
       WRENCH_INFO("New WorkunitExecutor starting (%s) to do: %ld pre file copies, %ld tasks, %ld post file copies",
                   this->mailbox_name.c_str(),
                   this->workunit->pre_file_copies.size(),
@@ -159,15 +300,14 @@ namespace wrench {
       } catch (std::shared_ptr<NetworkError> &cause) {
         WRENCH_INFO("Work unit executor on can't report back due to network error.. aborting!");
         this->workunit = nullptr; // To decrease the ref count
-        return 0;
+        return false;
       } catch (std::shared_ptr<FatalFailure> &cause) {
         WRENCH_INFO("Work unit executor got a fatal failure... aborting!");
         this->workunit = nullptr; // To decrease the ref count
-        return 0;
+        return false;
       }
 
-      WRENCH_INFO("Work unit executor on host %s terminating!", S4U_Simulation::getHostName().c_str());
-      return 0;
+      return true;
     }
 
 
@@ -179,6 +319,11 @@ namespace wrench {
     void
     WorkunitMulticoreExecutor::performWork(Workunit *work) {
 
+      if (this->overlapped_file_operations) {
+        performOverlappedWork(work);
+        return;
+      }
+
       /** Perform all pre file copies operations */
       for (auto file_copy : work->pre_file_copies) {
         WorkflowFile *file = std::get<0>(file_copy);
@@ -206,26 +351,8 @@ namespace wrench {
       /** Perform all tasks **/
       for (auto task : work->tasks) {
 
-        // Read  all input files
-        WRENCH_INFO("Reading the %ld input files for task %s", task->getInputFiles().size(), task->getId().c_str());
-        try {
-          StorageService::readFiles(task->getInputFiles(),
-                                    work->file_locations,
-                                    this->default_storage_service);
-        } catch (WorkflowExecutionException &e) {
-          throw;
-        }
-
-        // Run the task's computation (which can be multicore)
-        WRENCH_INFO("Executing task %s (%lf flops) on %ld cores (%s)", task->getId().c_str(), task->getFlops(), this->num_cores, S4U_Simulation::getHostName().c_str());
-        task->setRunning();
-        task->setStartDate(S4U_Simulation::getClock());
-
-        try {
-          runMulticoreComputation(task->getFlops(), task->getParallelEfficiency());
-        } catch (WorkflowExecutionEvent &e) {
-          throw;
-        }
+        // Read all input files, and run the task's computation
+        readInputFilesAndCompute(work, task, 1);
 
         WRENCH_INFO("Writing the %ld output files for task %s", task->getOutputFiles().size(), task->getId().c_str());
 
@@ -233,16 +360,11 @@ namespace wrench {
         try {
           StorageService::writeFiles(task->getOutputFiles(), work->file_locations, this->default_storage_service);
         } catch (WorkflowExecutionException &e) {
+          this->simulation->output.addTimestamp<SimulationTimestampTaskFailure>(task);
           throw;
         }
 
-        task->setCompleted();
-
-        task->setEndDate(S4U_Simulation::getClock());
-
-        // Generate a SimulationTimestamp
-        this->simulation->output.addTimestamp<SimulationTimestampTaskCompletion>(
-                new SimulationTimestampTaskCompletion(task));
+        completeTask(task);
       }
 
       WRENCH_INFO("Done with all tasks");
@@ -283,15 +405,316 @@ namespace wrench {
     }
 
 
+    /**
+     * @brief Simulate work execution, with concurrent file operations: pre (and post) file copies
+     *        are performed concurrently, each task's input files are read concurrently, and each
+     *        task's output files are written while the next task (if any) reads its input and
+     *        computes. A task is completed once its output files have been written. At most
+     *        max_num_concurrent_file_operations reads, writes, or copies are performed at once,
+     *        and, as in sequential mode, the first failure (after which no other file operation
+     *        is started) fails the work
+     *
+     * @param work: the work to perform
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    void WorkunitMulticoreExecutor::performOverlappedWork(Workunit *work) {
+
+      std::string hostname = S4U_Simulation::getHostName();
+
+      /** Perform all pre file copies operations */
+      std::vector<std::shared_ptr<FileOperationThread>> pre_file_copy_threads;
+      std::string pre_file_copy_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long pre_file_copy_correlation_id = S4U_Mailbox::generateCorrelationId();
+      for (auto file_copy : work->pre_file_copies) {
+        WorkflowFile *file = std::get<0>(file_copy);
+        StorageService *src = std::get<1>(file_copy);
+        StorageService *dst = std::get<2>(file_copy);
+
+        if ((file == nullptr) || (src == nullptr) || (dst == nullptr)) {
+          throw std::runtime_error("WorkunitMulticoreExecutor::performWork(): internal error: malformed workunit");
+        }
+        pre_file_copy_threads.push_back(std::shared_ptr<FileOperationThread>(
+                new FileOperationThread(this->simulation, hostname, FileOperationThread::COPY,
+                                        file, dst, src, pre_file_copy_mailbox, pre_file_copy_correlation_id)));
+      }
+      completeFileOperationThreads(pre_file_copy_threads, startFileOperationThreads(pre_file_copy_threads),
+                                   pre_file_copy_mailbox, pre_file_copy_correlation_id);
+
+      /** Perform all tasks **/
+      // The task whose output files are being written, if any
+      WorkflowTask *writing_task = nullptr;
+      std::vector<std::shared_ptr<FileOperationThread>> write_threads;
+      unsigned long num_started_write_threads = 0;
+      std::string write_mailbox;
+      unsigned long write_correlation_id = 0;
+
+      for (auto task : work->tasks) {
+
+        // Read all input files concurrently (from this actor, as the task cannot start before they are
+        // read), and run the task's computation
+        try {
+          readInputFilesAndCompute(work, task, this->max_num_concurrent_file_operations);
+        } catch (WorkflowExecutionException &e) {
+          // The previous task, if any, still completes (or fails) once its output files are written,
+          // but the work fails because of this task
+          if (writing_task != nullptr) {
+            try {
+              completeOutputFileWrites(writing_task, write_threads, num_started_write_threads,
+                                       write_mailbox, write_correlation_id);
+            } catch (WorkflowExecutionException &ignore) {
+            }
+          }
+          throw;
+        }
+
+        // Wait for the previous task's output file writes, if any, and complete that task
+        if (writing_task != nullptr) {
+          completeOutputFileWrites(writing_task, write_threads, num_started_write_threads,
+                                   write_mailbox, write_correlation_id);
+        }
+
+        // Start writing all output files (in the background)
+        WRENCH_INFO("Writing the %ld output files for task %s", task->getOutputFiles().size(), task->getId().c_str());
+        write_threads.clear();
+        write_mailbox = S4U_Mailbox::generateReplyMailboxName();
+        write_correlation_id = S4U_Mailbox::generateCorrelationId();
+        for (auto const &f : task->getOutputFiles()) {
+          auto location = work->file_locations.find(f);
+          StorageService *storage_service =
+                  (location != work->file_locations.end() ? location->second : this->default_storage_service);
+          if (storage_service == nullptr) {
+            this->simulation->output.addTimestamp<SimulationTimestampTaskFailure>(task);
+            throw WorkflowExecutionException(new NoStorageServiceForFile(f));
+          }
+          write_threads.push_back(std::shared_ptr<FileOperationThread>(
+                  new FileOperationThread(this->simulation, hostname, FileOperationThread::WRITE,
+                                          f, storage_service, nullptr, write_mailbox, write_correlation_id)));
+        }
+        // The next task's input file reads share the reply mailbox, and must keep these threads' replies
+        S4U_Mailbox::expectReplies(write_correlation_id);
+        num_started_write_threads = startFileOperationThreads(write_threads);
+        writing_task = task;
+      }
+
+      // Wait for the last task's output file writes, if any, and complete that task
+      if (writing_task != nullptr) {
+        completeOutputFileWrites(writing_task, write_threads, num_started_write_threads,
+                                 write_mailbox, write_correlation_id);
+      }
+
+      WRENCH_INFO("Done with all tasks");
+
+      /** Perform all post file copies operations */
+      std::vector<std::shared_ptr<FileOperationThread>> post_file_copy_threads;
+      std::string post_file_copy_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long post_file_copy_correlation_id = S4U_Mailbox::generateCorrelationId();
+      for (auto file_copy : work->post_file_copies) {
+        post_file_copy_threads.push_back(std::shared_ptr<FileOperationThread>(
+                new FileOperationThread(this->simulation, hostname, FileOperationThread::COPY,
+                                        std::get<0>(file_copy), std::get<2>(file_copy), std::get<1>(file_copy),
+                                        post_file_copy_mailbox, post_file_copy_correlation_id)));
+      }
+      completeFileOperationThreads(post_file_copy_threads, startFileOperationThreads(post_file_copy_threads),
+                                   post_file_copy_mailbox, post_file_copy_correlation_id);
+
+      /** Perform all cleanup file deletions */
+      for (auto cleanup : work->cleanup_file_deletions) {
+        WorkflowFile *file = std::get<0>(cleanup);
+        StorageService *storage_service = std::get<1>(cleanup);
+
+        S4U_Simulation::sleep(this->thread_startup_overhead);
+        storage_service->deleteFile(file);
+      }
+
+      WRENCH_INFO("Done with my work");
+    }
+
+    /**
+     * @brief Read a task's input files and run the task's computation (recording the task's
+     *        failure, if any)
+     *
+     * @param work: the work the task belongs to
+     * @param task: the task
+     * @param max_num_concurrent_reads: the maximum number of input files that are read at once
+     *
+     * @throw WorkflowExecutionException
+     */
+    void WorkunitMulticoreExecutor::readInputFilesAndCompute(Workunit *work, WorkflowTask *task,
+                                                             unsigned long max_num_concurrent_reads) {
+
+      this->simulation->output.addTimestamp<SimulationTimestampTaskStart>(task);
+
+      try {
+        // Read all input files
+        WRENCH_INFO("Reading the %ld input files for task %s", task->getInputFiles().size(), task->getId().c_str());
+        StorageService::readFiles(task->getInputFiles(), work->file_locations, this->default_storage_service,
+                                  max_num_concurrent_reads);
+
+        // Run the task's computation (which can be multicore)
+        WRENCH_INFO("Executing task %s (%lf flops) on %ld cores (%s)", task->getId().c_str(), task->getFlops(), this->num_cores, S4U_Simulation::getHostName().c_str());
+        task->setRunning();
+        task->setStartDate(S4U_Simulation::getClock());
+        task->setExecutionHost(this->hostname);
+
+        if (this->single_actor_execution) {
+          runSingleActorMulticoreComputation(task->getFlops(), task->getSpeedup(this->num_cores));
+        } else {
+          runMulticoreComputation(task->getFlops(), task->getSpeedup(this->num_cores));
+        }
+      } catch (WorkflowExecutionException &e) {
+        this->simulation->output.addTimestamp<SimulationTimestampTaskFailure>(task);
+        throw;
+      }
+    }
+
+    /**
+     * @brief Mark a task (whose output files have been written) as completed
+     *
+     * @param task: the task
+     */
+    void WorkunitMulticoreExecutor::completeTask(WorkflowTask *task) {
+      task->setCompleted();
+      task->setEndDate(S4U_Simulation::getClock());
+      this->simulation->output.addTimestamp<SimulationTimestampTaskCompletion>(task);
+    }
+
+    /**
+     * @brief Wait for the completion of a task's output file write threads, and then complete
+     *        the task (or record its failure)
+     *
+     * @param task: the task
+     * @param threads: the task's output file write threads
+     * @param num_started: the number of threads (at the beginning of the list) that have been started
+     * @param reply_mailbox: the mailbox to which the threads report
+     * @param correlation_id: the id with which the threads report
+     *
+     * @throw WorkflowExecutionException
+     */
+    void WorkunitMulticoreExecutor::completeOutputFileWrites(
+            WorkflowTask *task,
+            const std::vector<std::shared_ptr<FileOperationThread>> &threads,
+            unsigned long num_started,
+            std::string reply_mailbox,
+            unsigned long correlation_id) {
+      try {
+        completeFileOperationThreads(threads, num_started, reply_mailbox, correlation_id);
+      } catch (WorkflowExecutionException &e) {
+        this->simulation->output.addTimestamp<SimulationTimestampTaskFailure>(task);
+        throw;
+      }
+      completeTask(task);
+    }
+
+    /**
+     * @brief Start file operation threads, up to the maximum number of concurrent file operations
+     *
+     * @param threads: the (not yet started) file operation threads
+     * @return the number of started threads
+     *
+     * @throw WorkflowExecutionException
+     */
+    unsigned long WorkunitMulticoreExecutor::startFileOperationThreads(
+            const std::vector<std::shared_ptr<FileOperationThread>> &threads) {
+      unsigned long num_started = 0;
+      while ((num_started < threads.size()) and (num_started < this->max_num_concurrent_file_operations)) {
+        startFileOperationThread(threads[num_started++]);
+      }
+      return num_started;
+    }
+
+    /**
+     * @brief Wait for the completion of file operation threads, starting the remaining ones
+     *        as others complete (but no longer once one has failed)
+     *
+     * @param threads: the file operation threads
+     * @param num_started: the number of threads (at the beginning of the list) that have been started
+     * @param reply_mailbox: the mailbox to which the threads report
+     * @param correlation_id: the id with which the threads report
+     *
+     * @throw WorkflowExecutionException: the cause of the first failure, if any
+     */
+    void WorkunitMulticoreExecutor::completeFileOperationThreads(
+            const std::vector<std::shared_ptr<FileOperationThread>> &threads,
+            unsigned long num_started,
+            std::string reply_mailbox,
+            unsigned long correlation_id) {
+
+      unsigned long num_running = num_started;
+      std::shared_ptr<FailureCause> failure_cause = nullptr;
+
+      while (num_running > 0) {
+        std::shared_ptr<FailureCause> cause = waitForFileOperationThread(reply_mailbox, correlation_id);
+        num_running--;
+        if ((cause != nullptr) and (failure_cause == nullptr)) {
+          failure_cause = cause;
+        }
+        if ((failure_cause == nullptr) and (num_started < threads.size())) {
+          startFileOperationThread(threads[num_started++]);
+          num_running++;
+        }
+      }
+      // All threads have reported, so no reply with that id needs to be kept anymore
+      S4U_Mailbox::ignoreReplies(correlation_id);
+
+      if (failure_cause != nullptr) {
+        throw WorkflowExecutionException(failure_cause);
+      }
+    }
+
+    /**
+     * @brief Start a file operation thread
+     *
+     * @param file_operation_thread: the file operation thread
+     *
+     * @throw WorkflowExecutionException
+     */
+    void WorkunitMulticoreExecutor::startFileOperationThread(std::shared_ptr<FileOperationThread> file_operation_thread) {
+      try {
+        S4U_Simulation::sleep(this->thread_startup_overhead);
+        file_operation_thread->start(file_operation_thread, true);
+      } catch (std::exception &e) {
+        WRENCH_INFO("Could not create file operation thread... perhaps I am being killed?");
+        throw WorkflowExecutionException(new FatalFailure());
+      }
+      this->file_operation_threads.push_back(file_operation_thread);
+    }
+
+    /**
+     * @brief Wait for a file operation thread to complete
+     *
+     * @param reply_mailbox: the mailbox to which the thread reports
+     * @param correlation_id: the id with which the thread reports
+     * @return the cause of the file operation's failure, or nullptr on success
+     */
+    std::shared_ptr<FailureCause> WorkunitMulticoreExecutor::waitForFileOperationThread(std::string reply_mailbox,
+                                                                                        unsigned long correlation_id) {
+      std::unique_ptr<SimulationMessage> message;
+      try {
+        message = S4U_Mailbox::getReply(reply_mailbox, correlation_id);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        return cause;
+      } catch (std::shared_ptr<FatalFailure> &cause) {
+        return cause;
+      }
+      if (auto msg = dynamic_cast<FileOperationThreadDoneMessage *>(message.get())) {
+        return msg->failure_cause;
+      }
+      throw std::runtime_error("WorkunitMulticoreExecutor::waitForFileOperationThread(): Unexpected [" +
+                               message->getName() + "] message");
+    }
+
     /**
      * @brief Simulate the execution of a multicore computation
      * @param flops: the number of flops
-     * @param parallel_efficiency: the parallel efficiency
+     * @param speedup: the speedup of the computation on the executor's cores
      */
-    void WorkunitMulticoreExecutor::runMulticoreComputation(double flops, double parallel_efficiency) {
-      double effective_flops = (flops / (this->num_cores * parallel_efficiency));
+    void WorkunitMulticoreExecutor::runMulticoreComputation(double flops, double speedup) {
+      double effective_flops = (flops / speedup);
 
-      std::string tmp_mailbox = S4U_Mailbox::generateUniqueMailboxName("workunit_executor");
+      std::string tmp_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       WRENCH_INFO("Creating %ld compute threads", this->num_cores);
       // Create an compute thread to run the computation on each core
@@ -306,7 +729,7 @@ namespace wrench {
         }
         std::shared_ptr<ComputeThread> compute_thread;
         try {
-          compute_thread = std::shared_ptr<ComputeThread>(new ComputeThread(this->simulation, S4U_Simulation::getHostName(), effective_flops, tmp_mailbox));
+          compute_thread = std::shared_ptr<ComputeThread>(new ComputeThread(this->simulation, S4U_Simulation::getHostName(), effective_flops, tmp_mailbox, correlation_id));
           compute_thread->start(compute_thread, true);
         } catch (std::exception &e) {
           // Some internal SimGrid exceptions...????
@@ -333,7 +756,7 @@ namespace wrench {
       #ifndef S4U_KILL_JOIN_WORKS
       for (unsigned long i = 0; i < this->compute_threads.size(); i++) {
         try {
-          S4U_Mailbox::getMessage(tmp_mailbox);
+          S4U_Mailbox::getReply(tmp_mailbox, correlation_id);
         } catch (std::shared_ptr<NetworkError> &e) {
           WRENCH_INFO("Got a network error when trying to get completion message from compute thread");
           // Do nothing, perhaps the child has died
@@ -368,6 +791,36 @@ namespace wrench {
       }
     }
 
+    /**
+     * @brief Simulate the execution of a multicore computation without creating
+     *        compute threads: since the executor's cores are reserved for it, running
+     *        one per-core share of the work after the (sequential) startup overheads of
+     *        all threads takes exactly as long as running one compute thread per core
+     *
+     * @param flops: the number of flops
+     * @param speedup: the speedup of the computation on the executor's cores
+     *
+     * @throw WorkflowExecutionException
+     */
+    void WorkunitMulticoreExecutor::runSingleActorMulticoreComputation(double flops, double speedup) {
+      double effective_flops = (flops / speedup);
+
+      try {
+        S4U_Simulation::sleep(this->num_cores * this->thread_startup_overhead);
+      } catch (std::exception &e) {
+        WRENCH_INFO("Got an exception while sleeping... perhaps I am being killed?");
+        throw WorkflowExecutionException(new FatalFailure());
+      }
+
+      WRENCH_INFO("Computing %.2f flops on each of %ld cores", effective_flops, this->num_cores);
+      try {
+        S4U_Simulation::compute(effective_flops);
+      } catch (std::exception &e) {
+        WRENCH_INFO("Got an exception while computing... perhaps my host has failed?");
+        throw WorkflowExecutionException(new ComputeThreadHasDied());
+      }
+    }
+
     /**
      * @brief Returns the number of cores the executor is running on
      * @return number of cores
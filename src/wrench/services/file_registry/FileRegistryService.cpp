@@ -73,12 +73,13 @@ namespace wrench {
         throw std::invalid_argument("FileRegistryService::lookupEntry(): Invalid argument");
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name, new FileRegistryFileLookupRequestMessage(answer_mailbox, file,
                                                                                              this->getPropertyValueAsDouble(
-                                                                                                     FileRegistryServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+                                                                                                     FileRegistryServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -86,7 +87,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -102,6 +103,37 @@ namespace wrench {
 
     }
 
+    /**
+     * @brief Asynchronously look up a file entry
+     * @param file: the file to look up
+     * @return the future list of locations
+     *
+     * @throw std::invalid_argument
+     * @throw WorkflowExecutionException
+     */
+    std::unique_ptr<ServiceFuture<std::set<StorageService *>>> FileRegistryService::lookupEntryAsync(WorkflowFile *file) {
+
+      if (file == nullptr) {
+        throw std::invalid_argument("FileRegistryService::lookupEntryAsync(): Invalid argument");
+      }
+
+      std::unique_ptr<ServiceFuture<std::set<StorageService *>>> future(new ServiceFuture<std::set<StorageService *>>(
+              [](SimulationMessage *message) -> std::set<StorageService *> {
+                if (auto msg = dynamic_cast<FileRegistryFileLookupAnswerMessage *>(message)) {
+                  return msg->locations;
+                } else {
+                  throw std::runtime_error(
+                          "FileRegistryService::lookupEntryAsync(): Unexpected [" + message->getName() + "] message");
+                }
+              }));
+      this->sendRequestAsynchronously(
+              future.get(),
+              new FileRegistryFileLookupRequestMessage(future->getReplyMailbox(), file,
+                                                       this->getPropertyValueAsDouble(
+                                                               FileRegistryServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+      return future;
+    }
+
     /**
      * @brief Retrieve a list of storage services that hold a file, sorted by increasing network distance from a reference host, according to a network proximity service
      * @param file: the file of interest
@@ -124,12 +156,13 @@ namespace wrench {
         throw std::invalid_argument("FileRegistryService::lookupEntryByProximity(): Invalid argument, host " + reference_host + " does not exist");
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry_by_proximity");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name, new FileRegistryFileLookupByProximityRequestMessage(answer_mailbox, file, reference_host, network_proximity_service,
                                                                                                         this->getPropertyValueAsDouble(
-                                                                                                                FileRegistryServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+                                                                                                                FileRegistryServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -137,7 +170,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -164,13 +197,14 @@ namespace wrench {
         throw std::invalid_argument("FileRegistryService::addEntry(): Invalid  argument");
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("add_entry");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new FileRegistryAddEntryRequestMessage(answer_mailbox, file, storage_service,
                                                                        this->getPropertyValueAsDouble(
-                                                                               FileRegistryServiceProperty::ADD_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
+                                                                               FileRegistryServiceProperty::ADD_ENTRY_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -178,7 +212,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -204,13 +238,14 @@ namespace wrench {
       if ((file == nullptr) || (storage_service == nullptr)) {
         throw std::invalid_argument(" FileRegistryService::removeEntry(): Invalid input argument");
       }
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("remove_entry");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new FileRegistryRemoveEntryRequestMessage(answer_mailbox, file, storage_service,
                                                                           this->getPropertyValueAsDouble(
-                                                                                  FileRegistryServiceProperty::REMOVE_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
+                                                                                  FileRegistryServiceProperty::REMOVE_ENTRY_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -218,7 +253,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -283,7 +318,8 @@ namespace wrench {
         try {
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getPropertyValueAsDouble(
-                                          FileRegistryServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                                          FileRegistryServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)),
+                                  msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
         }
@@ -300,7 +336,8 @@ namespace wrench {
           S4U_Mailbox::dputMessage(msg->answer_mailbox,
                                    new FileRegistryFileLookupAnswerMessage(msg->file, locations,
                                                                            this->getPropertyValueAsDouble(
-                                                                                   FileRegistryServiceProperty::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                   FileRegistryServiceProperty::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
@@ -327,7 +364,8 @@ namespace wrench {
         S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_OVERHEAD));
         try {
           S4U_Mailbox::dputMessage(msg->answer_mailbox, new FileRegistryFileLookupByProximityAnswerMessage(msg->file,
-                                                                                                           msg->reference_host, locations, this->getPropertyValueAsDouble(FileRegistryServiceProperty::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                                           msg->reference_host, locations, this->getPropertyValueAsDouble(FileRegistryServiceProperty::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
@@ -338,7 +376,8 @@ namespace wrench {
         try {
           S4U_Mailbox::dputMessage(msg->answer_mailbox,
                                    new FileRegistryAddEntryAnswerMessage(this->getPropertyValueAsDouble(
-                                           FileRegistryServiceProperty::ADD_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
+                                           FileRegistryServiceProperty::ADD_ENTRY_ANSWER_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
@@ -351,7 +390,8 @@ namespace wrench {
           S4U_Mailbox::dputMessage(msg->answer_mailbox,
                                    new FileRegistryRemoveEntryAnswerMessage(success,
                                                                             this->getPropertyValueAsDouble(
-                                                                                    FileRegistryServiceProperty::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                    FileRegistryServiceProperty::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
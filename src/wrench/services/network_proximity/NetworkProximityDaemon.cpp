@@ -186,7 +186,8 @@ namespace wrench {
         try {
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getPropertyValueAsDouble(
-                                          NetworkProximityServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                                          NetworkProximityServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)),
+                                  msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
         }
@@ -80,13 +80,14 @@ namespace wrench {
 
       WRENCH_INFO("Obtaining current coordinates of network daemon on host %s", requested_host.c_str());
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("network_get_coordinate_entry");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new CoordinateLookupRequestMessage(answer_mailbox, std::move(requested_host),
                                                                    this->getPropertyValueAsDouble(
-                                                                           NetworkProximityServiceProperty::NETWORK_DB_LOOKUP_MESSAGE_PAYLOAD)));
+                                                                           NetworkProximityServiceProperty::NETWORK_DB_LOOKUP_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -94,7 +95,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -127,13 +128,14 @@ namespace wrench {
                     hosts.second.c_str());
       }
 
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("network_query_entry");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new NetworkProximityLookupRequestMessage(answer_mailbox, std::move(hosts),
                                                                          this->getPropertyValueAsDouble(
-                                                                                 NetworkProximityServiceProperty::NETWORK_DB_LOOKUP_MESSAGE_PAYLOAD)));
+                                                                                 NetworkProximityServiceProperty::NETWORK_DB_LOOKUP_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -141,7 +143,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       }
@@ -154,6 +156,32 @@ namespace wrench {
       }
     }
 
+    /**
+     * @brief Asynchronously look up for the proximity value in database
+     * @param hosts: the pair of hosts to look for the proximity value
+     * @return The future proximity value between the pair of hosts
+     *
+     * @throw WorkflowExecutionException
+     */
+    std::unique_ptr<ServiceFuture<double>> NetworkProximityService::queryAsync(std::pair<std::string, std::string> hosts) {
+
+      std::unique_ptr<ServiceFuture<double>> future(new ServiceFuture<double>(
+              [](SimulationMessage *message) -> double {
+                if (auto msg = dynamic_cast<NetworkProximityLookupAnswerMessage *>(message)) {
+                  return msg->proximityValue;
+                } else {
+                  throw std::runtime_error(
+                          "NetworkProximityService::queryAsync(): Unexpected [" + message->getName() + "] message");
+                }
+              }));
+      this->sendRequestAsynchronously(
+              future.get(),
+              new NetworkProximityLookupRequestMessage(future->getReplyMailbox(), std::move(hosts),
+                                                       this->getPropertyValueAsDouble(
+                                                               NetworkProximityServiceProperty::NETWORK_DB_LOOKUP_MESSAGE_PAYLOAD)));
+      return future;
+    }
+
     /**
      * @brief Internal method to add an entry to the database
      * @param pair: a pair of hosts
@@ -249,7 +277,8 @@ namespace wrench {
           this->hosts_in_network.clear();
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getPropertyValueAsDouble(
-                                          NetworkProximityServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                                          NetworkProximityServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)),
+                                  msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
         }
@@ -278,7 +307,8 @@ namespace wrench {
           S4U_Mailbox::dputMessage(msg->answer_mailbox,
                                    new NetworkProximityLookupAnswerMessage(msg->hosts, proximityValue,
                                                                            this->getPropertyValueAsDouble(
-                                                                                   NetworkProximityServiceProperty::NETWORK_DB_LOOKUP_MESSAGE_PAYLOAD)));
+                                                                                   NetworkProximityServiceProperty::NETWORK_DB_LOOKUP_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         }
         catch (std::shared_ptr<NetworkError> &cause) {
           return true;
@@ -328,7 +358,8 @@ namespace wrench {
                                                                                coordinate_itr->second.real(),
                                                                                coordinate_itr->second.imag()),
                                                                        this->getPropertyValueAsDouble(
-                                                                               NetworkProximityServiceProperty::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)));
+                                                                               NetworkProximityServiceProperty::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)),
+                                     msg->correlation_id);
           }
           catch (std::shared_ptr<NetworkError> &cause) {
             return true;
@@ -13,6 +13,7 @@
 #include "services/storage/StorageServiceMessage.h"
 #include "wrench/services/storage/StorageServiceProperty.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simgrid_S4U_util/S4U_PendingCommunication.h"
 #include "wrench/simulation/Simulation.h"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(storage_service, "Log category for Storage Service");
@@ -123,11 +124,12 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("how_much_free_space");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFreeSpaceRequestMessage(
                 answer_mailbox,
-                this->getPropertyValueAsDouble(StorageServiceProperty::FREE_SPACE_REQUEST_MESSAGE_PAYLOAD)));
+                this->getPropertyValueAsDouble(StorageServiceProperty::FREE_SPACE_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -135,7 +137,7 @@ namespace wrench {
       // Wait for a reply
       std::unique_ptr<SimulationMessage> message = nullptr;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -169,12 +171,13 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_file");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFileLookupRequestMessage(
                 answer_mailbox,
                 file,
-                this->getPropertyValueAsDouble(StorageServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+                this->getPropertyValueAsDouble(StorageServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -182,7 +185,7 @@ namespace wrench {
       // Wait for a reply
       std::unique_ptr<SimulationMessage> message;
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -194,6 +197,73 @@ namespace wrench {
       }
     }
 
+    /**
+     * @brief Asynchronously asks the storage service for its capacity
+     *
+     * @return the future free space in bytes
+     *
+     * @throw WorkflowExecutionException
+     */
+    std::unique_ptr<ServiceFuture<double>> StorageService::howMuchFreeSpaceAsync() {
+      if (this->state == DOWN) {
+        throw WorkflowExecutionException(new ServiceIsDown(this));
+      }
+
+      std::unique_ptr<ServiceFuture<double>> future(new ServiceFuture<double>(
+              [](SimulationMessage *message) -> double {
+                if (auto msg = dynamic_cast<StorageServiceFreeSpaceAnswerMessage *>(message)) {
+                  return msg->free_space;
+                } else {
+                  throw std::runtime_error(
+                          "StorageService::howMuchFreeSpaceAsync(): Unexpected [" + message->getName() + "] message");
+                }
+              }));
+      this->sendRequestAsynchronously(
+              future.get(),
+              new StorageServiceFreeSpaceRequestMessage(
+                      future->getReplyMailbox(),
+                      this->getPropertyValueAsDouble(StorageServiceProperty::FREE_SPACE_REQUEST_MESSAGE_PAYLOAD)));
+      return future;
+    }
+
+    /**
+     * @brief Asynchronously asks the storage service whether it holds a file
+     *
+     * @param file: the file
+     *
+     * @return the future true or false
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::invalid_arguments
+     */
+    std::unique_ptr<ServiceFuture<bool>> StorageService::lookupFileAsync(WorkflowFile *file) {
+
+      if (file == nullptr) {
+        throw std::invalid_argument("StorageService::lookupFileAsync(): Invalid arguments");
+      }
+
+      if (this->state == DOWN) {
+        throw WorkflowExecutionException(new ServiceIsDown(this));
+      }
+
+      std::unique_ptr<ServiceFuture<bool>> future(new ServiceFuture<bool>(
+              [](SimulationMessage *message) -> bool {
+                if (auto msg = dynamic_cast<StorageServiceFileLookupAnswerMessage *>(message)) {
+                  return msg->file_is_available;
+                } else {
+                  throw std::runtime_error(
+                          "StorageService::lookupFileAsync(): Unexpected [" + message->getName() + "] message");
+                }
+              }));
+      this->sendRequestAsynchronously(
+              future.get(),
+              new StorageServiceFileLookupRequestMessage(
+                      future->getReplyMailbox(),
+                      file,
+                      this->getPropertyValueAsDouble(StorageServiceProperty::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+      return future;
+    }
+
     /**
      * @brief Synchronously read a file from the storage service
      *
@@ -213,15 +283,18 @@ namespace wrench {
         throw WorkflowExecutionException(new ServiceIsDown(this));
       }
 
+      this->simulation->output.addTimestamp<SimulationTimestampFileReadStart>(file, this);
+
       // Send a synchronous message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("read_file");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new StorageServiceFileReadRequestMessage(answer_mailbox,
                                                                          answer_mailbox,
                                                                          file,
                                                                          this->getPropertyValueAsDouble(
-                                                                                 StorageServiceProperty::FILE_READ_REQUEST_MESSAGE_PAYLOAD)));
+                                                                                 StorageServiceProperty::FILE_READ_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       } catch (std::shared_ptr<FatalFailure> &cause) {
@@ -232,7 +305,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       } catch (std::shared_ptr<FatalFailure> &cause) {
@@ -249,7 +322,7 @@ namespace wrench {
         // Otherwise, retrieve  the file
         std::unique_ptr<SimulationMessage> file_content_message = nullptr;
         try {
-          file_content_message = S4U_Mailbox::getMessage(answer_mailbox);
+          file_content_message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           WRENCH_INFO("Network Error while getting a file content");
           throw WorkflowExecutionException(cause);
@@ -259,7 +332,7 @@ namespace wrench {
         }
 
         if (auto file_content_msg = dynamic_cast<StorageServiceFileContentMessage *>(file_content_message.get())) {
-          // do nothing
+          this->simulation->output.addTimestamp<SimulationTimestampFileReadCompletion>(file, this);
         } else {
           throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
                                    file_content_message->getName() + "] message!");
@@ -290,14 +363,17 @@ namespace wrench {
         throw WorkflowExecutionException(new ServiceIsDown(this));
       }
 
+      this->simulation->output.addTimestamp<SimulationTimestampFileWriteStart>(file, this);
+
       // Send a synchronous message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("write_file");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
                                 new StorageServiceFileWriteRequestMessage(answer_mailbox,
                                                                           file,
                                                                           this->getPropertyValueAsDouble(
-                                                                                  StorageServiceProperty::FILE_WRITE_REQUEST_MESSAGE_PAYLOAD)));
+                                                                                  StorageServiceProperty::FILE_WRITE_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       } catch (std::exception &e) {
@@ -309,7 +385,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -326,6 +402,7 @@ namespace wrench {
         } catch (FailureCause &cause) {
           throw WorkflowExecutionException(&cause);
         }
+        this->simulation->output.addTimestamp<SimulationTimestampFileWriteCompletion>(file, this);
 
       } else {
         throw std::runtime_error("StorageService::writeFile(): Received an unexpected [" +
@@ -334,21 +411,24 @@ namespace wrench {
     }
 
     /**
-     * @brief Synchronously and sequentially read a set of files from storage services
+     * @brief Synchronously read a set of files from storage services
      *
      * @param files: the set of files to read
      * @param file_locations: a map of files to storage services
      * @param default_storage_service: the storage service to use when files don't appear in the file_locations map
-     * @return nullptr on success, or a workflow execution failure cause on failure
+     * @param max_num_concurrent_transfers: the maximum number of files being read at once (1 means one after the other)
      *
+     * @throw std::invalid_argument
      * @throw std::runtime_error
      * @throw WorkflowExecutionException
      */
-    void StorageService::readFiles(std::set<WorkflowFile *> files,
-                                   std::map<WorkflowFile *, StorageService *> file_locations,
-                                   StorageService *default_storage_service) {
+    void StorageService::readFiles(const std::set<WorkflowFile *> &files,
+                                   const std::map<WorkflowFile *, StorageService *> &file_locations,
+                                   StorageService *default_storage_service,
+                                   unsigned long max_num_concurrent_transfers) {
       try {
-        StorageService::writeOrReadFiles(READ, std::move(files), std::move(file_locations), default_storage_service);
+        StorageService::writeOrReadFiles(READ, files, file_locations, default_storage_service,
+                                         max_num_concurrent_transfers);
       } catch (std::runtime_error &e) {
         throw;
       } catch (WorkflowExecutionException &e) {
@@ -357,21 +437,24 @@ namespace wrench {
     }
 
     /**
-     * @brief Synchronously and sequentially uppload a set of files from storage services
+     * @brief Synchronously uppload a set of files to storage services
      *
      * @param files: the set of files to write
      * @param file_locations: a map of files to storage services
      * @param default_storage_service: the storage service to use when files don't appear in the file_locations map
-     * @return nullptr on success, or a workflow execution failure cause on failure
+     * @param max_num_concurrent_transfers: the maximum number of files being written at once (1 means one after the other)
      *
+     * @throw std::invalid_argument
      * @throw std::runtime_error
      * @throw WorkflowExecutionException
      */
-    void StorageService::writeFiles(std::set<WorkflowFile *> files,
-                                    std::map<WorkflowFile *, StorageService *> file_locations,
-                                    StorageService *default_storage_service) {
+    void StorageService::writeFiles(const std::set<WorkflowFile *> &files,
+                                    const std::map<WorkflowFile *, StorageService *> &file_locations,
+                                    StorageService *default_storage_service,
+                                    unsigned long max_num_concurrent_transfers) {
       try {
-        StorageService::writeOrReadFiles(WRITE, std::move(files), std::move(file_locations), default_storage_service);
+        StorageService::writeOrReadFiles(WRITE, files, file_locations, default_storage_service,
+                                         max_num_concurrent_transfers);
       } catch (std::runtime_error &e) {
         throw;
       } catch (WorkflowExecutionException &e) {
@@ -380,21 +463,27 @@ namespace wrench {
     }
 
     /**
-     * @brief Synchronously and sequentially write/read a set of files to/from storage services
+     * @brief Synchronously write/read a set of files to/from storage services
      *
      * @param action: DONWLOAD or WRITE
      * @param files: the set of files to read/write
      * @param file_locations: a map of files to storage services
      * @param default_storage_service: the storage service to use when files don't appear in the file_locations map
+     * @param max_num_concurrent_transfers: the maximum number of files being read/written at once (1 means one after the other)
      *
+     * @throw std::invalid_argument
      * @throw std::runtime_error
      * @throw WorkflowExecutionException
      */
     void StorageService::writeOrReadFiles(FileOperation action,
-                                          std::set<WorkflowFile *> files,
-                                          std::map<WorkflowFile *, StorageService *> file_locations,
-                                          StorageService *default_storage_service) {
+                                          const std::set<WorkflowFile *> &files,
+                                          const std::map<WorkflowFile *, StorageService *> &file_locations,
+                                          StorageService *default_storage_service,
+                                          unsigned long max_num_concurrent_transfers) {
 
+      if (max_num_concurrent_transfers < 1) {
+        throw std::invalid_argument("StorageService::writeOrReadFiles(): invalid maximum number of concurrent transfers");
+      }
       for (auto const &f : files) {
         if (f == nullptr) {
           throw std::invalid_argument("StorageService::writeOrReadFiles(): invalid files argument");
@@ -405,12 +494,20 @@ namespace wrench {
           throw std::invalid_argument("StorageService::writeOrReadFiles(): invalid file location argument");
         }
       }
+
+      if ((max_num_concurrent_transfers > 1) and (files.size() > 1)) {
+        StorageService::writeOrReadFilesConcurrently(action, files, file_locations, default_storage_service,
+                                                     max_num_concurrent_transfers);
+        return;
+      }
+
       for (auto const &f : files) {
 
         // Identify the Storage Service
         StorageService *storage_service = default_storage_service;
-        if (file_locations.find(f) != file_locations.end()) {
-          storage_service = file_locations[f];
+        auto location = file_locations.find(f);
+        if (location != file_locations.end()) {
+          storage_service = location->second;
         }
         if (storage_service == nullptr) {
           throw WorkflowExecutionException(new NoStorageServiceForFile(f));
@@ -440,6 +537,238 @@ namespace wrench {
       }
     }
 
+    /**
+     * @brief Synchronously write/read a set of files to/from storage services, with up to a given
+     *        number of file transfers in progress at once. Each transfer goes through the same
+     *        request/answer/file content exchange with its storage service as readFile() and
+     *        writeFile(), with its own correlation id on the calling actor's reply mailbox, so that
+     *        the calling actor waits for whichever transfer makes progress first. After a failure no
+     *        new transfer is started, and the transfers in progress are completed before the
+     *        first failure is reported.
+     *
+     * @param action: READ or WRITE
+     * @param files: the set of files to read/write
+     * @param file_locations: a map of files to storage services
+     * @param default_storage_service: the storage service to use when files don't appear in the file_locations map
+     * @param max_num_concurrent_transfers: the maximum number of files being read/written at once
+     *
+     * @throw std::runtime_error
+     * @throw WorkflowExecutionException
+     */
+    void StorageService::writeOrReadFilesConcurrently(FileOperation action,
+                                                      const std::set<WorkflowFile *> &files,
+                                                      const std::map<WorkflowFile *, StorageService *> &file_locations,
+                                                      StorageService *default_storage_service,
+                                                      unsigned long max_num_concurrent_transfers) {
+
+      /** @brief A file transfer in progress */
+      struct Transfer {
+          WorkflowFile *file;
+          StorageService *storage_service;
+          /** @brief Whether the storage service has accepted the request */
+          bool accepted;
+          /** @brief The file content communication, once a write request has been accepted
+           *         (a transfer without one waits for a reply) */
+          std::unique_ptr<S4U_PendingCommunication> pending_communication;
+      };
+
+      std::string reply_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      // The transfers in progress, by correlation id
+      std::map<unsigned long, std::unique_ptr<Transfer>> transfers;
+      // The reception posted on the reply mailbox, if any (there is one as long as a transfer waits for a reply)
+      std::unique_ptr<S4U_PendingCommunication> pending_reply;
+      std::shared_ptr<FailureCause> failure_cause = nullptr;
+      auto next_file = files.begin();
+
+      while (true) {
+
+        // Start new transfers, if possible
+        while ((failure_cause == nullptr) and (next_file != files.end()) and
+               (transfers.size() < max_num_concurrent_transfers)) {
+          WorkflowFile *f = *(next_file++);
+
+          // Identify the Storage Service
+          StorageService *storage_service = default_storage_service;
+          auto location = file_locations.find(f);
+          if (location != file_locations.end()) {
+            storage_service = location->second;
+          }
+          if (storage_service == nullptr) {
+            failure_cause = std::shared_ptr<FailureCause>(new NoStorageServiceForFile(f));
+            break;
+          }
+          if (storage_service->state == DOWN) {
+            failure_cause = std::shared_ptr<FailureCause>(new ServiceIsDown(storage_service));
+            break;
+          }
+
+          SimulationMessage *request;
+          if (action == READ) {
+            WRENCH_INFO("Reading file %s from storage service %s", f->getId().c_str(), storage_service->getName().c_str());
+            storage_service->simulation->output.addTimestamp<SimulationTimestampFileReadStart>(f, storage_service);
+            request = new StorageServiceFileReadRequestMessage(
+                    reply_mailbox, reply_mailbox, f,
+                    storage_service->getPropertyValueAsDouble(StorageServiceProperty::FILE_READ_REQUEST_MESSAGE_PAYLOAD));
+          } else {
+            WRENCH_INFO("Writing file %s to storage service %s", f->getId().c_str(), storage_service->getName().c_str());
+            storage_service->simulation->output.addTimestamp<SimulationTimestampFileWriteStart>(f, storage_service);
+            request = new StorageServiceFileWriteRequestMessage(
+                    reply_mailbox, f,
+                    storage_service->getPropertyValueAsDouble(StorageServiceProperty::FILE_WRITE_REQUEST_MESSAGE_PAYLOAD));
+          }
+
+          unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
+          try {
+            S4U_Mailbox::dputMessage(storage_service->mailbox_name, request, correlation_id);
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            failure_cause = cause;
+            break;
+          } catch (std::shared_ptr<FatalFailure> &cause) {
+            failure_cause = cause;
+            break;
+          }
+
+          std::unique_ptr<Transfer> transfer = std::unique_ptr<Transfer>(new Transfer());
+          transfer->file = f;
+          transfer->storage_service = storage_service;
+          transfer->accepted = false;
+          transfers.insert(std::make_pair(correlation_id, std::move(transfer)));
+        }
+
+        if (transfers.empty()) {
+          break;
+        }
+
+        // Wait for a reply, or for a file content communication to complete
+        std::vector<S4U_PendingCommunication *> pending_communications;
+        std::vector<unsigned long> correlation_ids; // (0 for the reply reception)
+        for (auto const &t : transfers) {
+          if (t.second->pending_communication) {
+            pending_communications.push_back(t.second->pending_communication.get());
+            correlation_ids.push_back(t.first);
+          } else if (not pending_reply) {
+            pending_reply = S4U_Mailbox::igetMessage(reply_mailbox);
+          }
+        }
+        if (pending_reply) {
+          pending_communications.push_back(pending_reply.get());
+          correlation_ids.push_back(0);
+        }
+        unsigned long index = S4U_PendingCommunication::waitForSomethingToHappen(pending_communications, -1);
+        if (index >= pending_communications.size()) {
+          throw std::runtime_error("StorageService::writeOrReadFilesConcurrently(): Couldn't identify the communication that failed");
+        }
+
+        // A file content communication (of a write) has completed
+        if (correlation_ids[index] != 0) {
+          auto t = transfers.find(correlation_ids[index]);
+          try {
+            t->second->pending_communication->wait();
+            t->second->storage_service->simulation->output.addTimestamp<SimulationTimestampFileWriteCompletion>(
+                    t->second->file, t->second->storage_service);
+            WRENCH_INFO("Wrote file %s", t->second->file->getId().c_str());
+          } catch (std::shared_ptr<NetworkError> &cause) {
+            if (failure_cause == nullptr) {
+              failure_cause = cause;
+            }
+          } catch (std::shared_ptr<FatalFailure> &cause) {
+            if (failure_cause == nullptr) {
+              failure_cause = cause;
+            }
+          }
+          transfers.erase(t);
+          continue;
+        }
+
+        // A reply has arrived
+        std::unique_ptr<SimulationMessage> message;
+        try {
+          message = pending_reply->wait();
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          message = nullptr;
+          if (failure_cause == nullptr) {
+            failure_cause = cause;
+          }
+        } catch (std::shared_ptr<FatalFailure> &cause) {
+          message = nullptr;
+          if (failure_cause == nullptr) {
+            failure_cause = cause;
+          }
+        }
+        pending_reply = nullptr;
+
+        if (message == nullptr) {
+          // The transfers that wait for a reply are over (their replies, if any, will be discarded)
+          for (auto t = transfers.begin(); t != transfers.end();) {
+            t = (t->second->pending_communication ? std::next(t) : transfers.erase(t));
+          }
+          continue;
+        }
+
+        auto t = transfers.find(message->correlation_id);
+        if (t == transfers.end()) {
+          // A reply to another request of the calling actor
+          S4U_Mailbox::routeReply(std::move(message));
+          continue;
+        }
+        Transfer *transfer = t->second.get();
+
+        // Move the transfer to its next stage, if any
+        bool transfer_is_over = false;
+        try {
+          if (not transfer->accepted) {
+            if (auto msg = dynamic_cast<StorageServiceFileReadAnswerMessage *>(message.get())) {
+              if (not msg->success) {
+                throw WorkflowExecutionException(msg->failure_cause);
+              }
+            } else if (auto msg = dynamic_cast<StorageServiceFileWriteAnswerMessage *>(message.get())) {
+              if (not msg->success) {
+                throw WorkflowExecutionException(msg->failure_cause);
+              }
+              transfer->pending_communication = S4U_Mailbox::iputMessage(
+                      msg->data_write_mailbox_name, new StorageServiceFileContentMessage(transfer->file));
+            } else {
+              throw std::runtime_error("StorageService::writeOrReadFilesConcurrently(): Received an unexpected [" +
+                                       message->getName() + "] message!");
+            }
+            transfer->accepted = true;
+          } else {
+            if (not dynamic_cast<StorageServiceFileContentMessage *>(message.get())) {
+              throw std::runtime_error("StorageService::writeOrReadFilesConcurrently(): Received an unexpected [" +
+                                       message->getName() + "] message!");
+            }
+            transfer->storage_service->simulation->output.addTimestamp<SimulationTimestampFileReadCompletion>(
+                    transfer->file, transfer->storage_service);
+            WRENCH_INFO("File %s read", transfer->file->getId().c_str());
+            transfer_is_over = true;
+          }
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          if (failure_cause == nullptr) {
+            failure_cause = cause;
+          }
+          transfer_is_over = true;
+        } catch (std::shared_ptr<FatalFailure> &cause) {
+          if (failure_cause == nullptr) {
+            failure_cause = cause;
+          }
+          transfer_is_over = true;
+        } catch (WorkflowExecutionException &e) {
+          if (failure_cause == nullptr) {
+            failure_cause = e.getCause();
+          }
+          transfer_is_over = true;
+        }
+
+        if (transfer_is_over) {
+          transfers.erase(t);
+        }
+      }
+
+      if (failure_cause != nullptr) {
+        throw WorkflowExecutionException(failure_cause);
+      }
+    }
+
     /**
      * @brief Synchronously asks the storage service to delete a file copy
      *
@@ -460,12 +789,13 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("delete_file");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFileDeleteRequestMessage(
                 answer_mailbox,
                 file,
-                this->getPropertyValueAsDouble(StorageServiceProperty::FILE_DELETE_REQUEST_MESSAGE_PAYLOAD)));
+                this->getPropertyValueAsDouble(StorageServiceProperty::FILE_DELETE_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -474,7 +804,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -500,14 +830,15 @@ namespace wrench {
      * @throw WorkflowExecutionException
      * @throw std::runtime_error
      */
-    void StorageService::deleteFiles(std::set<WorkflowFile *> files,
-                                     std::map<WorkflowFile *, StorageService *> file_locations,
+    void StorageService::deleteFiles(const std::set<WorkflowFile *> &files,
+                                     const std::map<WorkflowFile *, StorageService *> &file_locations,
                                      StorageService *default_storage_service) {
-      for (auto f : files) {
+      for (auto const &f : files) {
         // Identify the Storage Service
         StorageService *storage_service = default_storage_service;
-        if (file_locations.find(f) != file_locations.end()) {
-          storage_service = file_locations[f];
+        auto location = file_locations.find(f);
+        if (location != file_locations.end()) {
+          storage_service = location->second;
         }
         if (storage_service == nullptr) {
           throw WorkflowExecutionException(new NoStorageServiceForFile(f));
@@ -550,13 +881,14 @@ namespace wrench {
       }
 
       // Send a message to the daemon
-      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("copy_file");
+      std::string answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
       try {
         S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFileCopyRequestMessage(
                 answer_mailbox,
                 file,
                 src,
-                this->getPropertyValueAsDouble(StorageServiceProperty::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)));
+                this->getPropertyValueAsDouble(StorageServiceProperty::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       } catch (std::shared_ptr<FatalFailure> &cause) {
@@ -567,7 +899,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(answer_mailbox);
+        message = S4U_Mailbox::getReply(answer_mailbox, correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         throw WorkflowExecutionException(cause);
       } catch (std::shared_ptr<FatalFailure> &cause) {
@@ -648,7 +980,8 @@ namespace wrench {
       }
 
       // Send a synchronous message to the daemon
-      std::string request_answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("read_file");
+      std::string request_answer_mailbox = S4U_Mailbox::generateReplyMailboxName();
+      unsigned long correlation_id = S4U_Mailbox::generateCorrelationId();
 
       try {
         S4U_Mailbox::putMessage(this->mailbox_name,
@@ -656,7 +989,7 @@ namespace wrench {
                                                                          mailbox_that_should_receive_file_content,
                                                                          file,
                                                                          this->getPropertyValueAsDouble(
-                                                                                 StorageServiceProperty::FILE_READ_REQUEST_MESSAGE_PAYLOAD)));
+                                                                                 StorageServiceProperty::FILE_READ_REQUEST_MESSAGE_PAYLOAD)), correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -666,7 +999,7 @@ namespace wrench {
       std::unique_ptr<SimulationMessage> message = nullptr;
 
       try {
-        message = S4U_Mailbox::getMessage(request_answer_mailbox);
+        message = S4U_Mailbox::getReply(request_answer_mailbox, correlation_id);
       } catch (FailureCause &cause) {
         throw WorkflowExecutionException(&cause);
       }
@@ -306,4 +306,12 @@ namespace wrench {
       this->file = file;
     }
 
+    /**
+     * @brief Determine whether the message is a control message
+     * @return false (file contents are data)
+     */
+    bool StorageServiceFileContentMessage::isControlMessage() {
+      return false;
+    }
+
 };
@@ -232,6 +232,8 @@ namespace wrench {
     public:
         StorageServiceFileContentMessage(WorkflowFile *file);
 
+        bool isControlMessage() override;
+
         /** @brief The file */
         WorkflowFile *file;
     };
@@ -71,7 +71,7 @@ namespace wrench {
                     this->file->getId().c_str(), this->mailbox.c_str() );
           try {
             this->comm = S4U_Mailbox::iputMessage(this->mailbox, new
-                    StorageServiceFileContentMessage(this->file));
+                    StorageServiceFileContentMessage(this->file), this->correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             WRENCH_INFO("NetworkConnection::start(): got a NetworkError... giving up");
             return false;
@@ -97,6 +97,10 @@ namespace wrench {
      * @return true if failed
      */
     bool NetworkConnection::hasFailed() {
+      // The communication was completed in memory
+      if (this->comm->comm_ptr == nullptr) {
+        return false;
+      }
       try {
         this->comm->comm_ptr->test();
       } catch (xbt_ex &e) {
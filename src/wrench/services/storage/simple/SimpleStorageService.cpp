@@ -18,6 +18,7 @@
 #include "wrench/workflow/WorkflowFile.h"
 #include "wrench/exceptions/WorkflowExecutionException.h"
 #include "wrench/services/storage/simple/NetworkConnectionManager.h"
+#include "wrench/simulation/Simulation.h"
 
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(simple_storage_service, "Log category for Simple Storage Service");
@@ -171,7 +172,8 @@ namespace wrench {
         try {
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getPropertyValueAsDouble(
-                                          SimpleStorageServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                                          SimpleStorageServiceProperty::DAEMON_STOPPED_MESSAGE_PAYLOAD)),
+                                  msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
         }
@@ -183,7 +185,8 @@ namespace wrench {
         try {
           S4U_Mailbox::dputMessage(msg->answer_mailbox,
                                    new StorageServiceFreeSpaceAnswerMessage(free_space, this->getPropertyValueAsDouble(
-                                           SimpleStorageServiceProperty::FREE_SPACE_ANSWER_MESSAGE_PAYLOAD)));
+                                           SimpleStorageServiceProperty::FREE_SPACE_ANSWER_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return false;
         }
@@ -208,7 +211,8 @@ namespace wrench {
                                                                              success,
                                                                              failure_cause,
                                                                              this->getPropertyValueAsDouble(
-                                                                                     SimpleStorageServiceProperty::FILE_DELETE_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                     SimpleStorageServiceProperty::FILE_DELETE_ANSWER_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
@@ -222,7 +226,8 @@ namespace wrench {
           S4U_Mailbox::dputMessage(msg->answer_mailbox,
                                    new StorageServiceFileLookupAnswerMessage(msg->file, file_found,
                                                                              this->getPropertyValueAsDouble(
-                                                                                     SimpleStorageServiceProperty::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                     SimpleStorageServiceProperty::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)),
+                                   msg->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
@@ -231,15 +236,16 @@ namespace wrench {
 
       } else if (auto msg = dynamic_cast<StorageServiceFileWriteRequestMessage *>(message.get())) {
 
-        return processFileWriteRequest(msg->file, msg->answer_mailbox);
+        return processFileWriteRequest(msg->file, msg->answer_mailbox, msg->correlation_id);
 
       } else if (auto msg = dynamic_cast<StorageServiceFileReadRequestMessage *>(message.get())) {
 
-        return processFileReadRequest(msg->file, msg->answer_mailbox, msg->mailbox_to_receive_the_file_content);
+        return processFileReadRequest(msg->file, msg->answer_mailbox, msg->mailbox_to_receive_the_file_content,
+                                      msg->correlation_id);
 
       } else if (auto msg = dynamic_cast<StorageServiceFileCopyRequestMessage *>(message.get())) {
 
-        return processFileCopyRequest(msg->file, msg->src, msg->answer_mailbox);
+        return processFileCopyRequest(msg->file, msg->src, msg->answer_mailbox, msg->correlation_id);
 
       } else {
         throw std::runtime_error(
@@ -252,9 +258,11 @@ namespace wrench {
      *
      * @param file: the file to write
      * @param answer_mailbox: the mailbox to which the reply should be sent
+     * @param correlation_id: the id of the request/reply exchange
      * @return true if this process should keep running
      */
-    bool SimpleStorageService::processFileWriteRequest(WorkflowFile *file, std::string answer_mailbox) {
+    bool SimpleStorageService::processFileWriteRequest(WorkflowFile *file, std::string answer_mailbox,
+                                                       unsigned long correlation_id) {
 
       // If the file is already there, send back a failure
 //      if (this->stored_files.find(file) != this->stored_files.end()) {
@@ -294,7 +302,8 @@ namespace wrench {
                                                                                              this)),
                                                                              "",
                                                                              this->getPropertyValueAsDouble(
-                                                                                     SimpleStorageServiceProperty::FILE_WRITE_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                     SimpleStorageServiceProperty::FILE_WRITE_ANSWER_MESSAGE_PAYLOAD)),
+                                    correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return true;
           }
@@ -317,7 +326,8 @@ namespace wrench {
                                                                          nullptr,
                                                                          file_reception_mailbox,
                                                                          this->getPropertyValueAsDouble(
-                                                                                 SimpleStorageServiceProperty::FILE_WRITE_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                 SimpleStorageServiceProperty::FILE_WRITE_ANSWER_MESSAGE_PAYLOAD)),
+                                correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -334,10 +344,12 @@ namespace wrench {
      * @param file: the file
      * @param answer_mailbox: the mailbox to which the answer should be sent
      * @param mailbox_to_receive_the_file_content: the mailbox to which the file will be sent
+     * @param correlation_id: the id of the request/reply exchange
      * @return
      */
     bool SimpleStorageService::processFileReadRequest(WorkflowFile *file, std::string answer_mailbox,
-                                                      std::string mailbox_to_receive_the_file_content) {
+                                                      std::string mailbox_to_receive_the_file_content,
+                                                      unsigned long correlation_id) {
 
       // Figure out whether this succeeds or not
       bool success = true;
@@ -355,7 +367,8 @@ namespace wrench {
         S4U_Mailbox::dputMessage(answer_mailbox,
                                  new StorageServiceFileReadAnswerMessage(file, this, success, failure_cause,
                                                                          this->getPropertyValueAsDouble(
-                                                                                 SimpleStorageServiceProperty::FILE_READ_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                 SimpleStorageServiceProperty::FILE_READ_ANSWER_MESSAGE_PAYLOAD)),
+                                 correlation_id);
       } catch (std::shared_ptr<NetworkError> &cause) {
         return true;
       }
@@ -363,9 +376,10 @@ namespace wrench {
 
       // If success, then follow up with sending the file (ASYNCHRONOUSLY!)
       if (success) {
-        this->network_connection_manager->addConnection(std::unique_ptr<NetworkConnection>(
-                new NetworkConnection(NetworkConnection::OUTGOING_DATA, file, mailbox_to_receive_the_file_content, "")
-        ));
+        std::unique_ptr<NetworkConnection> connection = std::unique_ptr<NetworkConnection>(
+                new NetworkConnection(NetworkConnection::OUTGOING_DATA, file, mailbox_to_receive_the_file_content, ""));
+        connection->correlation_id = correlation_id;
+        this->network_connection_manager->addConnection(std::move(connection));
       }
 
       return true;
@@ -376,10 +390,12 @@ namespace wrench {
      * @param file: the file
      * @param src: the storage service that holds the file
      * @param answer_mailbox: the mailbox to which the answer should be sent
+     * @param correlation_id: the id of the request/reply exchange
      * @return
      */
     bool
-    SimpleStorageService::processFileCopyRequest(WorkflowFile *file, StorageService *src, std::string answer_mailbox) {
+    SimpleStorageService::processFileCopyRequest(WorkflowFile *file, StorageService *src, std::string answer_mailbox,
+                                                 unsigned long correlation_id) {
 
 //      // If the file is already here, send back a failure
 //      if (this->stored_files.find(file) != this->stored_files.end()) {
@@ -418,7 +434,8 @@ namespace wrench {
                                                                                             file,
                                                                                             this)),
                                                                             this->getPropertyValueAsDouble(
-                                                                                    SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                    SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)),
+                                    correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return true;
           }
@@ -433,6 +450,8 @@ namespace wrench {
                   file->getId().c_str(),
                   src->getName().c_str());
 
+      this->simulation->output.addTimestamp<SimulationTimestampFileCopyStart>(file, src, this);
+
       // Create a unique mailbox_name on which to receive the file
       std::string file_reception_mailbox = S4U_Mailbox::generateUniqueMailboxName("file_reception");
 
@@ -444,16 +463,19 @@ namespace wrench {
           S4U_Mailbox::putMessage(answer_mailbox,
                                   new StorageServiceFileCopyAnswerMessage(file, this, false, e.getCause(),
                                                                           this->getPropertyValueAsDouble(
-                                                                                  SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                  SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)),
+                                  correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
       }
 
 
-      this->network_connection_manager->addConnection(std::unique_ptr<NetworkConnection>(
-              new NetworkConnection(NetworkConnection::INCOMING_DATA, file, file_reception_mailbox, answer_mailbox)
-      ));
+      std::unique_ptr<NetworkConnection> connection = std::unique_ptr<NetworkConnection>(
+              new NetworkConnection(NetworkConnection::INCOMING_DATA, file, file_reception_mailbox, answer_mailbox));
+      connection->src = src;
+      connection->correlation_id = correlation_id;
+      this->network_connection_manager->addConnection(std::move(connection));
 
       return true;
     }
@@ -497,7 +519,8 @@ namespace wrench {
           S4U_Mailbox::putMessage(connection->ack_mailbox,
                                   new StorageServiceFileCopyAnswerMessage(connection->file, this, false, connection->failure_cause,
                                                                           this->getPropertyValueAsDouble(
-                                                                                  SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                  SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)),
+                                  connection->correlation_id);
         } catch (std::shared_ptr<NetworkError> &cause) {
           return true;
         }
@@ -518,13 +541,16 @@ namespace wrench {
 
         // Send back the corresponding ack?
         if (not connection->ack_mailbox.empty()) {
+          this->simulation->output.addTimestamp<SimulationTimestampFileCopyCompletion>(connection->file,
+                                                                                       connection->src, this);
           WRENCH_INFO(
                   "Sending back an ack since this was a file copy and some client is waiting for me to say something");
           try {
             S4U_Mailbox::putMessage(connection->ack_mailbox,
                                     new StorageServiceFileCopyAnswerMessage(connection->file, this, true, nullptr,
                                                                             this->getPropertyValueAsDouble(
-                                                                                    SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)));
+                                                                                    SimpleStorageServiceProperty::FILE_COPY_ANSWER_MESSAGE_PAYLOAD)),
+                                    connection->correlation_id);
           } catch (std::shared_ptr<NetworkError> &cause) {
             return true;
           }
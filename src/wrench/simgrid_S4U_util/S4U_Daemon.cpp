@@ -21,6 +21,8 @@ XBT_LOG_NEW_DEFAULT_CATEGORY(s4u_daemon, "Log category for S4U_Daemon");
 
 namespace wrench {
 
+    unsigned long S4U_Daemon::num_started_daemons = 0;
+
     /**
      * @brief Constructor (daemon with a mailbox)
      *
@@ -113,6 +115,7 @@ namespace wrench {
         // Some internal SimGrid exceptions...
         std::abort();
       }
+      S4U_Daemon::num_started_daemons++;
 
       if (daemonized) {
         this->s4u_actor->daemonize();
@@ -198,4 +201,13 @@ namespace wrench {
       this->simulation = simulation;
     }
 
+    /**
+     * @brief Get the number of daemons (i.e., S4U actors) started so far
+     *
+     * @return a number of daemons
+     */
+    unsigned long S4U_Daemon::getNumStartedDaemons() {
+      return S4U_Daemon::num_started_daemons;
+    }
+
 };
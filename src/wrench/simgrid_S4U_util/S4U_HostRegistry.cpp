@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <stdexcept>
+
+#include "wrench/simgrid_S4U_util/S4U_HostRegistry.h"
+#include "wrench/simgrid_S4U_util/S4U_Simulation.h"
+
+namespace wrench {
+
+    constexpr unsigned long S4U_HostRegistry::NO_HOST;
+
+    std::deque<S4U_HostRegistry::HostAttributes> S4U_HostRegistry::hosts;
+    std::unordered_map<std::string, unsigned long> S4U_HostRegistry::host_ids;
+
+    /**
+     * @brief Build the registry, assigning ids to hosts in list order
+     *        and caching their attributes
+     *
+     * @param hosts: the list of hosts
+     */
+    void S4U_HostRegistry::build(const std::vector<simgrid::s4u::Host *> &hosts) {
+
+      S4U_HostRegistry::clear();
+      S4U_HostRegistry::host_ids.reserve(hosts.size());
+
+      for (auto const &host : hosts) {
+        S4U_HostRegistry::registerHost(host);
+      }
+    }
+
+    /**
+     * @brief Add a host to the registry, with the next id
+     *
+     * @param host: the host
+     * @return the host's id
+     */
+    unsigned long S4U_HostRegistry::registerHost(simgrid::s4u::Host *host) {
+      HostAttributes attributes;
+      attributes.hostname = host->getName();
+      attributes.host = host;
+      attributes.num_cores = (unsigned int) host->getCoreCount();
+      attributes.flop_rate = host->getPstateSpeed(0);
+      attributes.memory_capacity = 0.0;
+      try {
+        attributes.memory_capacity = S4U_Simulation::getHostMemoryCapacity(host);
+      } catch (std::invalid_argument &e) {
+        attributes.memory_capacity_error = e.what();
+      }
+      unsigned long host_id = S4U_HostRegistry::hosts.size();
+      S4U_HostRegistry::host_ids[attributes.hostname] = host_id;
+      S4U_HostRegistry::hosts.push_back(std::move(attributes));
+      return host_id;
+    }
+
+    /**
+     * @brief Empty the registry
+     */
+    void S4U_HostRegistry::clear() {
+      S4U_HostRegistry::hosts.clear();
+      S4U_HostRegistry::host_ids.clear();
+    }
+
+    /**
+     * @brief Get the number of hosts in the registry
+     *
+     * @return a number of hosts
+     */
+    unsigned long S4U_HostRegistry::getNumHosts() {
+      return S4U_HostRegistry::hosts.size();
+    }
+
+    /**
+     * @brief Get the id of a host, if it is in the registry
+     *
+     * @param hostname: the host's name
+     * @return the host's id, or S4U_HostRegistry::NO_HOST if the host is not in the registry
+     */
+    unsigned long S4U_HostRegistry::findHostId(const std::string &hostname) {
+      auto it = S4U_HostRegistry::host_ids.find(hostname);
+      if (it == S4U_HostRegistry::host_ids.end()) {
+        return S4U_HostRegistry::NO_HOST;
+      }
+      return it->second;
+    }
+
+    /**
+     * @brief Get the id of a host, registering the host if it was created after the
+     *        registry was built
+     *
+     * @param hostname: the host's name
+     * @return the host's id
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned long S4U_HostRegistry::getHostId(const std::string &hostname) {
+      unsigned long host_id = S4U_HostRegistry::findHostId(hostname);
+      if (host_id == S4U_HostRegistry::NO_HOST) {
+        simgrid::s4u::Host *host = simgrid::s4u::Host::by_name_or_null(hostname);
+        if (host == nullptr) {
+          throw std::invalid_argument("S4U_HostRegistry::getHostId(): Unknown hostname " + hostname);
+        }
+        host_id = S4U_HostRegistry::registerHost(host);
+      }
+      return host_id;
+    }
+
+    /**
+     * @brief Get the name of a host
+     *
+     * @param host_id: the host's id
+     * @return the host's name (which remains valid until the registry is cleared)
+     *
+     * @throw std::invalid_argument
+     */
+    const std::string &S4U_HostRegistry::getHostname(unsigned long host_id) {
+      return S4U_HostRegistry::getAttributes(host_id).hostname;
+    }
+
+    /**
+     * @brief Get the S4U host of a host
+     *
+     * @param host_id: the host's id
+     * @return the S4U host
+     *
+     * @throw std::invalid_argument
+     */
+    simgrid::s4u::Host *S4U_HostRegistry::getHost(unsigned long host_id) {
+      return S4U_HostRegistry::getAttributes(host_id).host;
+    }
+
+    /**
+     * @brief Get the number of cores of a host
+     *
+     * @param host_id: the host's id
+     * @return the number of cores
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned int S4U_HostRegistry::getNumCores(unsigned long host_id) {
+      return S4U_HostRegistry::getAttributes(host_id).num_cores;
+    }
+
+    /**
+     * @brief Get the flop rate of a host
+     *
+     * @param host_id: the host's id
+     * @return the flop rate in floating point operations per second
+     *
+     * @throw std::invalid_argument
+     */
+    double S4U_HostRegistry::getFlopRate(unsigned long host_id) {
+      return S4U_HostRegistry::getAttributes(host_id).flop_rate;
+    }
+
+    /**
+     * @brief Get the memory capacity of a host
+     *
+     * @param host_id: the host's id
+     * @return the memory capacity in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    double S4U_HostRegistry::getMemoryCapacity(unsigned long host_id) {
+      const HostAttributes &attributes = S4U_HostRegistry::getAttributes(host_id);
+      if (not attributes.memory_capacity_error.empty()) {
+        throw std::invalid_argument(attributes.memory_capacity_error);
+      }
+      return attributes.memory_capacity;
+    }
+
+    /**
+     * @brief Get the cached attributes of a host
+     *
+     * @param host_id: the host's id
+     * @return the host's attributes
+     *
+     * @throw std::invalid_argument
+     */
+    const S4U_HostRegistry::HostAttributes &S4U_HostRegistry::getAttributes(unsigned long host_id) {
+      if (host_id >= S4U_HostRegistry::hosts.size()) {
+        throw std::invalid_argument("S4U_HostRegistry::getAttributes(): Invalid host id " + std::to_string(host_id));
+      }
+      return S4U_HostRegistry::hosts[host_id];
+    }
+
+};
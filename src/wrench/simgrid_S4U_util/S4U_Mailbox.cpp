@@ -20,6 +20,7 @@
 #include "wrench/logging/TerminalOutput.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simgrid_S4U_util/S4U_PendingCommunication.h"
+#include "wrench/simgrid_S4U_util/S4U_Simulation.h"
 #include "wrench/simulation/SimulationMessage.h"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(mailbox, "Mailbox");
@@ -29,6 +30,14 @@ namespace wrench {
 
     class WorkflowTask;
 
+    unsigned long S4U_Mailbox::num_sent_messages = 0;
+    unsigned long S4U_Mailbox::num_generated_mailbox_names = 0;
+    unsigned long S4U_Mailbox::last_correlation_id = 0;
+    unsigned long S4U_Mailbox::num_memory_messages = 0;
+    bool S4U_Mailbox::ideal_control_plane = false;
+    std::map<std::string, S4U_Mailbox::MemoryMailbox> S4U_Mailbox::memory_mailboxes;
+    std::unordered_map<unsigned long, std::deque<SimulationMessage *>> S4U_Mailbox::expected_replies;
+
     /**
      * @brief Synchronously receive a message from a mailbox
      *
@@ -42,17 +51,23 @@ namespace wrench {
     std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(std::string mailbox_name) {
       WRENCH_DEBUG("Getting a message from mailbox_name '%s'", mailbox_name.c_str());
       simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::byName(mailbox_name);
+
       SimulationMessage *msg = nullptr;
-      try {
-        msg = static_cast<SimulationMessage *>(mailbox->get());
-      } catch (xbt_ex &e) {
-        if (e.category == network_error) {
-          throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, mailbox_name));
-        } else {
-          throw std::runtime_error("S4U_Mailbox::getMessage(): Unexpected xbt_ex exception (" + std::to_string(e.category) + ")");
+      if (S4U_Mailbox::ideal_control_plane) {
+        msg = S4U_Mailbox::getMemoryMessage(mailbox_name, -1);
+      }
+      if (msg == nullptr) {
+        try {
+          msg = static_cast<SimulationMessage *>(mailbox->get());
+        } catch (xbt_ex &e) {
+          if (e.category == network_error) {
+            throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, mailbox_name));
+          } else {
+            throw std::runtime_error("S4U_Mailbox::getMessage(): Unexpected xbt_ex exception (" + std::to_string(e.category) + ")");
+          }
+        } catch (std::exception &e) {
+          throw std::shared_ptr<FatalFailure>(new FatalFailure());
         }
-      } catch (std::exception &e) {
-        throw std::shared_ptr<FatalFailure>(new FatalFailure());
       }
       // This is just because it seems that after something like a killAll() we get a nullptr
       if (msg == nullptr) {
@@ -61,6 +76,7 @@ namespace wrench {
 
       //Remove this message from the message manager list
       MessageManager::removeReceivedMessages(mailbox_name,msg);
+
       WRENCH_DEBUG("Received a '%s' message from mailbox_name %s", msg->getName().c_str(), mailbox_name.c_str());
       return std::unique_ptr<SimulationMessage>(msg);
     }
@@ -79,20 +95,27 @@ namespace wrench {
     std::unique_ptr<SimulationMessage> S4U_Mailbox::getMessage(std::string mailbox_name, double timeout) {
       WRENCH_DEBUG("Getting a message from mailbox_name '%s' with timeout %lf sec", mailbox_name.c_str(), timeout);
       simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::byName(mailbox_name);
+      double deadline = S4U_Simulation::getClock() + timeout;
+
       void *data = nullptr;
-      try {
-        data = mailbox->get(timeout);
-      } catch (xbt_ex &e) {
-        if (e.category == timeout_error) {
-          throw std::shared_ptr<NetworkTimeout>(new NetworkTimeout(NetworkTimeout::RECEIVING, mailbox_name));
-        }
-        if (e.category == network_error) {
-          throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, mailbox_name));
-        } else {
-          throw std::runtime_error("S4U_Mailbox::getMessage(): Unexpected xbt_ex exception (" + std::to_string(e.category) + ")");
+      if (S4U_Mailbox::ideal_control_plane) {
+        data = S4U_Mailbox::getMemoryMessage(mailbox_name, timeout);
+      }
+      if (data == nullptr) {
+        try {
+          data = mailbox->get(std::max<double>(0, deadline - S4U_Simulation::getClock()));
+        } catch (xbt_ex &e) {
+          if (e.category == timeout_error) {
+            throw std::shared_ptr<NetworkTimeout>(new NetworkTimeout(NetworkTimeout::RECEIVING, mailbox_name));
+          }
+          if (e.category == network_error) {
+            throw std::shared_ptr<NetworkError>(new NetworkError(NetworkError::RECEIVING, mailbox_name));
+          } else {
+            throw std::runtime_error("S4U_Mailbox::getMessage(): Unexpected xbt_ex exception (" + std::to_string(e.category) + ")");
+          }
+        } catch (std::exception &e) {
+          throw std::shared_ptr<FatalFailure>(new FatalFailure());
         }
-      } catch (std::exception &e) {
-        throw std::shared_ptr<FatalFailure>(new FatalFailure());
       }
 
       // This is just because it seems that after something like a killAll() we get a nullptr
@@ -115,18 +138,26 @@ namespace wrench {
      *
      * @param mailbox_name: the mailbox name
      * @param msg: the SimulationMessage
+     * @param correlation_id: the id of the request/reply exchange to which the message belongs (0 if none)
      *
      * @throw std::shared_ptr<NetworkError>
      * @throw std::shared_ptr<FatalFailure>
      */
-    void S4U_Mailbox::putMessage(std::string mailbox_name, SimulationMessage *msg) {
+    void S4U_Mailbox::putMessage(std::string mailbox_name, SimulationMessage *msg, unsigned long correlation_id) {
       WRENCH_DEBUG("Putting a %s message (%.2lf bytes) to mailbox_name '%s'",
                    msg->getName().c_str(), msg->payload,
                    mailbox_name.c_str());
+      msg->correlation_id = correlation_id;
+      if (S4U_Mailbox::ideal_control_plane and S4U_Mailbox::putMemoryMessage(mailbox_name, msg)) {
+        S4U_Mailbox::num_sent_messages++;
+        S4U_Mailbox::num_memory_messages++;
+        return;
+      }
       simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::byName(mailbox_name);
       try {
         //also let the MessageManager manage this message
         MessageManager::manageMessage(mailbox_name,msg);
+        S4U_Mailbox::num_sent_messages++;
         mailbox->put(msg, (uint64_t) msg->payload);
       } catch (xbt_ex &e) {
         if ((e.category == network_error) || (e.category == timeout_error)) {
@@ -146,11 +177,12 @@ namespace wrench {
      *
      * @param mailbox_name: the mailbox name
      * @param msg: the SimulationMessage
+     * @param correlation_id: the id of the request/reply exchange to which the message belongs (0 if none)
      *
      * @throw std::shared_ptr<NetworkError>
      * @throw std::shared_ptr<FatalFailure>
      */
-    void S4U_Mailbox::dputMessage(std::string mailbox_name, SimulationMessage *msg) {
+    void S4U_Mailbox::dputMessage(std::string mailbox_name, SimulationMessage *msg, unsigned long correlation_id) {
 
       WRENCH_DEBUG("Dputting a %s message (%.2lf bytes) to mailbox_name '%s'",
                    msg->getName().c_str(), msg->payload,
@@ -158,9 +190,16 @@ namespace wrench {
 
       simgrid::s4u::CommPtr comm = nullptr;
 
+      msg->correlation_id = correlation_id;
+      if (S4U_Mailbox::ideal_control_plane and S4U_Mailbox::putMemoryMessage(mailbox_name, msg)) {
+        S4U_Mailbox::num_sent_messages++;
+        S4U_Mailbox::num_memory_messages++;
+        return;
+      }
       simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::byName(mailbox_name);
 
       try {
+        S4U_Mailbox::num_sent_messages++;
         mailbox->put_init(msg, (uint64_t) msg->payload)->detach();
       } catch (xbt_ex &e) {
         if ((e.category == network_error) || (e.category == timeout_error)) {
@@ -182,13 +221,15 @@ namespace wrench {
     *
     * @param mailbox_name: the mailbox name
     * @param msg: the SimulationMessage
+    * @param correlation_id: the id of the request/reply exchange to which the message belongs (0 if none)
     *
     * @return: a pending communication handle
     *
     * @throw std::shared_ptr<NetworkError>
     * @throw std::shared_ptr<FatalFailure>
     */
-    std::unique_ptr<S4U_PendingCommunication> S4U_Mailbox::iputMessage(std::string mailbox_name, SimulationMessage *msg) {
+    std::unique_ptr<S4U_PendingCommunication> S4U_Mailbox::iputMessage(std::string mailbox_name, SimulationMessage *msg,
+                                                                       unsigned long correlation_id) {
 
       WRENCH_DEBUG("Iputting a %s message (%.2lf bytes) to mailbox_name '%s'",
                    msg->getName().c_str(), msg->payload,
@@ -196,8 +237,16 @@ namespace wrench {
 
       simgrid::s4u::CommPtr comm_ptr = nullptr;
 
+      msg->correlation_id = correlation_id;
+      if (S4U_Mailbox::ideal_control_plane and S4U_Mailbox::putMemoryMessage(mailbox_name, msg)) {
+        // The communication is already complete
+        S4U_Mailbox::num_sent_messages++;
+        S4U_Mailbox::num_memory_messages++;
+        return std::unique_ptr<S4U_PendingCommunication>(new S4U_PendingCommunication(mailbox_name));
+      }
       simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::byName(mailbox_name);
       try {
+        S4U_Mailbox::num_sent_messages++;
         comm_ptr = mailbox->put_async(msg, (uint64_t) msg->payload);
       } catch (xbt_ex &e) {
         if (e.category == network_error) {
@@ -231,6 +280,15 @@ namespace wrench {
 
       std::unique_ptr<S4U_PendingCommunication> pending_communication = std::unique_ptr<S4U_PendingCommunication>(new S4U_PendingCommunication(mailbox_name));
 
+      if (S4U_Mailbox::ideal_control_plane) {
+        // A message that is already in memory completes the communication, otherwise the reception
+        // is posted, and control messages to the mailbox go through the network until it completes
+        if (S4U_Mailbox::postMemoryReception(mailbox_name, &(pending_communication->simulation_message))) {
+          return pending_communication;
+        }
+        pending_communication->posted_memory_reception = true;
+      }
+
       simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::byName(mailbox_name);
       try {
         comm_ptr = mailbox->get_async((void**)(&(pending_communication->simulation_message)));
@@ -267,7 +325,364 @@ namespace wrench {
      * @return a unique mailbox name as a string
      */
     std::string S4U_Mailbox::generateUniqueMailboxName(std::string prefix) {
+      S4U_Mailbox::num_generated_mailbox_names++;
       return prefix + "_" + std::to_string(S4U_Mailbox::generateUniqueSequenceNumber());
     }
 
+    /**
+     * @brief Get the name of the mailbox on which the calling actor receives replies (one per actor, which
+     *        is reused across requests). Since replies to several requests can go through it, each request
+     *        is sent with a new correlation id (see generateCorrelationId()), which the replies carry, and
+     *        replies are received with getReply().
+     *
+     * @return a reply mailbox name
+     */
+    std::string S4U_Mailbox::generateReplyMailboxName() {
+      return "reply_" + std::to_string(simgrid::s4u::this_actor::getPid());
+    }
+
+    /**
+     * @brief Generate a new request/reply exchange correlation id
+     *
+     * @return a (non-zero) correlation id
+     */
+    unsigned long S4U_Mailbox::generateCorrelationId() {
+      return ++S4U_Mailbox::last_correlation_id;
+    }
+
+    /**
+     * @brief Synchronously receive the reply that carries a given correlation id from a mailbox. Other
+     *        messages received in the process are kept if they are expected (see expectReplies()), and
+     *        are otherwise discarded (e.g., late replies to abandoned requests).
+     *
+     * @param mailbox_name: the mailbox name
+     * @param correlation_id: the correlation id
+     * @return the message
+     *
+     * @throw std::shared_ptr<NetworkError>
+     * @throw std::shared_ptr<FatalFailure>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::getReply(std::string mailbox_name, unsigned long correlation_id) {
+      return S4U_Mailbox::receiveReply(mailbox_name, {correlation_id}, -1);
+    }
+
+    /**
+     * @brief Synchronously receive the reply that carries a given correlation id from a mailbox, with a timeout
+     *
+     * @param mailbox_name: the mailbox name
+     * @param correlation_id: the correlation id
+     * @param timeout: a timeout value in seconds
+     * @return the message
+     *
+     * @throw std::shared_ptr<NetworkError>
+     * @throw std::shared_ptr<NetworkTimeout>
+     * @throw std::shared_ptr<FatalFailure>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::getReply(std::string mailbox_name, unsigned long correlation_id,
+                                                             double timeout) {
+      return S4U_Mailbox::receiveReply(mailbox_name, {correlation_id}, timeout);
+    }
+
+    /**
+     * @brief Synchronously receive a reply that carries one of several correlation ids from a mailbox
+     *
+     * @param mailbox_name: the mailbox name
+     * @param correlation_ids: the correlation ids
+     * @return the message (the one that arrived first, with kept messages coming first, in the
+     *         order of the correlation ids)
+     *
+     * @throw std::shared_ptr<NetworkError>
+     * @throw std::shared_ptr<FatalFailure>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::getAnyReply(std::string mailbox_name,
+                                                                const std::vector<unsigned long> &correlation_ids) {
+      return S4U_Mailbox::receiveReply(mailbox_name, correlation_ids, -1);
+    }
+
+    /**
+     * @brief Synchronously receive a reply that carries one of several correlation ids from a mailbox
+     *
+     * @param mailbox_name: the mailbox name
+     * @param correlation_ids: the correlation ids
+     * @param timeout: a timeout value in seconds (-1 means no timeout)
+     * @return the message
+     *
+     * @throw std::shared_ptr<NetworkError>
+     * @throw std::shared_ptr<NetworkTimeout>
+     * @throw std::shared_ptr<FatalFailure>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::receiveReply(const std::string &mailbox_name,
+                                                                 const std::vector<unsigned long> &correlation_ids,
+                                                                 double timeout) {
+      for (auto correlation_id : correlation_ids) {
+        std::unique_ptr<SimulationMessage> msg = S4U_Mailbox::takeKeptReply(correlation_id);
+        if (msg) {
+          return msg;
+        }
+      }
+
+      double deadline = S4U_Simulation::getClock() + timeout;
+      while (true) {
+        std::unique_ptr<SimulationMessage> msg;
+        if (timeout < 0) {
+          msg = S4U_Mailbox::getMessage(mailbox_name);
+        } else {
+          double remaining_timeout = deadline - S4U_Simulation::getClock();
+          if (remaining_timeout < 0) {
+            throw std::shared_ptr<NetworkTimeout>(new NetworkTimeout(NetworkTimeout::RECEIVING, mailbox_name));
+          }
+          msg = S4U_Mailbox::getMessage(mailbox_name, remaining_timeout);
+        }
+        for (auto correlation_id : correlation_ids) {
+          if (msg->correlation_id == correlation_id) {
+            return msg;
+          }
+        }
+        S4U_Mailbox::routeReply(std::move(msg));
+      }
+    }
+
+    /**
+     * @brief Declare that messages carrying a correlation id are expected, so that they are kept
+     *        (rather than discarded) when received by getReply() calls that wait for other replies on the
+     *        same mailbox (e.g., by an actor that performs a request while waiting for other replies)
+     *
+     * @param correlation_id: the correlation id
+     */
+    void S4U_Mailbox::expectReplies(unsigned long correlation_id) {
+      S4U_Mailbox::expected_replies[correlation_id];
+    }
+
+    /**
+     * @brief Declare that messages carrying a correlation id are no longer expected (messages that
+     *        were kept, and messages received later, are discarded)
+     *
+     * @param correlation_id: the correlation id
+     */
+    void S4U_Mailbox::ignoreReplies(unsigned long correlation_id) {
+      auto expected = S4U_Mailbox::expected_replies.find(correlation_id);
+      if (expected == S4U_Mailbox::expected_replies.end()) {
+        return;
+      }
+      for (auto msg : expected->second) {
+        delete msg;
+      }
+      S4U_Mailbox::expected_replies.erase(expected);
+    }
+
+    /**
+     * @brief Take, without blocking, an expected reply that was kept (see expectReplies()), if any
+     *
+     * @param correlation_id: the correlation id
+     * @return the message, or nullptr if no reply with that correlation id was kept
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::takeKeptReply(unsigned long correlation_id) {
+      auto expected = S4U_Mailbox::expected_replies.find(correlation_id);
+      if ((expected == S4U_Mailbox::expected_replies.end()) or expected->second.empty()) {
+        return nullptr;
+      }
+      SimulationMessage *msg = expected->second.front();
+      expected->second.pop_front();
+      return std::unique_ptr<SimulationMessage>(msg);
+    }
+
+    /**
+     * @brief Dispose of a message that was received on a reply mailbox while waiting for other replies:
+     *        keep it if it is expected, and discard it otherwise
+     *
+     * @param msg: the message
+     */
+    void S4U_Mailbox::routeReply(std::unique_ptr<SimulationMessage> msg) {
+      auto expected = S4U_Mailbox::expected_replies.find(msg->correlation_id);
+      if (expected != S4U_Mailbox::expected_replies.end()) {
+        expected->second.push_back(msg.release());
+        return;
+      }
+      WRENCH_DEBUG("Discarding an unexpected '%s' reply (correlation id %lu)", msg->getName().c_str(),
+                   msg->correlation_id);
+    }
+
+    /**
+     * @brief Get the number of messages sent (synchronously or asynchronously) so far
+     *
+     * @return a number of messages
+     */
+    unsigned long S4U_Mailbox::getNumSentMessages() {
+      return S4U_Mailbox::num_sent_messages;
+    }
+
+    /**
+     * @brief Get the number of messages sent so far that were delivered in memory, rather than
+     *        simulated as network communications (in ideal control plane mode)
+     *
+     * @return a number of messages
+     */
+    unsigned long S4U_Mailbox::getNumMemoryMessages() {
+      return S4U_Mailbox::num_memory_messages;
+    }
+
+    /**
+     * @brief Get the number of unique mailbox names generated so far (reply mailbox names, which
+     *        are reused, are not counted)
+     *
+     * @return a number of mailbox names
+     */
+    unsigned long S4U_Mailbox::getNumGeneratedMailboxNames() {
+      return S4U_Mailbox::num_generated_mailbox_names;
+    }
+
+    /**
+     * @brief Enable or disable the ideal control plane mode, in which control messages (i.e., all messages
+     *        but file contents) are delivered instantly through in-memory mailboxes rather than
+     *        simulated as network communications (to be called before the simulation is launched)
+     *
+     * @param enabled: true or false
+     */
+    void S4U_Mailbox::setIdealControlPlane(bool enabled) {
+      S4U_Mailbox::ideal_control_plane = enabled;
+    }
+
+    /**
+     * @brief Determine whether the ideal control plane mode is enabled
+     * @return true or false
+     */
+    bool S4U_Mailbox::isIdealControlPlane() {
+      return S4U_Mailbox::ideal_control_plane;
+    }
+
+    /**
+     * @brief Deliver a message to the in-memory mailbox associated to a mailbox, if possible (ideal
+     *        control plane mode only)
+     *
+     * @param mailbox_name: the mailbox name
+     * @param msg: the message
+     * @return true if the message was delivered, false if it should go through the network
+     *         (data messages, and messages to mailboxes on which network communications are pending,
+     *         so that messages are received in the order in which they were sent)
+     */
+    bool S4U_Mailbox::putMemoryMessage(const std::string &mailbox_name, SimulationMessage *msg) {
+      MemoryMailbox &memory_mailbox = S4U_Mailbox::memory_mailboxes[mailbox_name];
+
+      bool delivered = msg->isControlMessage() and (memory_mailbox.num_posted_receptions == 0) and
+                       simgrid::s4u::Mailbox::byName(mailbox_name)->empty();
+      if (delivered) {
+        WRENCH_DEBUG("Delivering a %s message to in-memory mailbox_name '%s'",
+                     msg->getName().c_str(), mailbox_name.c_str());
+        memory_mailbox.messages.push_back(msg);
+      }
+      // Wake up synchronous receivers, who get the message from memory or from the network
+      if (memory_mailbox.condition) {
+        memory_mailbox.condition->notify_all();
+      }
+      if (not delivered) {
+        S4U_Mailbox::releaseMemoryMailbox(mailbox_name);
+      }
+      return delivered;
+    }
+
+    /**
+     * @brief Wait for a message in the in-memory mailbox associated to a mailbox, or for a message
+     *        to be sent through the network to the mailbox (ideal control plane mode only)
+     *
+     * @param mailbox_name: the mailbox name
+     * @param timeout: a timeout value in seconds (-1 means no timeout)
+     * @return a message, or nullptr if the message should be received from the network
+     *
+     * @throw std::shared_ptr<NetworkTimeout>
+     * @throw std::shared_ptr<FatalFailure>
+     */
+    SimulationMessage *S4U_Mailbox::getMemoryMessage(const std::string &mailbox_name, double timeout) {
+      MemoryMailbox &memory_mailbox = S4U_Mailbox::memory_mailboxes[mailbox_name];
+      simgrid::s4u::MailboxPtr mailbox = simgrid::s4u::Mailbox::byName(mailbox_name);
+      double deadline = S4U_Simulation::getClock() + timeout;
+
+      // In-memory messages were all sent before the messages pending in the network (see putMemoryMessage()),
+      // which are received once there are no more in-memory messages
+      memory_mailbox.num_waiters++;
+      while (memory_mailbox.messages.empty() and (not mailbox->listen())) {
+        if (not memory_mailbox.condition) {
+          memory_mailbox.mutex = simgrid::s4u::Mutex::createMutex();
+          memory_mailbox.condition = simgrid::s4u::ConditionVariable::createConditionVariable();
+        }
+        std::unique_lock<simgrid::s4u::Mutex> lock(*memory_mailbox.mutex);
+        bool timed_out = false;
+        try {
+          if (timeout < 0) {
+            memory_mailbox.condition->wait(lock);
+          } else {
+            timed_out = (deadline <= S4U_Simulation::getClock()) or
+                        (memory_mailbox.condition->wait_for(lock, deadline - S4U_Simulation::getClock()) ==
+                         std::cv_status::timeout);
+          }
+        } catch (std::exception &e) {
+          memory_mailbox.num_waiters--;
+          throw std::shared_ptr<FatalFailure>(new FatalFailure());
+        }
+        if (timed_out and memory_mailbox.messages.empty() and (not mailbox->listen())) {
+          memory_mailbox.num_waiters--;
+          lock.unlock();
+          S4U_Mailbox::releaseMemoryMailbox(mailbox_name);
+          throw std::shared_ptr<NetworkTimeout>(new NetworkTimeout(NetworkTimeout::RECEIVING, mailbox_name));
+        }
+      }
+      memory_mailbox.num_waiters--;
+
+      SimulationMessage *msg = nullptr;
+      if (not memory_mailbox.messages.empty()) {
+        msg = memory_mailbox.messages.front();
+        memory_mailbox.messages.pop_front();
+      }
+      S4U_Mailbox::releaseMemoryMailbox(mailbox_name);
+      return msg;
+    }
+
+    /**
+     * @brief Take a message from the in-memory mailbox associated to a mailbox if there is one, or
+     *        record that an asynchronous reception is posted on the mailbox (ideal control plane mode only)
+     *
+     * @param mailbox_name: the mailbox name
+     * @param msg: the location where the message, if any, is stored
+     * @return true if a message was taken, false if the reception is posted
+     */
+    bool S4U_Mailbox::postMemoryReception(const std::string &mailbox_name, SimulationMessage **msg) {
+      MemoryMailbox &memory_mailbox = S4U_Mailbox::memory_mailboxes[mailbox_name];
+
+      if (not memory_mailbox.messages.empty()) {
+        *msg = memory_mailbox.messages.front();
+        memory_mailbox.messages.pop_front();
+        S4U_Mailbox::releaseMemoryMailbox(mailbox_name);
+        return true;
+      }
+      memory_mailbox.num_posted_receptions++;
+      return false;
+    }
+
+    /**
+     * @brief Record that an asynchronous reception posted on a mailbox has completed (ideal control
+     *        plane mode only)
+     *
+     * @param mailbox_name: the mailbox name
+     */
+    void S4U_Mailbox::releaseMemoryReception(const std::string &mailbox_name) {
+      auto it = S4U_Mailbox::memory_mailboxes.find(mailbox_name);
+      if ((it != S4U_Mailbox::memory_mailboxes.end()) and (it->second.num_posted_receptions > 0)) {
+        it->second.num_posted_receptions--;
+        S4U_Mailbox::releaseMemoryMailbox(mailbox_name);
+      }
+    }
+
+    /**
+     * @brief Forget about the in-memory mailbox associated to a mailbox if it is no longer in use
+     *        (so that the in-memory mailboxes of the many short-lived mailboxes don't accumulate)
+     *
+     * @param mailbox_name: the mailbox name
+     */
+    void S4U_Mailbox::releaseMemoryMailbox(const std::string &mailbox_name) {
+      auto it = S4U_Mailbox::memory_mailboxes.find(mailbox_name);
+      if ((it != S4U_Mailbox::memory_mailboxes.end()) and it->second.messages.empty() and
+          (it->second.num_posted_receptions == 0) and (it->second.num_waiters == 0)) {
+        S4U_Mailbox::memory_mailboxes.erase(it);
+      }
+    }
+
 };
@@ -12,6 +12,7 @@
 
 #include <xbt/ex.hpp>
 #include "wrench/logging/TerminalOutput.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simgrid_S4U_util/S4U_PendingCommunication.h"
 #include "wrench/simulation/SimulationMessage.h"
 #include "wrench/workflow/execution_events/FailureCause.h"
@@ -29,6 +30,11 @@ namespace wrench {
      */
     std::unique_ptr<SimulationMessage> S4U_PendingCommunication::wait() {
 
+      // The communication was completed in memory
+      if (this->comm_ptr == nullptr) {
+        return std::unique_ptr<SimulationMessage>(this->simulation_message);
+      }
+
       try {
         if (this->comm_ptr->getState() != finished) {
           this->comm_ptr->wait();
@@ -46,6 +52,7 @@ namespace wrench {
                   "S4U_PendingCommunication::wait(): Unexpected xbt_ex exception (" + std::to_string(e.category) + ")");
         }
       }
+      this->complete();
       return std::unique_ptr<SimulationMessage>(this->simulation_message);
     }
 
@@ -86,6 +93,13 @@ namespace wrench {
         throw std::invalid_argument("S4U_PendingCommunication::waitForSomethingToHappen(): invalid argument");
       }
 
+      // Communications completed in memory need no waiting
+      for (unsigned long i = 0; i < pending_comms.size(); i++) {
+        if (pending_comms[i]->comm_ptr == nullptr) {
+          return i;
+        }
+      }
+
       std::vector<simgrid::s4u::CommPtr> pending_s4u_comms;
       for (auto it = pending_comms.begin(); it < pending_comms.end(); it++) {
         pending_s4u_comms.push_back((*it)->comm_ptr);
@@ -127,6 +141,9 @@ namespace wrench {
         }
       }
 
+      if (index < pending_comms.size()) {
+        pending_comms[index]->complete();
+      }
       return index;
     }
 
@@ -136,5 +153,23 @@ namespace wrench {
     S4U_PendingCommunication::S4U_PendingCommunication(std::string mailbox) : mailbox_name(mailbox) {
     }
 
+    /**
+     * @brief Destructor
+     */
+    S4U_PendingCommunication::~S4U_PendingCommunication() {
+      this->complete();
+    }
+
+    /**
+     * @brief Record that the communication has completed (so that, in ideal control plane mode,
+     *        control messages to the mailbox no longer go through the network on its account)
+     */
+    void S4U_PendingCommunication::complete() {
+      if (this->posted_memory_reception) {
+        S4U_Mailbox::releaseMemoryReception(this->mailbox_name);
+        this->posted_memory_reception = false;
+      }
+    }
+
 
 };
\ No newline at end of file
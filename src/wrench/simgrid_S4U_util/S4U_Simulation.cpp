@@ -10,12 +10,12 @@
 
 #include <iostream>
 #include <xbt/ex.hpp>
-#include <set>
 #include <cfloat>
 #include <wrench/services/compute/ComputeService.h>
 #include <wrench/util/UnitParser.h>
 
 
+#include "wrench/simgrid_S4U_util/S4U_HostRegistry.h"
 #include "wrench/simgrid_S4U_util/S4U_Simulation.h"
 
 namespace wrench {
@@ -81,6 +81,9 @@ namespace wrench {
       } catch (xbt_ex &e) {
         // TODO: S4U doesn't throw for this
       }
+      std::vector<simgrid::s4u::Host *> host_list;
+      this->engine->getHostList(&host_list);
+      S4U_HostRegistry::build(host_list);
       this->platform_setup = true;
     }
 
@@ -115,6 +118,9 @@ namespace wrench {
      * @return true or false
      */
     bool S4U_Simulation::hostExists(std::string hostname) {
+      if (S4U_HostRegistry::findHostId(hostname) != S4U_HostRegistry::NO_HOST) {
+        return true;
+      }
       return (simgrid::s4u::Host::by_name_or_null(hostname) != nullptr);
     }
 
@@ -127,6 +133,11 @@ namespace wrench {
      * @throw std::invalid_argument
      */
     unsigned int S4U_Simulation::getNumCores(std::string hostname) {
+      unsigned long host_id = S4U_HostRegistry::findHostId(hostname);
+      if (host_id != S4U_HostRegistry::NO_HOST) {
+        return S4U_HostRegistry::getNumCores(host_id);
+      }
+      // Hosts created after the platform was set up (e.g., VMs) are not in the registry
       unsigned int num_cores = 0;
       try {
         num_cores = (unsigned int) simgrid::s4u::Host::by_name(hostname)->getCoreCount();
@@ -145,6 +156,10 @@ namespace wrench {
      * @throw std::invalid_argument
      */
     double S4U_Simulation::getFlopRate(std::string hostname) {
+      unsigned long host_id = S4U_HostRegistry::findHostId(hostname);
+      if (host_id != S4U_HostRegistry::NO_HOST) {
+        return S4U_HostRegistry::getFlopRate(host_id);
+      }
       double flop_rate = 0;
       try {
         flop_rate = simgrid::s4u::Host::by_name(hostname)->getPstateSpeed(0);
@@ -189,6 +204,10 @@ namespace wrench {
      * @return the memory capacity in bytes
      */
     double S4U_Simulation::getHostMemoryCapacity(std::string hostname) {
+      unsigned long host_id = S4U_HostRegistry::findHostId(hostname);
+      if (host_id != S4U_HostRegistry::NO_HOST) {
+        return S4U_HostRegistry::getMemoryCapacity(host_id);
+      }
       return getHostMemoryCapacity(simgrid::s4u::Host::by_name(hostname));
     }
 
@@ -197,7 +216,7 @@ namespace wrench {
      * @return the memory capacity in bytes
      */
     double S4U_Simulation::getMemoryCapacity() {
-      return S4U_Simulation::getHostMemoryCapacity(simgrid::s4u::Host::current());
+      return S4U_Simulation::getHostMemoryCapacity(simgrid::s4u::Host::current()->getName());
     }
 
     /**
@@ -206,7 +225,7 @@ namespace wrench {
      * @return the memory capacity in bytes
      */
     double S4U_Simulation::getHostMemoryCapacity(simgrid::s4u::Host *host) {
-      std::set<std::string> tags = {"mem", "Mem", "MEM", "ram", "Ram", "RAM", "memory", "Memory", "MEMORY"};
+      static const std::string tags[] = {"mem", "Mem", "MEM", "ram", "Ram", "RAM", "memory", "Memory", "MEMORY"};
       double capacity_value = ComputeService::ALL_RAM;
 
       for (auto const &tag : tags) {
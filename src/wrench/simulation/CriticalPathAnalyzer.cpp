@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <map>
+#include <json.hpp>
+
+#include "wrench/simulation/CriticalPathAnalyzer.h"
+#include "wrench/simulation/SimulationOutput.h"
+#include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/workflow/Workflow.h"
+#include "wrench/workflow/WorkflowTask.h"
+
+namespace wrench {
+
+    /**
+     * @brief Analyze a workflow execution
+     *
+     * @param workflow: a workflow whose execution has completed (some tasks may not have completed)
+     * @param output: the simulation output
+     * @param hostnames: host names to include in the host idle time report, even if no task
+     *        executed on them (hosts on which tasks executed are always included)
+     *
+     * @return an analysis report
+     *
+     * @throw std::invalid_argument
+     */
+    CriticalPathReport CriticalPathAnalyzer::analyze(Workflow *workflow, SimulationOutput &output,
+                                                     const std::vector<std::string> &hostnames) {
+
+      if (workflow == nullptr) {
+        throw std::invalid_argument("CriticalPathAnalyzer::analyze(): invalid arguments");
+      }
+
+      CriticalPathReport report;
+
+      // Completed tasks, and the last one to complete
+      std::vector<WorkflowTask *> completed_tasks;
+      WorkflowTask *last_task = nullptr;
+      for (auto task : workflow->getTasks()) {
+        if ((task->getState() != WorkflowTask::COMPLETED) or (task->getEndDate() < 0)) {
+          continue;
+        }
+        completed_tasks.push_back(task);
+        if ((last_task == nullptr) or (task->getEndDate() > last_task->getEndDate())) {
+          last_task = task;
+        }
+      }
+
+      // Execution start dates (i.e., before input file reads), from the task start trace
+      std::map<WorkflowTask *, std::vector<double>> task_start_dates;
+      for (auto timestamp : output.getTrace<SimulationTimestampTaskStart>()) {
+        task_start_dates[timestamp.getContent()->getTask()].push_back(timestamp.getDate());
+      }
+
+      // Output file write start dates, from the file write start trace
+      std::map<WorkflowFile *, std::vector<double>> file_write_start_dates;
+      for (auto timestamp : output.getTrace<SimulationTimestampFileWriteStart>()) {
+        file_write_start_dates[timestamp.getContent()->getFile()].push_back(timestamp.getDate());
+      }
+
+      // The execution start date of a task is that of its last execution, i.e., the
+      // latest task start before its computation started
+      auto getExecutionStartDate = [&task_start_dates](WorkflowTask *task) {
+        double date = task->getStartDate();
+        auto it = task_start_dates.find(task);
+        if (it != task_start_dates.end()) {
+          double latest = -1.0;
+          for (auto d : it->second) {
+            if ((d <= task->getStartDate()) and (d > latest)) {
+              latest = d;
+            }
+          }
+          if (latest >= 0) {
+            date = latest;
+          }
+        }
+        return date;
+      };
+
+      // The computation end date of a task is the earliest write of one of its output files
+      // after its computation started
+      auto getComputationEndDate = [&file_write_start_dates](WorkflowTask *task) {
+        double date = task->getEndDate();
+        for (auto file : task->getOutputFiles()) {
+          auto it = file_write_start_dates.find(file);
+          if (it == file_write_start_dates.end()) {
+            continue;
+          }
+          for (auto d : it->second) {
+            if ((d >= task->getStartDate()) and (d < date)) {
+              date = d;
+            }
+          }
+        }
+        return date;
+      };
+
+      // Critical path, built backwards from the last task, through the parents that completed last
+      if (last_task != nullptr) {
+        report.makespan = last_task->getEndDate();
+
+        WorkflowTask *task = last_task;
+        while (task != nullptr) {
+          WorkflowTask *predecessor = nullptr;
+          for (auto parent : workflow->getTaskParents(task)) {
+            if ((parent->getEndDate() >= 0) and
+                ((predecessor == nullptr) or (parent->getEndDate() > predecessor->getEndDate()))) {
+              predecessor = parent;
+            }
+          }
+
+          CriticalPathSegment segment;
+          segment.task = task;
+          segment.execution_host = task->getExecutionHost();
+          segment.ready_date = (predecessor == nullptr ? 0.0 : predecessor->getEndDate());
+          segment.computation_start_date = task->getStartDate();
+          segment.end_date = task->getEndDate();
+          segment.execution_start_date = std::max<double>(segment.ready_date, getExecutionStartDate(task));
+          segment.computation_end_date = getComputationEndDate(task);
+          // A task submitted before its predecessor completed waited in a queue from that completion on
+          segment.submit_date = (task->getSubmitDate() < 0 ? segment.execution_start_date :
+                                 std::min<double>(std::max<double>(segment.ready_date, task->getSubmitDate()),
+                                                  segment.execution_start_date));
+
+          segment.scheduling_gap = segment.submit_date - segment.ready_date;
+          segment.queue_wait = segment.execution_start_date - segment.submit_date;
+          segment.data_transfer = (segment.computation_start_date - segment.execution_start_date) +
+                                  (segment.end_date - segment.computation_end_date);
+          segment.compute = segment.computation_end_date - segment.computation_start_date;
+
+          report.compute_time += segment.compute;
+          report.data_transfer_time += segment.data_transfer;
+          report.queue_wait_time += segment.queue_wait;
+          report.scheduling_gap_time += segment.scheduling_gap;
+          report.critical_path.push_back(segment);
+
+          task = predecessor;
+        }
+        std::reverse(report.critical_path.begin(), report.critical_path.end());
+      }
+
+      // Host busy times, as the union of the execution intervals of the tasks that executed on each host
+      std::map<std::string, std::vector<std::pair<double, double>>> host_intervals;
+      for (auto const &hostname : hostnames) {
+        host_intervals[hostname];
+      }
+      for (auto task : completed_tasks) {
+        if (not task->getExecutionHost().empty()) {
+          host_intervals[task->getExecutionHost()].push_back(
+                  std::make_pair(getExecutionStartDate(task), task->getEndDate()));
+        }
+      }
+
+      for (auto &h : host_intervals) {
+        HostIdleTime host;
+        host.hostname = h.first;
+        host.num_tasks = h.second.size();
+
+        std::sort(h.second.begin(), h.second.end());
+        double current_start = -1.0, current_end = -1.0;
+        for (auto const &interval : h.second) {
+          if (interval.first > current_end) {
+            host.busy_time += current_end - current_start;
+            current_start = interval.first;
+            current_end = interval.second;
+          } else {
+            current_end = std::max<double>(current_end, interval.second);
+          }
+        }
+        host.busy_time += current_end - current_start;
+        host.idle_time = std::max<double>(0.0, report.makespan - host.busy_time);
+
+        report.hosts.push_back(host);
+      }
+
+      return report;
+    }
+
+    /**
+     * @brief Export the report as JSON
+     *
+     * @param indent: the JSON indentation (-1 for a compact, single-line output)
+     * @return a JSON string
+     */
+    std::string CriticalPathReport::toJSON(int indent) const {
+      nlohmann::json json;
+
+      json["makespan"] = this->makespan;
+      json["compute_time"] = this->compute_time;
+      json["data_transfer_time"] = this->data_transfer_time;
+      json["queue_wait_time"] = this->queue_wait_time;
+      json["scheduling_gap_time"] = this->scheduling_gap_time;
+
+      json["critical_path"] = nlohmann::json::array();
+      for (auto const &segment : this->critical_path) {
+        nlohmann::json entry;
+        entry["task"] = segment.task->getId();
+        entry["execution_host"] = segment.execution_host;
+        entry["ready_date"] = segment.ready_date;
+        entry["submit_date"] = segment.submit_date;
+        entry["execution_start_date"] = segment.execution_start_date;
+        entry["computation_start_date"] = segment.computation_start_date;
+        entry["computation_end_date"] = segment.computation_end_date;
+        entry["end_date"] = segment.end_date;
+        entry["scheduling_gap"] = segment.scheduling_gap;
+        entry["queue_wait"] = segment.queue_wait;
+        entry["data_transfer"] = segment.data_transfer;
+        entry["compute"] = segment.compute;
+        json["critical_path"].push_back(entry);
+      }
+
+      json["hosts"] = nlohmann::json::array();
+      for (auto const &host : this->hosts) {
+        nlohmann::json entry;
+        entry["hostname"] = host.hostname;
+        entry["num_tasks"] = host.num_tasks;
+        entry["busy_time"] = host.busy_time;
+        entry["idle_time"] = host.idle_time;
+        json["hosts"].push_back(entry);
+      }
+
+      return json.dump(indent);
+    }
+
+};
@@ -0,0 +1,332 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "wrench/exceptions/WorkflowExecutionException.h"
+#include "wrench/simulation/EnsembleRunner.h"
+#include "wrench/simulation/Simulation.h"
+#include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/workflow/execution_events/FailureCause.h"
+
+namespace wrench {
+
+    /**
+     * \cond
+     */
+
+    static void appendBytes(std::string &bytes, const void *data, size_t size) {
+      bytes.append((const char *) data, size);
+    }
+
+    static void appendUInt64(std::string &bytes, uint64_t value) {
+      appendBytes(bytes, &value, sizeof(value));
+    }
+
+    static void appendDouble(std::string &bytes, double value) {
+      appendBytes(bytes, &value, sizeof(value));
+    }
+
+    static void appendString(std::string &bytes, const std::string &value) {
+      appendUInt64(bytes, value.size());
+      bytes.append(value);
+    }
+
+    static void readBytes(const std::string &bytes, size_t &offset, void *data, size_t size) {
+      if (offset + size > bytes.size()) {
+        throw std::runtime_error("EnsembleRunner::deserializeResult(): Truncated result");
+      }
+      memcpy(data, bytes.data() + offset, size);
+      offset += size;
+    }
+
+    static uint64_t readUInt64(const std::string &bytes, size_t &offset) {
+      uint64_t value;
+      readBytes(bytes, offset, &value, sizeof(value));
+      return value;
+    }
+
+    static double readDouble(const std::string &bytes, size_t &offset) {
+      double value;
+      readBytes(bytes, offset, &value, sizeof(value));
+      return value;
+    }
+
+    static std::string readString(const std::string &bytes, size_t &offset) {
+      uint64_t size = readUInt64(bytes, offset);
+      if (offset + size > bytes.size()) {
+        throw std::runtime_error("EnsembleRunner::deserializeResult(): Truncated result");
+      }
+      std::string value = bytes.substr(offset, size);
+      offset += size;
+      return value;
+    }
+
+    static void writeAll(int fd, const std::string &bytes) {
+      size_t written = 0;
+      while (written < bytes.size()) {
+        ssize_t n = write(fd, bytes.data() + written, bytes.size() - written);
+        if (n < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return;
+        }
+        written += n;
+      }
+    }
+
+    /**
+     * \endcond
+     */
+
+    /**
+     * @brief Constructor
+     *
+     * @param max_num_workers: the maximum number of simulations that run concurrently
+     *        (0 means "as many as there are online cores")
+     */
+    EnsembleRunner::EnsembleRunner(unsigned long max_num_workers) {
+      if (max_num_workers == 0) {
+        long num_cores = sysconf(_SC_NPROCESSORS_ONLN);
+        max_num_workers = (unsigned long) (num_cores > 0 ? num_cores : 1);
+      }
+      this->max_num_workers = max_num_workers;
+    }
+
+    /**
+     * @brief Get the maximum number of simulations that run concurrently
+     * @return a number of worker processes
+     */
+    unsigned long EnsembleRunner::getMaxNumWorkers() {
+      return this->max_num_workers;
+    }
+
+    /**
+     * @brief Run an ensemble of simulations, each in a forked worker process, with at most
+     *        getMaxNumWorkers() workers at a time. The calling process must not have
+     *        initialized a simulation itself.
+     *
+     * @param configurations: the simulation configurations
+     * @return the simulation results, in the same order as the configurations
+     *
+     * @throw std::runtime_error
+     */
+    std::vector<EnsembleResult> EnsembleRunner::run(const std::vector<EnsembleConfiguration> &configurations) {
+
+      struct Worker {
+          unsigned long index;
+          int fd;
+          std::string bytes;
+      };
+
+      std::vector<EnsembleResult> results(configurations.size());
+      std::map<pid_t, Worker> workers;
+      unsigned long next = 0;
+
+      while ((next < configurations.size()) or (not workers.empty())) {
+
+        // Start as many workers as allowed
+        while ((next < configurations.size()) and (workers.size() < this->max_num_workers)) {
+          int fds[2];
+          if (pipe(fds) != 0) {
+            throw std::runtime_error("EnsembleRunner::run(): Cannot create pipe: " + std::string(strerror(errno)));
+          }
+          pid_t pid = fork();
+          if (pid < 0) {
+            throw std::runtime_error("EnsembleRunner::run(): Cannot fork: " + std::string(strerror(errno)));
+          }
+          if (pid == 0) {
+            close(fds[0]);
+            for (auto const &w : workers) {
+              close(w.second.fd);
+            }
+            runWorker(configurations[next], fds[1]);
+          }
+          close(fds[1]);
+          workers[pid] = {next, fds[0], ""};
+          next++;
+        }
+
+        // Read from all workers' pipes (so that no worker blocks on a full pipe)
+        std::vector<struct pollfd> poll_fds;
+        std::vector<pid_t> pids;
+        for (auto const &w : workers) {
+          poll_fds.push_back({w.second.fd, POLLIN, 0});
+          pids.push_back(w.first);
+        }
+        if (poll(poll_fds.data(), poll_fds.size(), -1) < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          throw std::runtime_error("EnsembleRunner::run(): poll() failed: " + std::string(strerror(errno)));
+        }
+
+        for (unsigned long i = 0; i < poll_fds.size(); i++) {
+          if (poll_fds[i].revents == 0) {
+            continue;
+          }
+          Worker &worker = workers[pids[i]];
+          char buffer[65536];
+          ssize_t n = read(worker.fd, buffer, sizeof(buffer));
+          if ((n < 0) and (errno == EINTR)) {
+            continue;
+          }
+          if (n > 0) {
+            worker.bytes.append(buffer, n);
+            continue;
+          }
+
+          // The worker is done
+          close(worker.fd);
+          int status;
+          waitpid(pids[i], &status, 0);
+
+          EnsembleResult &result = results[worker.index];
+          try {
+            result = deserializeResult(worker.bytes);
+          } catch (std::runtime_error &e) {
+            result.success = false;
+            if (WIFSIGNALED(status)) {
+              result.failure_cause = "Worker process killed by signal " + std::to_string(WTERMSIG(status));
+            } else {
+              result.failure_cause = "Worker process exited with status " + std::to_string(WEXITSTATUS(status)) +
+                                     " without reporting a result";
+            }
+          }
+          result.name = configurations[worker.index].name;
+          workers.erase(pids[i]);
+        }
+      }
+
+      return results;
+    }
+
+    /**
+     * @brief Run one simulation (in a worker process), write its serialized result to a file
+     *        descriptor, and terminate the process
+     *
+     * @param configuration: the simulation configuration
+     * @param fd: the file descriptor
+     */
+    void EnsembleRunner::runWorker(const EnsembleConfiguration &configuration, int fd) {
+      EnsembleResult result;
+      result.name = configuration.name;
+
+      auto start = std::chrono::steady_clock::now();
+      try {
+        std::vector<char *> argv;
+        argv.push_back(strdup(configuration.name.c_str()));
+        for (auto const &arg : configuration.arguments) {
+          argv.push_back(strdup(arg.c_str()));
+        }
+        argv.push_back(nullptr);
+        int argc = (int) argv.size() - 1;
+
+        auto simulation = new Simulation();
+        simulation->init(&argc, argv.data());
+        configuration.setup(simulation);
+        simulation->launch();
+
+        result.simulated_end_date = simulation->getCurrentSimulatedDate();
+        for (auto ts : simulation->output.getTrace<SimulationTimestampTaskCompletion>()) {
+          result.task_completion_dates.push_back(std::make_pair(ts->getContent()->getTask()->getId(),
+                                                                ts->getDate()));
+        }
+        result.success = true;
+      } catch (WorkflowExecutionException &e) {
+        result.success = false;
+        result.failure_cause = e.getCause()->toString();
+      } catch (std::exception &e) {
+        result.success = false;
+        result.failure_cause = e.what();
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        result.success = false;
+        result.failure_cause = cause->toString();
+      } catch (std::shared_ptr<NetworkTimeout> &cause) {
+        result.success = false;
+        result.failure_cause = cause->toString();
+      } catch (std::shared_ptr<FatalFailure> &cause) {
+        result.success = false;
+        result.failure_cause = cause->toString();
+      } catch (...) {
+        // Never let an exception unwind into the parent process' code
+        result.success = false;
+        result.failure_cause = "Unknown exception thrown by the simulation";
+      }
+      result.wall_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      try {
+        writeAll(fd, serializeResult(result));
+      } catch (...) {
+        // The parent reports a worker that exits without a result as failed
+      }
+      close(fd);
+      // Do not run the parent process' exit handlers (e.g., SimGrid's)
+      _exit(result.success ? 0 : 1);
+    }
+
+    /**
+     * @brief Serialize a result into a compact binary representation
+     *
+     * @param result: the result
+     * @return the bytes
+     */
+    std::string EnsembleRunner::serializeResult(const EnsembleResult &result) {
+      std::string bytes;
+      appendString(bytes, result.name);
+      appendUInt64(bytes, result.success ? 1 : 0);
+      appendString(bytes, result.failure_cause);
+      appendDouble(bytes, result.wall_time);
+      appendDouble(bytes, result.simulated_end_date);
+      appendUInt64(bytes, result.task_completion_dates.size());
+      for (auto const &completion : result.task_completion_dates) {
+        appendString(bytes, completion.first);
+        appendDouble(bytes, completion.second);
+      }
+      return bytes;
+    }
+
+    /**
+     * @brief Deserialize a result from its binary representation
+     *
+     * @param bytes: the bytes
+     * @return the result
+     *
+     * @throw std::runtime_error
+     */
+    EnsembleResult EnsembleRunner::deserializeResult(const std::string &bytes) {
+      EnsembleResult result;
+      size_t offset = 0;
+      result.name = readString(bytes, offset);
+      result.success = (readUInt64(bytes, offset) != 0);
+      result.failure_cause = readString(bytes, offset);
+      result.wall_time = readDouble(bytes, offset);
+      result.simulated_end_date = readDouble(bytes, offset);
+      uint64_t num_completions = readUInt64(bytes, offset);
+      for (uint64_t i = 0; i < num_completions; i++) {
+        std::string task_id = readString(bytes, offset);
+        double date = readDouble(bytes, offset);
+        result.task_completion_dates.push_back(std::make_pair(task_id, date));
+      }
+      if (offset != bytes.size()) {
+        throw std::runtime_error("EnsembleRunner::deserializeResult(): Trailing bytes in result");
+      }
+      return result;
+    }
+
+};
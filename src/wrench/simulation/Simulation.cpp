@@ -15,6 +15,7 @@
 #include "wrench/services/compute/multihost_multicore/MultihostMulticoreComputeService.h"
 #include "wrench/services/file_registry/FileRegistryService.h"
 #include "wrench/services/storage/StorageService.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simulation/Simulation.h"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(simulation, "Log category for Simulation");
@@ -86,6 +87,9 @@ namespace wrench {
         if (not strncmp(argv[i], "--wrench-no-color", strlen("--wrench-no-color"))) {
           TerminalOutput::disableColor();
           skip++;
+        } else if (not strncmp(argv[i], "--wrench-ideal-control-plane", strlen("--wrench-ideal-control-plane"))) {
+          S4U_Mailbox::setIdealControlPlane(true);
+          skip++;
         }
         argv[i] = argv[i + skip];
       }
@@ -95,13 +99,13 @@ namespace wrench {
     }
 
     /**
-     * @brief Append a SimulationEvent to the event trace
+     * @brief Append a timestamp, dated with the current simulated date, to the simulation output
      *
-     * @param event
+     * @param content: a SimulationTimestampXXXX object
      */
     template<class T>
-    void Simulation::newTimestamp(SimulationTimestamp<T> *event) {
-      this->output.addTimestamp(event);
+    void Simulation::newTimestamp(const T &content) {
+      this->output.addTimestamp<T>(content);
     }
 
     /**
@@ -171,6 +175,11 @@ namespace wrench {
       } catch (std::runtime_error &e) {
         throw;
       }
+
+      // Write out streamed timestamps
+      if (this->output.getTraceSink()) {
+        this->output.getTraceSink()->flush();
+      }
     }
 
     /**
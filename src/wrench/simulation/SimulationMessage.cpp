@@ -35,6 +35,15 @@ namespace wrench {
       return this->name;
     }
 
+    /**
+     * @brief Determine whether the message is a control message, as opposed to a data message
+     *        (in ideal control plane mode, control messages are not simulated as network communications)
+     * @return true or false
+     */
+    bool SimulationMessage::isControlMessage() {
+      return true;
+    }
+
 
 
 
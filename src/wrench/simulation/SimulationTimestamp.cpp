@@ -8,8 +8,112 @@
  */
 
 
+#include "wrench/services/compute/ComputeService.h"
+#include "wrench/services/storage/StorageService.h"
 #include "wrench/simulation/SimulationTimestamp.h"
+#include "wrench/simulation/SimulationTraceSink.h"
+#include "wrench/workflow/WorkflowFile.h"
+#include "wrench/workflow/WorkflowTask.h"
 
 namespace wrench {
 
+    /**
+     * @brief Retrieve the id of what this timestamp is about (used when streaming traces)
+     * @return the task id
+     */
+    std::string SimulationTimestampTask::getSubject() const {
+      return this->task->getId();
+    }
+
+    /**
+     * @brief Set the subject (the task id) of a streamed trace record
+     * @param record: the record
+     */
+    void SimulationTimestampTask::fillTraceRecord(SimulationTraceRecord &record) const {
+      record.subject = this->task->getId();
+    }
+
+    /**
+     * @brief Retrieve the number of bytes read or written
+     * @return a number of bytes
+     */
+    double SimulationTimestampFileTransfer::getNumBytes() {
+      return this->file->getSize();
+    }
+
+    /**
+     * @brief Retrieve the id of what this timestamp is about (used when streaming traces)
+     * @return the file id
+     */
+    std::string SimulationTimestampFileTransfer::getSubject() const {
+      return this->file->getId();
+    }
+
+    /**
+     * @brief Set the subject (the file id), the storage service, and the number of bytes
+     *        of a streamed trace record
+     * @param record: the record
+     */
+    void SimulationTimestampFileTransfer::fillTraceRecord(SimulationTraceRecord &record) const {
+      record.subject = this->file->getId();
+      if (this->storage_service != nullptr) {
+        record.service = this->storage_service->getName();
+      }
+      record.num_bytes = this->file->getSize();
+    }
+
+    /**
+     * @brief Retrieve the number of bytes copied
+     * @return a number of bytes
+     */
+    double SimulationTimestampFileCopy::getNumBytes() {
+      return this->file->getSize();
+    }
+
+    /**
+     * @brief Retrieve the id of what this timestamp is about (used when streaming traces)
+     * @return the file id
+     */
+    std::string SimulationTimestampFileCopy::getSubject() const {
+      return this->file->getId();
+    }
+
+    /**
+     * @brief Set the subject (the file id), the source and destination storage services, and
+     *        the number of bytes of a streamed trace record
+     * @param record: the record
+     */
+    void SimulationTimestampFileCopy::fillTraceRecord(SimulationTraceRecord &record) const {
+      record.subject = this->file->getId();
+      if (this->src != nullptr) {
+        record.service = this->src->getName();
+      }
+      if (this->dst != nullptr) {
+        record.destination_service = this->dst->getName();
+      }
+      record.num_bytes = this->file->getSize();
+    }
+
+    /**
+     * @brief Set the subject (the job name) and the compute service of a streamed trace record
+     * @param record: the record
+     */
+    void SimulationTimestampJob::fillTraceRecord(SimulationTraceRecord &record) const {
+      record.subject = this->job_name;
+      if (this->compute_service != nullptr) {
+        record.service = this->compute_service->getName();
+      }
+    }
+
+    /**
+     * @brief Set the subject (the job name), the compute service, and the submit and start dates
+     *        of a streamed trace record
+     * @param record: the record
+     */
+    void SimulationTimestampJobCompletion::fillTraceRecord(SimulationTraceRecord &record) const {
+      SimulationTimestampJob::fillTraceRecord(record);
+      record.submit_date = this->submit_date;
+      record.start_date = this->start_date;
+    }
+
 };
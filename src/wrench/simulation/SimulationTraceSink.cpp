@@ -0,0 +1,344 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "wrench/simulation/SimulationTraceSink.h"
+
+namespace wrench {
+
+    const char SimulationTraceSink::BINARY_MAGIC[8] = {'W', 'R', 'E', 'N', 'C', 'H', 'T', 'R'};
+
+    /**
+     * @brief Constructor
+     *
+     * @param path: the path of the output file (which is truncated)
+     * @param format: the output file format
+     * @param buffer_size: the number of bytes buffered in memory before they are written to the file
+     *
+     * @throw std::invalid_argument
+     */
+    SimulationTraceSink::SimulationTraceSink(const std::string &path, Format format, size_t buffer_size) {
+      this->file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+      if (not this->file) {
+        throw std::invalid_argument("SimulationTraceSink::SimulationTraceSink(): Cannot open file '" + path + "'");
+      }
+      this->format = format;
+      this->buffer_size = (buffer_size > 0 ? buffer_size : 1);
+      this->buffer.reserve(this->buffer_size);
+
+      if (this->format == CSV) {
+        this->buffer.append("type,date,subject,service,destination_service,num_bytes,submit_date,start_date,queue_wait\n");
+      } else {
+        uint32_t version = BINARY_VERSION;
+        this->append(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+        this->append(&version, sizeof(version));
+      }
+    }
+
+    /**
+     * @brief Destructor, which flushes the buffer and closes the file
+     */
+    SimulationTraceSink::~SimulationTraceSink() {
+      this->flush();
+      this->file.close();
+    }
+
+    /**
+     * @brief Write a timestamp to the trace
+     *
+     * @param record: the timestamp's type, date, subject, and fields
+     */
+    void SimulationTraceSink::write(const SimulationTraceRecord &record) {
+
+      if (this->format == CSV) {
+        this->buffer.append(record.type);
+        this->buffer.append(",");
+        this->appendCSVNumber(record.date);
+        this->buffer.append(",");
+        this->appendCSVString(record.subject);
+        this->buffer.append(",");
+        this->appendCSVString(record.service);
+        this->buffer.append(",");
+        this->appendCSVString(record.destination_service);
+        this->buffer.append(",");
+        this->appendCSVNumber(record.num_bytes);
+        this->buffer.append(",");
+        this->appendCSVNumber(record.submit_date);
+        this->buffer.append(",");
+        this->appendCSVNumber(record.start_date);
+        this->buffer.append(",");
+        this->appendCSVNumber(record.getQueueWaitTime());
+        this->buffer.append("\n");
+
+      } else {
+        // Type and service names are written once, and then referred to by their ids
+        uint16_t type_id = this->getBinaryId(this->type_ids, BINARY_TYPE_DEFINITION, record.type);
+        uint16_t service_id = 0;
+        uint16_t destination_service_id = 0;
+        uint8_t fields = 0;
+        if (not record.service.empty()) {
+          service_id = this->getBinaryId(this->service_ids, BINARY_SERVICE_DEFINITION, record.service);
+          fields |= BINARY_FIELD_SERVICE;
+        }
+        if (not record.destination_service.empty()) {
+          destination_service_id = this->getBinaryId(this->service_ids, BINARY_SERVICE_DEFINITION,
+                                                     record.destination_service);
+          fields |= BINARY_FIELD_DESTINATION_SERVICE;
+        }
+        if (record.num_bytes >= 0) {
+          fields |= BINARY_FIELD_NUM_BYTES;
+        }
+        if ((record.submit_date >= 0) or (record.start_date >= 0)) {
+          fields |= BINARY_FIELD_JOB_DATES;
+        }
+
+        uint8_t tag = BINARY_TIMESTAMP;
+        uint32_t length = (uint32_t) record.subject.size();
+        this->append(&tag, sizeof(tag));
+        this->append(&type_id, sizeof(type_id));
+        this->append(&record.date, sizeof(record.date));
+        this->append(&length, sizeof(length));
+        this->append(record.subject.data(), record.subject.size());
+        this->append(&fields, sizeof(fields));
+        if (fields & BINARY_FIELD_SERVICE) {
+          this->append(&service_id, sizeof(service_id));
+        }
+        if (fields & BINARY_FIELD_DESTINATION_SERVICE) {
+          this->append(&destination_service_id, sizeof(destination_service_id));
+        }
+        if (fields & BINARY_FIELD_NUM_BYTES) {
+          this->append(&record.num_bytes, sizeof(record.num_bytes));
+        }
+        if (fields & BINARY_FIELD_JOB_DATES) {
+          this->append(&record.submit_date, sizeof(record.submit_date));
+          this->append(&record.start_date, sizeof(record.start_date));
+        }
+      }
+
+      this->num_records++;
+      if (this->buffer.size() >= this->buffer_size) {
+        this->flush();
+      }
+    }
+
+    /**
+     * @brief Write a timestamp that has no fields beyond its subject to the trace
+     *
+     * @param type: the timestamp type name
+     * @param date: the timestamp date
+     * @param subject: the id of what the timestamp is about
+     */
+    void SimulationTraceSink::write(const std::string &type, double date, const std::string &subject) {
+      this->record.reset(type, date);
+      this->record.subject = subject;
+      this->write(this->record);
+    }
+
+    /**
+     * @brief Write all buffered bytes to the file
+     */
+    void SimulationTraceSink::flush() {
+      if (not this->buffer.empty()) {
+        this->file.write(this->buffer.data(), this->buffer.size());
+        this->buffer.clear();
+      }
+      this->file.flush();
+    }
+
+    /**
+     * @brief Get the number of timestamps written to the trace
+     * @return a number of timestamps
+     */
+    unsigned long SimulationTraceSink::getNumRecords() {
+      return this->num_records;
+    }
+
+    /**
+     * @brief Append bytes to the buffer
+     * @param data: a pointer to the bytes
+     * @param size: the number of bytes
+     */
+    void SimulationTraceSink::append(const void *data, size_t size) {
+      this->buffer.append((const char *) data, size);
+    }
+
+    /**
+     * @brief Append a CSV field to the buffer, quoted if needed
+     * @param string: the field
+     */
+    void SimulationTraceSink::appendCSVString(const std::string &string) {
+      if (string.find_first_of(",\"\n") == std::string::npos) {
+        this->buffer.append(string);
+        return;
+      }
+      this->buffer.append("\"");
+      for (auto c : string) {
+        if (c == '"') {
+          this->buffer.append("\"");
+        }
+        this->buffer.push_back(c);
+      }
+      this->buffer.append("\"");
+    }
+
+    /**
+     * @brief Append a numeric CSV field to the buffer (left blank if the number is negative, i.e., unknown)
+     * @param number: the field
+     */
+    void SimulationTraceSink::appendCSVNumber(double number) {
+      if (number < 0) {
+        return;
+      }
+      char number_string[32];
+      snprintf(number_string, sizeof(number_string), "%.17g", number);
+      this->buffer.append(number_string);
+    }
+
+    /**
+     * @brief Get the id of a name in the binary format, writing the name's definition first if needed
+     * @param ids: the ids of the names already defined
+     * @param definition_tag: the tag of the name's definition record
+     * @param name: the name
+     * @return the id
+     */
+    uint16_t SimulationTraceSink::getBinaryId(std::map<std::string, uint16_t> &ids, uint8_t definition_tag,
+                                              const std::string &name) {
+      auto it = ids.find(name);
+      if (it != ids.end()) {
+        return it->second;
+      }
+      uint16_t id = (uint16_t) ids.size();
+      uint32_t length = (uint32_t) name.size();
+      this->append(&definition_tag, sizeof(definition_tag));
+      this->append(&id, sizeof(id));
+      this->append(&length, sizeof(length));
+      this->append(name.data(), name.size());
+      ids.insert(std::make_pair(name, id));
+      return id;
+    }
+
+    /**
+     * \cond
+     */
+    static bool readBytes(std::ifstream &file, void *data, size_t size) {
+      file.read((char *) data, size);
+      return ((size_t) file.gcount() == size);
+    }
+    /**
+     * \endcond
+     */
+
+    /**
+     * @brief Read a binary trace file, one record at a time
+     *
+     * @param path: the path of the trace file
+     * @param callback: a function invoked on each record, in file order
+     *
+     * @throw std::invalid_argument
+     */
+    void SimulationTraceReader::read(const std::string &path,
+                                     const std::function<void(const SimulationTraceRecord &)> &callback) {
+      std::ifstream file(path, std::ios::in | std::ios::binary);
+      if (not file) {
+        throw std::invalid_argument("SimulationTraceReader::read(): Cannot open file '" + path + "'");
+      }
+
+      char magic[sizeof(SimulationTraceSink::BINARY_MAGIC)];
+      uint32_t version;
+      if ((not readBytes(file, magic, sizeof(magic))) or
+          (memcmp(magic, SimulationTraceSink::BINARY_MAGIC, sizeof(magic)) != 0) or
+          (not readBytes(file, &version, sizeof(version)))) {
+        throw std::invalid_argument("SimulationTraceReader::read(): File '" + path + "' is not a binary trace");
+      }
+      if ((version != 1) and (version != SimulationTraceSink::BINARY_VERSION)) {
+        throw std::invalid_argument("SimulationTraceReader::read(): Unsupported trace version " +
+                                    std::to_string(version));
+      }
+
+      std::vector<std::string> types;
+      std::vector<std::string> services;
+      SimulationTraceRecord record;
+      uint8_t tag;
+      while (readBytes(file, &tag, sizeof(tag))) {
+        uint16_t id;
+        uint32_t length;
+        bool ok = readBytes(file, &id, sizeof(id));
+
+        if (ok and ((tag == SimulationTraceSink::BINARY_TYPE_DEFINITION) or
+                    ((tag == SimulationTraceSink::BINARY_SERVICE_DEFINITION) and (version >= 2)))) {
+          std::vector<std::string> &names = (tag == SimulationTraceSink::BINARY_TYPE_DEFINITION ? types : services);
+          ok = readBytes(file, &length, sizeof(length));
+          std::string name(ok ? length : 0, '\0');
+          ok = ok and readBytes(file, &name[0], length) and (id == names.size());
+          if (ok) {
+            names.push_back(name);
+            continue;
+          }
+        } else if (ok and (tag == SimulationTraceSink::BINARY_TIMESTAMP)) {
+          double date;
+          ok = (id < types.size()) and readBytes(file, &date, sizeof(date)) and
+               readBytes(file, &length, sizeof(length));
+          if (ok) {
+            record.reset(types[id], date);
+            record.subject.resize(length);
+            ok = readBytes(file, &record.subject[0], length);
+          }
+          uint8_t fields = 0;
+          if (ok and (version >= 2)) {
+            ok = readBytes(file, &fields, sizeof(fields));
+          }
+          uint16_t service_id;
+          if (ok and (fields & SimulationTraceSink::BINARY_FIELD_SERVICE)) {
+            ok = readBytes(file, &service_id, sizeof(service_id)) and (service_id < services.size());
+            if (ok) {
+              record.service = services[service_id];
+            }
+          }
+          if (ok and (fields & SimulationTraceSink::BINARY_FIELD_DESTINATION_SERVICE)) {
+            ok = readBytes(file, &service_id, sizeof(service_id)) and (service_id < services.size());
+            if (ok) {
+              record.destination_service = services[service_id];
+            }
+          }
+          if (ok and (fields & SimulationTraceSink::BINARY_FIELD_NUM_BYTES)) {
+            ok = readBytes(file, &record.num_bytes, sizeof(record.num_bytes));
+          }
+          if (ok and (fields & SimulationTraceSink::BINARY_FIELD_JOB_DATES)) {
+            ok = readBytes(file, &record.submit_date, sizeof(record.submit_date)) and
+                 readBytes(file, &record.start_date, sizeof(record.start_date));
+          }
+          if (ok) {
+            callback(record);
+            continue;
+          }
+        }
+        throw std::invalid_argument("SimulationTraceReader::read(): Corrupted trace file '" + path + "'");
+      }
+    }
+
+    /**
+     * @brief Read all records of a binary trace file
+     *
+     * @param path: the path of the trace file
+     * @return the records, in file order
+     *
+     * @throw std::invalid_argument
+     */
+    std::vector<SimulationTraceRecord> SimulationTraceReader::readAll(const std::string &path) {
+      std::vector<SimulationTraceRecord> records;
+      read(path, [&records](const SimulationTraceRecord &record) {
+        records.push_back(record);
+      });
+      return records;
+    }
+
+};
@@ -0,0 +1,468 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "wrench/services/compute/ComputeService.h"
+#include "wrench/services/storage/StorageService.h"
+#include "wrench/simulation/SimulationOutput.h"
+#include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/simulation/TimelineExporter.h"
+#include "wrench/workflow/Workflow.h"
+#include "wrench/workflow/WorkflowFile.h"
+#include "wrench/workflow/WorkflowTask.h"
+
+namespace wrench {
+
+    /**
+     * \cond
+     */
+
+    namespace {
+
+        /** @brief Interval categories */
+        enum Category : unsigned char {
+            TASK,
+            FILE_READ,
+            FILE_WRITE,
+            FILE_COPY,
+            JOB_QUEUED,
+            JOB_RUNNING,
+            PILOT_JOB_RUNNING,
+            NUM_CATEGORIES
+        };
+
+        const char *CATEGORY_NAMES[NUM_CATEGORIES] = {
+                "task", "file_read", "file_write", "file_copy", "job_queued", "job_running", "pilot_job_running"
+        };
+
+        const char *CATEGORY_COLORS[NUM_CATEGORIES] = {
+                "0.2 0.6 0.2", "0.2 0.4 0.8", "0.8 0.4 0.2", "0.6 0.2 0.8", "0.7 0.7 0.7", "0.9 0.7 0.1", "0.5 0.3 0.1"
+        };
+
+        /**
+         * @brief A compact interval record: what it is about is a WorkflowTask * (for tasks),
+         *        a WorkflowFile * (for file transfers), or a std::string * (for jobs)
+         */
+        struct Interval {
+            double start;
+            double end;
+            unsigned long container;
+            unsigned long lane;
+            const void *subject;
+            Category category;
+        };
+
+        /**
+         * @brief The intervals of a timeline, grouped by container (host, storage service, or compute service)
+         */
+        class Timeline {
+
+        public:
+
+            unsigned long getContainer(const std::string &name) {
+              auto it = this->container_ids.find(name);
+              if (it != this->container_ids.end()) {
+                return it->second;
+              }
+              this->container_names.push_back(name);
+              this->num_lanes.push_back(0);
+              this->container_ids.insert(std::make_pair(name, this->container_names.size() - 1));
+              return this->container_names.size() - 1;
+            }
+
+            unsigned long getContainer(Service *service, const std::string &kind) {
+              auto it = this->service_container_ids.find(service);
+              if (it != this->service_container_ids.end()) {
+                return it->second;
+              }
+              unsigned long id = this->getContainer(kind + " " + (service != nullptr ? service->getName() : "unknown"));
+              this->service_container_ids.insert(std::make_pair(service, id));
+              return id;
+            }
+
+            void add(double start, double end, unsigned long container, Category category, const void *subject) {
+              if ((start < 0) or (end < start)) {
+                return;
+              }
+              this->intervals.push_back({start, end, container, 0, subject, category});
+            }
+
+            const std::string *addJobName(const std::string &name) {
+              this->job_names.push_back(name);
+              return &(this->job_names.back());
+            }
+
+            std::string getName(const Interval &interval) {
+              switch (interval.category) {
+                case TASK:
+                  return ((WorkflowTask *) interval.subject)->getId();
+                case FILE_READ:
+                case FILE_WRITE:
+                case FILE_COPY:
+                  return ((WorkflowFile *) interval.subject)->getId();
+                default:
+                  return *((const std::string *) interval.subject);
+              }
+            }
+
+            /**
+             * @brief Assign each interval to a lane of its container, so that the intervals on a lane
+             *        do not overlap (greedy interval partitioning, which uses as few lanes as possible)
+             */
+            void assignLanes() {
+              std::sort(this->intervals.begin(), this->intervals.end(), [](const Interval &a, const Interval &b) {
+                  return std::tie(a.container, a.start, a.end) < std::tie(b.container, b.start, b.end);
+              });
+
+              typedef std::pair<double, unsigned long> LaneEnd;
+              std::priority_queue<LaneEnd, std::vector<LaneEnd>, std::greater<LaneEnd>> lane_ends;
+              unsigned long current_container = 0;
+              for (auto &interval : this->intervals) {
+                if (interval.container != current_container) {
+                  lane_ends = std::priority_queue<LaneEnd, std::vector<LaneEnd>, std::greater<LaneEnd>>();
+                  current_container = interval.container;
+                }
+                if ((not lane_ends.empty()) and (lane_ends.top().first <= interval.start)) {
+                  interval.lane = lane_ends.top().second;
+                  lane_ends.pop();
+                } else {
+                  interval.lane = this->num_lanes[interval.container]++;
+                }
+                lane_ends.push(std::make_pair(interval.end, interval.lane));
+              }
+            }
+
+            std::vector<std::string> container_names;
+            std::vector<unsigned long> num_lanes;
+            std::vector<Interval> intervals;
+
+        private:
+            std::map<std::string, unsigned long> container_ids;
+            std::map<Service *, unsigned long> service_container_ids;
+            std::deque<std::string> job_names;
+        };
+
+        /**
+         * @brief A file writer with a bounded buffer
+         */
+        class BufferedWriter {
+
+        public:
+            BufferedWriter(const std::string &path, size_t buffer_size) {
+              this->file.open(path, std::ios::out | std::ios::trunc);
+              if (not this->file) {
+                throw std::invalid_argument("TimelineExporter::exportTimeline(): Cannot open file '" + path + "'");
+              }
+              this->buffer_size = (buffer_size > 0 ? buffer_size : 1);
+              this->buffer.reserve(this->buffer_size);
+            }
+
+            ~BufferedWriter() {
+              this->flush();
+            }
+
+            BufferedWriter &operator<<(const std::string &s) {
+              this->buffer.append(s);
+              this->flushIfFull();
+              return *this;
+            }
+
+            BufferedWriter &operator<<(const char *s) {
+              this->buffer.append(s);
+              this->flushIfFull();
+              return *this;
+            }
+
+            BufferedWriter &operator<<(unsigned long n) {
+              return (*this << std::to_string(n));
+            }
+
+            BufferedWriter &operator<<(double d) {
+              char s[32];
+              snprintf(s, sizeof(s), "%.17g", d);
+              return (*this << s);
+            }
+
+            void writeJSONString(const std::string &s) {
+              this->buffer.push_back('"');
+              for (auto c : s) {
+                if ((c == '"') or (c == '\\')) {
+                  this->buffer.push_back('\\');
+                  this->buffer.push_back(c);
+                } else if ((unsigned char) c < 0x20) {
+                  char escaped[8];
+                  snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned int) c);
+                  this->buffer.append(escaped);
+                } else {
+                  this->buffer.push_back(c);
+                }
+              }
+              this->buffer.push_back('"');
+              this->flushIfFull();
+            }
+
+            void writePajeString(const std::string &s) {
+              this->buffer.push_back('"');
+              for (auto c : s) {
+                this->buffer.push_back(((c == '"') or (c == '\n')) ? '_' : c);
+              }
+              this->buffer.push_back('"');
+              this->flushIfFull();
+            }
+
+            void flush() {
+              this->file.write(this->buffer.data(), this->buffer.size());
+              this->buffer.clear();
+              this->file.flush();
+            }
+
+        private:
+            void flushIfFull() {
+              if (this->buffer.size() >= this->buffer_size) {
+                this->flush();
+              }
+            }
+
+            std::ofstream file;
+            std::string buffer;
+            size_t buffer_size;
+        };
+
+        typedef std::tuple<WorkflowFile *, StorageService *, StorageService *> TransferKey;
+
+        /**
+         * @brief Add the intervals of file transfers, matching start and completion timestamps
+         *        of the same transfer in FIFO order
+         */
+        template <class Start, class Completion>
+        void addFileTransfers(Timeline &timeline, SimulationOutput &output, Category category,
+                              const std::function<TransferKey(Start *)> &start_key,
+                              const std::function<TransferKey(Completion *)> &completion_key) {
+          std::map<TransferKey, std::deque<double>> pending;
+          for (auto timestamp : output.getTrace<Start>()) {
+            pending[start_key(timestamp.getContent())].push_back(timestamp.getDate());
+          }
+          for (auto timestamp : output.getTrace<Completion>()) {
+            TransferKey key = completion_key(timestamp.getContent());
+            auto it = pending.find(key);
+            if ((it == pending.end()) or it->second.empty()) {
+              continue;
+            }
+            double start = it->second.front();
+            it->second.pop_front();
+            StorageService *storage_service = (std::get<2>(key) != nullptr ? std::get<2>(key) : std::get<1>(key));
+            timeline.add(start, timestamp.getDate(), timeline.getContainer(storage_service, "storage"),
+                         category, std::get<0>(key));
+          }
+        }
+
+        void writeChromeTrace(Timeline &timeline, BufferedWriter &writer) {
+          writer << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+          bool first = true;
+          for (unsigned long c = 0; c < timeline.container_names.size(); c++) {
+            writer << (first ? "" : ",\n") << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << c
+                   << ",\"args\":{\"name\":";
+            writer.writeJSONString(timeline.container_names[c]);
+            writer << "}}";
+            first = false;
+            for (unsigned long l = 0; l < timeline.num_lanes[c]; l++) {
+              writer << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << c << ",\"tid\":" << l
+                     << ",\"args\":{\"name\":\"slot " << l << "\"}}";
+            }
+          }
+
+          // Chrome Trace Event timestamps and durations are in microseconds
+          for (auto const &interval : timeline.intervals) {
+            writer << (first ? "" : ",\n") << "{\"name\":";
+            writer.writeJSONString(timeline.getName(interval));
+            writer << ",\"cat\":\"" << CATEGORY_NAMES[interval.category] << "\",\"ph\":\"X\",\"ts\":"
+                   << interval.start * 1000000.0 << ",\"dur\":" << (interval.end - interval.start) * 1000000.0
+                   << ",\"pid\":" << interval.container << ",\"tid\":" << interval.lane << "}";
+            first = false;
+          }
+
+          writer << "\n]}\n";
+        }
+
+        void writePajeTrace(Timeline &timeline, BufferedWriter &writer) {
+          writer << "%EventDef PajeDefineContainerType 0\n%\tAlias string\n%\tType string\n%\tName string\n%EndEventDef\n"
+                 << "%EventDef PajeDefineStateType 1\n%\tAlias string\n%\tType string\n%\tName string\n%EndEventDef\n"
+                 << "%EventDef PajeDefineEntityValue 2\n%\tAlias string\n%\tType string\n%\tName string\n"
+                 << "%\tColor color\n%EndEventDef\n"
+                 << "%EventDef PajeCreateContainer 3\n%\tTime date\n%\tAlias string\n%\tType string\n"
+                 << "%\tContainer string\n%\tName string\n%EndEventDef\n"
+                 << "%EventDef PajeDestroyContainer 4\n%\tTime date\n%\tType string\n%\tName string\n%EndEventDef\n"
+                 << "%EventDef PajePushState 5\n%\tTime date\n%\tType string\n%\tContainer string\n"
+                 << "%\tValue string\n%EndEventDef\n"
+                 << "%EventDef PajePopState 6\n%\tTime date\n%\tType string\n%\tContainer string\n%EndEventDef\n";
+
+          writer << "0 RESOURCE 0 \"Resource\"\n"
+                 << "0 LANE RESOURCE \"Slot\"\n"
+                 << "1 ACTIVITY LANE \"Activity\"\n";
+          for (unsigned int c = 0; c < NUM_CATEGORIES; c++) {
+            writer << "2 " << CATEGORY_NAMES[c] << " ACTIVITY \"" << CATEGORY_NAMES[c] << "\" \""
+                   << CATEGORY_COLORS[c] << "\"\n";
+          }
+
+          double end_date = 0.0;
+          for (auto const &interval : timeline.intervals) {
+            end_date = std::max<double>(end_date, interval.end);
+          }
+
+          for (unsigned long c = 0; c < timeline.container_names.size(); c++) {
+            std::string alias = "c" + std::to_string(c);
+            writer << "3 0 " << alias << " RESOURCE 0 ";
+            writer.writePajeString(timeline.container_names[c]);
+            writer << "\n";
+            for (unsigned long l = 0; l < timeline.num_lanes[c]; l++) {
+              writer << "3 0 " << alias << "l" << l << " LANE " << alias << " \"slot " << l << "\"\n";
+            }
+          }
+
+          // Paje events must be in chronological order: sweep the intervals by start date, and
+          // pop states, from a heap of the running intervals, as they end
+          std::sort(timeline.intervals.begin(), timeline.intervals.end(), [](const Interval &a, const Interval &b) {
+              return a.start < b.start;
+          });
+          typedef std::pair<double, const Interval *> End;
+          std::priority_queue<End, std::vector<End>, std::greater<End>> ends;
+          auto popState = [&writer, &ends]() {
+              writer << "6 " << ends.top().first << " ACTIVITY c" << ends.top().second->container << "l"
+                     << ends.top().second->lane << "\n";
+              ends.pop();
+          };
+          for (auto const &interval : timeline.intervals) {
+            while ((not ends.empty()) and (ends.top().first <= interval.start)) {
+              popState();
+            }
+            writer << "5 " << interval.start << " ACTIVITY c" << interval.container << "l" << interval.lane << " "
+                   << CATEGORY_NAMES[interval.category] << "\n";
+            ends.push(std::make_pair(interval.end, &interval));
+          }
+          while (not ends.empty()) {
+            popState();
+          }
+
+          for (unsigned long c = 0; c < timeline.container_names.size(); c++) {
+            for (unsigned long l = 0; l < timeline.num_lanes[c]; l++) {
+              writer << "4 " << end_date << " LANE c" << c << "l" << l << "\n";
+            }
+            writer << "4 " << end_date << " RESOURCE c" << c << "\n";
+          }
+        }
+    }
+
+    /**
+     * \endcond
+     */
+
+    /**
+     * @brief Export the timeline of a simulated execution to a file
+     *
+     * @param workflow: the executed workflow
+     * @param output: the simulation output
+     * @param path: the path of the output file (which is truncated)
+     * @param format: the output file format
+     * @param buffer_size: the number of bytes buffered in memory before they are written to the file
+     *
+     * @throw std::invalid_argument
+     */
+    void TimelineExporter::exportTimeline(Workflow *workflow, SimulationOutput &output, const std::string &path,
+                                          Format format, size_t buffer_size) {
+
+      if (workflow == nullptr) {
+        throw std::invalid_argument("TimelineExporter::exportTimeline(): invalid arguments");
+      }
+
+      Timeline timeline;
+
+      // Task executions, per host
+      for (auto task : workflow->getTasks()) {
+        if ((task->getState() == WorkflowTask::COMPLETED) and (not task->getExecutionHost().empty())) {
+          timeline.add(task->getStartDate(), task->getEndDate(), timeline.getContainer("host " + task->getExecutionHost()),
+                       TASK, task);
+        }
+      }
+
+      // File transfers, per storage service
+      addFileTransfers<SimulationTimestampFileReadStart, SimulationTimestampFileReadCompletion>(
+              timeline, output, FILE_READ,
+              [](SimulationTimestampFileReadStart *t) {
+                  return TransferKey(t->getFile(), t->getStorageService(), nullptr);
+              },
+              [](SimulationTimestampFileReadCompletion *t) {
+                  return TransferKey(t->getFile(), t->getStorageService(), nullptr);
+              });
+      addFileTransfers<SimulationTimestampFileWriteStart, SimulationTimestampFileWriteCompletion>(
+              timeline, output, FILE_WRITE,
+              [](SimulationTimestampFileWriteStart *t) {
+                  return TransferKey(t->getFile(), t->getStorageService(), nullptr);
+              },
+              [](SimulationTimestampFileWriteCompletion *t) {
+                  return TransferKey(t->getFile(), t->getStorageService(), nullptr);
+              });
+      addFileTransfers<SimulationTimestampFileCopyStart, SimulationTimestampFileCopyCompletion>(
+              timeline, output, FILE_COPY,
+              [](SimulationTimestampFileCopyStart *t) {
+                  return TransferKey(t->getFile(), t->getSource(), t->getDestination());
+              },
+              [](SimulationTimestampFileCopyCompletion *t) {
+                  return TransferKey(t->getFile(), t->getSource(), t->getDestination());
+              });
+
+      // Job lifetimes, per compute service
+      for (auto timestamp : output.getTrace<SimulationTimestampJobCompletion>()) {
+        auto content = timestamp.getContent();
+        unsigned long container = timeline.getContainer(content->getComputeService(), "compute");
+        const std::string *name = timeline.addJobName(content->getJobName());
+        if (content->getStartDate() >= 0) {
+          timeline.add(content->getSubmitDate(), content->getStartDate(), container, JOB_QUEUED, name);
+          timeline.add(content->getStartDate(), timestamp.getDate(), container, JOB_RUNNING, name);
+        } else {
+          timeline.add(content->getSubmitDate(), timestamp.getDate(), container, JOB_RUNNING, name);
+        }
+      }
+      std::map<std::string, std::deque<double>> pilot_job_starts;
+      for (auto timestamp : output.getTrace<SimulationTimestampPilotJobStart>()) {
+        pilot_job_starts[timestamp.getContent()->getJobName()].push_back(timestamp.getDate());
+      }
+      for (auto timestamp : output.getTrace<SimulationTimestampPilotJobExpiration>()) {
+        auto content = timestamp.getContent();
+        auto it = pilot_job_starts.find(content->getJobName());
+        if ((it == pilot_job_starts.end()) or it->second.empty()) {
+          continue;
+        }
+        timeline.add(it->second.front(), timestamp.getDate(),
+                     timeline.getContainer(content->getComputeService(), "compute"),
+                     PILOT_JOB_RUNNING, timeline.addJobName(content->getJobName()));
+        it->second.pop_front();
+      }
+
+      timeline.assignLanes();
+
+      BufferedWriter writer(path, buffer_size);
+      if (format == CHROME_TRACE) {
+        writeChromeTrace(timeline, writer);
+      } else {
+        writePajeTrace(timeline, writer);
+      }
+    }
+
+};
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "wrench/workflow/SpeedupModel.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     *
+     * @param efficiency: the parallel efficiency of each core (number between 0.0 and 1.0)
+     *
+     * @throw std::invalid_argument
+     */
+    ConstantEfficiencySpeedupModel::ConstantEfficiencySpeedupModel(double efficiency) {
+      if ((efficiency <= 0.0) or (efficiency > 1.0)) {
+        throw std::invalid_argument("ConstantEfficiencySpeedupModel::ConstantEfficiencySpeedupModel(): Invalid efficiency");
+      }
+      this->efficiency = efficiency;
+    }
+
+    /**
+     * @brief Get the speedup on some number of cores
+     * @param num_cores: a number of cores
+     * @return the speedup
+     */
+    double ConstantEfficiencySpeedupModel::getSpeedup(unsigned long num_cores) const {
+      return (double) num_cores * this->efficiency;
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param serial_fraction: the fraction of the work that is sequential (number between 0.0 and 1.0)
+     *
+     * @throw std::invalid_argument
+     */
+    AmdahlSpeedupModel::AmdahlSpeedupModel(double serial_fraction) {
+      if ((serial_fraction < 0.0) or (serial_fraction > 1.0)) {
+        throw std::invalid_argument("AmdahlSpeedupModel::AmdahlSpeedupModel(): Invalid serial fraction");
+      }
+      this->serial_fraction = serial_fraction;
+    }
+
+    /**
+     * @brief Get the speedup on some number of cores
+     * @param num_cores: a number of cores
+     * @return the speedup
+     */
+    double AmdahlSpeedupModel::getSpeedup(unsigned long num_cores) const {
+      return 1.0 / (this->serial_fraction + (1.0 - this->serial_fraction) / (double) num_cores);
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param speedups: a map of numbers of cores (at least 1) to speedups (greater than 0)
+     *
+     * @throw std::invalid_argument
+     */
+    TabulatedSpeedupModel::TabulatedSpeedupModel(const std::map<unsigned long, double> &speedups) {
+      if (speedups.empty()) {
+        throw std::invalid_argument("TabulatedSpeedupModel::TabulatedSpeedupModel(): No speedup");
+      }
+      for (auto const &s : speedups) {
+        if ((s.first < 1) or (s.second <= 0.0)) {
+          throw std::invalid_argument("TabulatedSpeedupModel::TabulatedSpeedupModel(): Invalid speedup");
+        }
+        this->speedups.push_back(s);
+      }
+    }
+
+    /**
+     * @brief Get the speedup on some number of cores (in O(log k) time, where k is the
+     *        number of measured speedups)
+     * @param num_cores: a number of cores
+     * @return the speedup
+     */
+    double TabulatedSpeedupModel::getSpeedup(unsigned long num_cores) const {
+      auto next = std::upper_bound(this->speedups.begin(), this->speedups.end(), num_cores,
+                                   [](unsigned long n, const std::pair<unsigned long, double> &s) {
+                                       return n < s.first;
+                                   });
+      if (next == this->speedups.begin()) {
+        return next->second * (double) num_cores / (double) next->first;
+      }
+      auto previous = std::prev(next);
+      if ((previous->first == num_cores) or (next == this->speedups.end())) {
+        return previous->second;
+      }
+      return previous->second + (next->second - previous->second) *
+                                (double) (num_cores - previous->first) / (double) (next->first - previous->first);
+    }
+
+};
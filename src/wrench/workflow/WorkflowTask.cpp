@@ -117,6 +117,39 @@ namespace wrench {
       return this->parallel_efficiency;
     }
 
+    /**
+     * @brief Set the speedup model of the task, which then determines how fast it runs
+     *        on any number of cores (instead of its parallel efficiency)
+     *
+     * @param speedup_model: a speedup model (nullptr to go back to the constant parallel efficiency)
+     */
+    void WorkflowTask::setSpeedupModel(std::shared_ptr<SpeedupModel> speedup_model) {
+      this->speedup_model = std::move(speedup_model);
+    }
+
+    /**
+     * @brief Get the speedup model of the task
+     *
+     * @return a speedup model (nullptr if the task's parallel efficiency is used)
+     */
+    std::shared_ptr<SpeedupModel> WorkflowTask::getSpeedupModel() const {
+      return this->speedup_model;
+    }
+
+    /**
+     * @brief Get the speedup of the task on some number of cores, as given by its speedup
+     *        model or, if it has none, by its constant parallel efficiency
+     *
+     * @param num_cores: a number of cores
+     * @return the speedup (the task's flops are computed this many times faster than by a single core)
+     */
+    double WorkflowTask::getSpeedup(unsigned long num_cores) const {
+      if (this->speedup_model == nullptr) {
+        return (double) num_cores * this->parallel_efficiency;
+      }
+      return this->speedup_model->getSpeedup(num_cores);
+    }
+
     /**
      * @brief Get the memory requirement of the task
      *
@@ -261,6 +294,24 @@ namespace wrench {
       this->end_date = date;
     }
 
+    /**
+     * @brief Set the date at which the task was submitted (as part of a job)
+     *
+     * @param date: the submit date
+     */
+    void WorkflowTask::setSubmitDate(double date) {
+      this->submit_date = date;
+    }
+
+    /**
+     * @brief Set the host on which the task executes
+     *
+     * @param hostname: the host name
+     */
+    void WorkflowTask::setExecutionHost(std::string hostname) {
+      this->execution_host = std::move(hostname);
+    }
+
     /**
      * @brief Set the task to the ready state
      */
@@ -368,4 +419,20 @@ namespace wrench {
     double WorkflowTask::getEndDate() {
       return this->end_date;
     }
+
+    /**
+     * @brief Get the date at which the task was last submitted (as part of a job)
+     * @return the submit date (-1.0 if the task was never submitted)
+     */
+    double WorkflowTask::getSubmitDate() {
+      return this->submit_date;
+    }
+
+    /**
+     * @brief Get the name of the host on which the task last executed
+     * @return a host name (empty if the task never executed)
+     */
+    std::string WorkflowTask::getExecutionHost() {
+      return this->execution_host;
+    }
 };
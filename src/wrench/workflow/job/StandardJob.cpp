@@ -39,22 +39,23 @@ namespace wrench {
                              std::set<std::tuple<WorkflowFile *, StorageService *, StorageService *>> post_file_copies,
                              std::set<std::tuple<WorkflowFile *, StorageService *>> cleanup_file_deletions) :
             WorkflowJob(WorkflowJob::STANDARD),
+            tasks(std::move(tasks)),
+            total_flops(0.0),
             num_completed_tasks(0),
-            file_locations(file_locations),
-            pre_file_copies(pre_file_copies),
-            post_file_copies(post_file_copies),
-            cleanup_file_deletions(cleanup_file_deletions),
+            file_locations(std::move(file_locations)),
+            pre_file_copies(std::move(pre_file_copies)),
+            post_file_copies(std::move(post_file_copies)),
+            cleanup_file_deletions(std::move(cleanup_file_deletions)),
             state(StandardJob::State::NOT_SUBMITTED)
     {
 
-      for (auto t : tasks) {
+      for (auto const &t : this->tasks) {
         if (t->getState() != WorkflowTask::READY) {
           throw std::invalid_argument("StandardJob::StandardJob(): All tasks used to create a StandardJob must be READY");
         }
       }
 
-      for (auto t : tasks) {
-        this->tasks.push_back(t);
+      for (auto const &t : this->tasks) {
         t->setJob(this);
         this->total_flops += t->getFlops();
       }
@@ -75,7 +76,7 @@ namespace wrench {
      */
     unsigned long StandardJob::getMinimumRequiredNumCores() {
       unsigned long min_num_cores = 1;
-      for (auto t : tasks) {
+      for (auto const &t : this->tasks) {
         if (min_num_cores < t->getMinNumCores()) {
           min_num_cores = t->getMinNumCores();
         }
@@ -113,7 +114,7 @@ namespace wrench {
      *
      * @return a vector of workflow tasks
      */
-    std::vector<WorkflowTask *> StandardJob::getTasks() {
+    const std::vector<WorkflowTask *> &StandardJob::getTasks() {
       return this->tasks;
     }
 
@@ -122,7 +123,7 @@ namespace wrench {
      *
      * @return a map of files to storage services
      */
-    std::map<WorkflowFile *, StorageService *> StandardJob::getFileLocations() {
+    const std::map<WorkflowFile *, StorageService *> &StandardJob::getFileLocations() {
       return this->file_locations;
     }
 
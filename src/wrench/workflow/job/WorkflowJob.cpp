@@ -148,4 +148,38 @@ namespace wrench {
      ComputeService *WorkflowJob::getParentComputeService() {
        return this->parent_compute_service;
      }
+
+    /**
+     * @brief Set the date at which the job was submitted
+     * @param date: a date
+     */
+    void WorkflowJob::setSubmitDate(double date) {
+      this->submit_date = date;
+    }
+
+    /**
+     * @brief Get the date at which the job was (last) submitted
+     *
+     * @return a date (-1.0 if the job was never submitted)
+     */
+    double WorkflowJob::getSubmitDate() {
+      return this->submit_date;
+    }
+
+    /**
+     * @brief Set the date at which the job started executing
+     * @param date: a date
+     */
+    void WorkflowJob::setStartDate(double date) {
+      this->start_date = date;
+    }
+
+    /**
+     * @brief Get the date at which the job (last) started executing
+     *
+     * @return a date (-1.0 if the job never started)
+     */
+    double WorkflowJob::getStartDate() {
+      return this->start_date;
+    }
 };
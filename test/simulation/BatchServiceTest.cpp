@@ -43,6 +43,8 @@ public:
 
     void do_BestFitTaskTest_test();
 
+    void do_BestFitMultiNodeTaskTest_test();
+
     void do_noArgumentsJobSubmissionTest_test();
 
     void do_StandardJobTimeOutTaskTest_test();
@@ -1352,6 +1354,132 @@ void BatchServiceTest::do_BestFitTaskTest_test() {
 
 
 
+/**********************************************************************/
+/**  BESTFIT MULTI-NODE STANDARD JOB SUBMISSION SIMULATION TEST     **/
+/**********************************************************************/
+
+class BestFitMultiNodeStandardJobSubmissionTestWMS : public wrench::WMS {
+
+public:
+    BestFitMultiNodeStandardJobSubmissionTestWMS(BatchServiceTest *test,
+                                                 const std::set<wrench::ComputeService *> &compute_services,
+                                                 const std::set<wrench::StorageService *> &storage_services,
+                                                 std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr, hostname,
+                        "test") {
+      this->test = test;
+    }
+
+private:
+
+    BatchServiceTest *test;
+
+    int main() {
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      {
+        // Create two tasks that each need all 4 cores of a node
+        wrench::WorkflowTask *task1 = this->workflow->addTask("task1", 60, 4, 4, 1.0);
+        wrench::WorkflowTask *task2 = this->workflow->addTask("task2", 60, 4, 4, 1.0);
+
+        wrench::StandardJob *job = job_manager->createStandardJob({task1, task2}, {});
+
+        // Two 4-core nodes, which would both fit on any one 10-core host
+        std::map<std::string, std::string> batch_job_args;
+        batch_job_args["-N"] = "2";
+        batch_job_args["-t"] = "5"; //time in minutes
+        batch_job_args["-c"] = "4"; //number of cores per node
+        try {
+          job_manager->submitJob(job, this->test->compute_service, batch_job_args);
+        } catch (wrench::WorkflowExecutionException &e) {
+          throw std::runtime_error(
+                  "Got some exception"
+          );
+        }
+
+        // Wait for a workflow execution event
+        std::unique_ptr<wrench::WorkflowExecutionEvent> event;
+        try {
+          event = this->workflow->waitForNextExecutionEvent();
+        } catch (wrench::WorkflowExecutionException &e) {
+          throw std::runtime_error("Error while getting and execution event: " + e.getCause()->toString());
+        }
+        switch (event->type) {
+          case wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION: {
+            // success, do nothing for now
+            break;
+          }
+          default: {
+            throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+          }
+        }
+
+        // The job's two nodes should be two different hosts
+        if (task1->getExecutionHost() == task2->getExecutionHost()) {
+          throw std::runtime_error("Both tasks ran on host " + task1->getExecutionHost());
+        }
+
+        this->workflow->removeTask(task1);
+        this->workflow->removeTask(task2);
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(BatchServiceTest, BestFitMultiNodeStandardJobSubmissionTest) {
+  DO_TEST_WITH_FORK(do_BestFitMultiNodeTaskTest_test);
+}
+
+void BatchServiceTest::do_BestFitMultiNodeTaskTest_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("batch_service_test");
+
+  EXPECT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = simulation->getHostnameList()[0];
+
+  // Create a Storage Service
+  EXPECT_NO_THROW(storage_service1 = simulation->add(
+                  new wrench::SimpleStorageService(hostname, 10000000000000.0)));
+
+  // Create a Batch Service that selects hosts with BESTFIT
+  ASSERT_NO_THROW(compute_service = simulation->add(
+                  new wrench::BatchService(hostname, true, true, simulation->getHostnameList(),
+                                           storage_service1,
+                                           {{wrench::BatchServiceProperty::HOST_SELECTION_ALGORITHM, "BESTFIT"}})));
+
+  simulation->setFileRegistryService(new wrench::FileRegistryService(hostname));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new BestFitMultiNodeStandardJobSubmissionTestWMS(
+                  this,  {compute_service}, {storage_service1}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  // Running a "run a single job" simulation
+  // Note that in these tests the WMS creates workflow tasks, which a user would
+  // of course not be likely to do
+  EXPECT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+
 /**********************************************************************/
 /**  STANDARDJOB INSIDE PILOT JOB FAILURE TASK SIMULATION TEST ON ONE-ONE HOST                **/
 /**********************************************************************/
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <json.hpp>
+#include <wrench-dev.h>
+
+class CriticalPathAnalyzerTest : public ::testing::Test {
+
+protected:
+    CriticalPathAnalyzerTest() {
+      workflow = new wrench::Workflow();
+      task1 = workflow->addTask("task1", 1.0, 1, 1, 1.0);
+      task2 = workflow->addTask("task2", 1.0, 1, 1, 1.0);
+      task3 = workflow->addTask("task3", 1.0, 1, 1, 1.0);
+      task4 = workflow->addTask("task4", 1.0, 1, 1, 1.0);
+      workflow->addControlDependency(task1, task3);
+      workflow->addControlDependency(task2, task3);
+    }
+
+    ~CriticalPathAnalyzerTest() {
+      delete workflow;
+    }
+
+    void setExecution(wrench::WorkflowTask *task, std::string hostname,
+                      double submit_date, double start_date, double end_date) {
+      task->setSubmitDate(submit_date);
+      task->setStartDate(start_date);
+      task->setEndDate(end_date);
+      task->setExecutionHost(hostname);
+      task->setState(wrench::WorkflowTask::COMPLETED);
+    }
+
+    wrench::Workflow *workflow;
+    wrench::WorkflowTask *task1;
+    wrench::WorkflowTask *task2;
+    wrench::WorkflowTask *task3;
+    wrench::WorkflowTask *task4;
+};
+
+TEST_F(CriticalPathAnalyzerTest, CriticalPathAndIdleTimes) {
+  setExecution(task1, "Host1", 0.0, 1.0, 10.0);
+  setExecution(task2, "Host2", 0.0, 0.0, 4.0);
+  setExecution(task3, "Host1", 12.0, 15.0, 20.0);
+  // task4 never completed
+
+  wrench::SimulationOutput output;
+  wrench::CriticalPathReport report;
+  ASSERT_NO_THROW(report = wrench::CriticalPathAnalyzer::analyze(workflow, output, {"Host1", "Host2", "Host3"}));
+
+  ASSERT_DOUBLE_EQ(20.0, report.makespan);
+
+  // task1 -> task3, as task1 completed after task2
+  ASSERT_EQ(2, report.critical_path.size());
+  ASSERT_EQ(task1, report.critical_path[0].task);
+  ASSERT_EQ(task3, report.critical_path[1].task);
+  ASSERT_EQ("Host1", report.critical_path[1].execution_host);
+
+  ASSERT_DOUBLE_EQ(0.0, report.critical_path[0].scheduling_gap);
+  ASSERT_DOUBLE_EQ(1.0, report.critical_path[0].queue_wait);
+  ASSERT_DOUBLE_EQ(9.0, report.critical_path[0].compute);
+  ASSERT_DOUBLE_EQ(10.0, report.critical_path[1].ready_date);
+  ASSERT_DOUBLE_EQ(2.0, report.critical_path[1].scheduling_gap);
+  ASSERT_DOUBLE_EQ(3.0, report.critical_path[1].queue_wait);
+  ASSERT_DOUBLE_EQ(5.0, report.critical_path[1].compute);
+
+  // The critical path accounts for the whole makespan
+  ASSERT_DOUBLE_EQ(report.makespan, report.compute_time + report.data_transfer_time +
+                                    report.queue_wait_time + report.scheduling_gap_time);
+
+  // Host idle times
+  ASSERT_EQ(3, report.hosts.size());
+  ASSERT_EQ("Host1", report.hosts[0].hostname);
+  ASSERT_EQ(2, report.hosts[0].num_tasks);
+  ASSERT_DOUBLE_EQ(14.0, report.hosts[0].busy_time);
+  ASSERT_DOUBLE_EQ(6.0, report.hosts[0].idle_time);
+  ASSERT_DOUBLE_EQ(4.0, report.hosts[1].busy_time);
+  ASSERT_DOUBLE_EQ(16.0, report.hosts[1].idle_time);
+  ASSERT_EQ(0, report.hosts[2].num_tasks);
+  ASSERT_DOUBLE_EQ(20.0, report.hosts[2].idle_time);
+
+  // JSON export
+  nlohmann::json json = nlohmann::json::parse(report.toJSON());
+  ASSERT_DOUBLE_EQ(20.0, json["makespan"].get<double>());
+  ASSERT_EQ(2, json["critical_path"].size());
+  ASSERT_EQ("task3", json["critical_path"][1]["task"].get<std::string>());
+  ASSERT_EQ(3, json["hosts"].size());
+}
+
+TEST_F(CriticalPathAnalyzerTest, NothingCompleted) {
+  wrench::SimulationOutput output;
+  wrench::CriticalPathReport report = wrench::CriticalPathAnalyzer::analyze(workflow, output);
+  ASSERT_DOUBLE_EQ(0.0, report.makespan);
+  ASSERT_TRUE(report.critical_path.empty());
+  ASSERT_TRUE(report.hosts.empty());
+
+  ASSERT_THROW(wrench::CriticalPathAnalyzer::analyze(nullptr, output), std::invalid_argument);
+}
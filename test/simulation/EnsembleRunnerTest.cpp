@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+
+class EnsembleRunnerTest : public ::testing::Test {
+
+public:
+    void do_EnsembleRunner_test();
+
+    void do_EnsembleRunnerFailure_test();
+
+    void setupOneTaskSimulation(wrench::Simulation *simulation, double flops);
+
+protected:
+    EnsembleRunnerTest() {
+      // Create a platform file
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"QuadCoreHost\" speed=\"1f\" core=\"4\"/> "
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+};
+
+/**
+ * @brief A WMS that runs all workflow tasks in one standard job
+ */
+class EnsembleRunnerTestWMS : public wrench::WMS {
+
+public:
+    EnsembleRunnerTestWMS(const std::set<wrench::ComputeService *> &compute_services,
+                          std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "test") {
+    }
+
+private:
+
+    int main() {
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      wrench::StandardJob *job = job_manager->createStandardJob(this->workflow->getTasks(), {});
+      job_manager->submitJob(job, *(this->getAvailableComputeServices().begin()));
+
+      std::unique_ptr<wrench::WorkflowExecutionEvent> event = this->workflow->waitForNextExecutionEvent();
+      if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+        throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+      }
+      return 0;
+    }
+};
+
+void EnsembleRunnerTest::setupOneTaskSimulation(wrench::Simulation *simulation, double flops) {
+  simulation->instantiatePlatform(platform_file_path);
+  std::string hostname = simulation->getHostnameList()[0];
+
+  wrench::ComputeService *compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService(hostname, true, false, {hostname}, nullptr, {}));
+
+  auto workflow = new wrench::Workflow();
+  workflow->addTask("task", flops, 1, 1, 1.0);
+
+  wrench::WMS *wms = simulation->add(new EnsembleRunnerTestWMS({compute_service}, hostname));
+  wms->addWorkflow(workflow);
+}
+
+/**********************************************************************/
+/**  ENSEMBLE OF SUCCESSFUL SIMULATIONS                              **/
+/**********************************************************************/
+
+TEST_F(EnsembleRunnerTest, Ensemble) {
+  DO_TEST_WITH_FORK(do_EnsembleRunner_test);
+}
+
+void EnsembleRunnerTest::do_EnsembleRunner_test() {
+
+  std::vector<wrench::EnsembleConfiguration> configurations;
+  for (unsigned long i = 1; i <= 5; i++) {
+    double flops = 10.0 * i;
+    configurations.push_back(wrench::EnsembleConfiguration(
+            "simulation_" + std::to_string(i),
+            [this, flops](wrench::Simulation *simulation) { this->setupOneTaskSimulation(simulation, flops); }));
+  }
+
+  wrench::EnsembleRunner runner(2);
+  ASSERT_EQ(2, runner.getMaxNumWorkers());
+
+  std::vector<wrench::EnsembleResult> results;
+  ASSERT_NO_THROW(results = runner.run(configurations));
+  ASSERT_EQ(5, results.size());
+
+  for (unsigned long i = 0; i < results.size(); i++) {
+    ASSERT_EQ("simulation_" + std::to_string(i + 1), results[i].name);
+    ASSERT_TRUE(results[i].success);
+    ASSERT_EQ(1, results[i].task_completion_dates.size());
+    ASSERT_EQ("task", results[i].task_completion_dates[0].first);
+    ASSERT_NEAR(10.0 * (i + 1), results[i].task_completion_dates[0].second, 0.001);
+    ASSERT_GE(results[i].simulated_end_date, results[i].task_completion_dates[0].second);
+  }
+
+  ASSERT_GT(wrench::EnsembleRunner().getMaxNumWorkers(), 0);
+}
+
+/**********************************************************************/
+/**  ENSEMBLE WITH FAILING SIMULATIONS                               **/
+/**********************************************************************/
+
+TEST_F(EnsembleRunnerTest, EnsembleWithFailures) {
+  DO_TEST_WITH_FORK(do_EnsembleRunnerFailure_test);
+}
+
+void EnsembleRunnerTest::do_EnsembleRunnerFailure_test() {
+
+  std::vector<wrench::EnsembleConfiguration> configurations;
+  configurations.push_back(wrench::EnsembleConfiguration(
+          "throws", [](wrench::Simulation *simulation) {
+            throw std::runtime_error("setup failure");
+          }));
+  configurations.push_back(wrench::EnsembleConfiguration(
+          "crashes", [](wrench::Simulation *simulation) {
+            _exit(42);
+          }));
+  configurations.push_back(wrench::EnsembleConfiguration(
+          "succeeds", [this](wrench::Simulation *simulation) { this->setupOneTaskSimulation(simulation, 10.0); }));
+  configurations.push_back(wrench::EnsembleConfiguration(
+          "throws_failure_cause", [](wrench::Simulation *simulation) {
+            throw std::shared_ptr<wrench::FatalFailure>(new wrench::FatalFailure());
+          }));
+  configurations.push_back(wrench::EnsembleConfiguration(
+          "throws_something_else", [](wrench::Simulation *simulation) {
+            throw 42;
+          }));
+
+  std::vector<wrench::EnsembleResult> results;
+  ASSERT_NO_THROW(results = wrench::EnsembleRunner(3).run(configurations));
+  ASSERT_EQ(5, results.size());
+
+  ASSERT_FALSE(results[0].success);
+  ASSERT_EQ("setup failure", results[0].failure_cause);
+
+  ASSERT_EQ("crashes", results[1].name);
+  ASSERT_FALSE(results[1].success);
+  ASSERT_NE(std::string::npos, results[1].failure_cause.find("42"));
+
+  ASSERT_TRUE(results[2].success);
+  ASSERT_EQ(1, results[2].task_completion_dates.size());
+
+  // Non-std::exception exceptions are reported by the worker (rather than unwinding into the runner)
+  ASSERT_EQ("throws_failure_cause", results[3].name);
+  ASSERT_FALSE(results[3].success);
+  ASSERT_EQ(wrench::FatalFailure().toString(), results[3].failure_cause);
+  ASSERT_EQ("throws_something_else", results[4].name);
+  ASSERT_FALSE(results[4].success);
+  ASSERT_EQ(std::string::npos, results[4].failure_cause.find("without reporting a result"));
+
+  // Serialization round trip
+  wrench::EnsembleResult result = wrench::EnsembleRunner::deserializeResult(
+          wrench::EnsembleRunner::serializeResult(results[2]));
+  ASSERT_EQ(results[2].name, result.name);
+  ASSERT_EQ(results[2].task_completion_dates, result.task_completion_dates);
+  ASSERT_THROW(wrench::EnsembleRunner::deserializeResult("garbage"), std::runtime_error);
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+class HostCapacityIndexTest : public ::testing::Test {
+
+protected:
+    HostCapacityIndexTest() {
+      index.setCapacity("Host1", 2, 100.0);
+      index.setCapacity("Host2", 4, 50.0);
+      index.setCapacity("Host3", 4, 200.0);
+      index.setCapacity("Host4", 8, 10.0);
+    }
+
+    wrench::HostCapacityIndex index;
+};
+
+TEST_F(HostCapacityIndexTest, BestFit) {
+  // Fewest idle cores among hosts with at least the desired number of cores
+  ASSERT_EQ("Host2", index.findBestFit(1, 3, 0.0));
+  ASSERT_EQ("Host1", index.findBestFit(1, 2, 0.0));
+  // ... with enough RAM
+  ASSERT_EQ("Host3", index.findBestFit(1, 3, 60.0));
+  ASSERT_EQ("Host3", index.findBestFit(1, 2, 150.0));
+  ASSERT_EQ("Host1", index.findBestFit(2, 2, 90.0));
+  // Otherwise, most idle cores among hosts with at least the minimum number of cores
+  ASSERT_EQ("Host4", index.findBestFit(1, 16, 0.0));
+  ASSERT_EQ("Host2", index.findBestFit(1, 16, 20.0));
+  ASSERT_EQ("Host3", index.findBestFit(1, 16, 80.0));
+  ASSERT_EQ("", index.findBestFit(2, 16, 500.0));
+  ASSERT_EQ("", index.findBestFit(10, 16, 0.0));
+}
+
+TEST_F(HostCapacityIndexTest, FirstAndWorstFit) {
+  ASSERT_EQ("Host1", index.findFirstFit(1, 0.0));
+  ASSERT_EQ("Host2", index.findFirstFit(3, 0.0));
+  ASSERT_EQ("Host3", index.findFirstFit(1, 150.0));
+  ASSERT_EQ("Host4", index.findFirstFit(5, 0.0));
+  ASSERT_EQ("", index.findFirstFit(9, 0.0));
+  ASSERT_EQ("", index.findFirstFit(5, 20.0));
+
+  // First fit is in the order in which hosts were added, regardless of their idle cores
+  index.setCapacity("Host1", 8, 100.0);
+  ASSERT_EQ("Host1", index.findFirstFit(3, 0.0));
+  index.remove("Host1");
+  ASSERT_EQ("Host2", index.findFirstFit(3, 0.0));
+  index.setCapacity("Host1", 8, 100.0);
+  ASSERT_EQ("Host1", index.findFirstFit(3, 0.0));
+  index.setCapacity("Host1", 2, 100.0);
+
+  ASSERT_EQ("Host4", index.findWorstFit(1, 0.0));
+  ASSERT_EQ("Host2", index.findWorstFit(1, 20.0));
+  ASSERT_EQ("Host3", index.findWorstFit(1, 100.0));
+  ASSERT_EQ("Host3", index.findWorstFit(3, 60.0));
+  ASSERT_EQ("", index.findWorstFit(1, 500.0));
+}
+
+TEST_F(HostCapacityIndexTest, PackingFit) {
+  // Most cores first, then least idle cores and available RAM (relative to 4 cores and 200 bytes)
+  ASSERT_EQ("Host4", index.findPackingFit(1, 8, 0.0, 4, 200.0));
+  ASSERT_EQ("Host1", index.findPackingFit(1, 1, 40.0, 4, 200.0));
+  ASSERT_EQ("Host2", index.findPackingFit(3, 3, 40.0, 4, 200.0));
+  ASSERT_EQ("", index.findPackingFit(1, 1, 500.0, 4, 200.0));
+
+  // Reservations that other hosts have room for do not matter
+  ASSERT_EQ("Host1", index.findPackingFit(1, 1, 40.0, 4, 200.0, {{2, 80.0}}));
+  // ... unless there are no more of them than there are identical reservations
+  ASSERT_EQ("Host2", index.findPackingFit(1, 1, 40.0, 4, 200.0, {{2, 80.0}, {2, 80.0}}));
+
+  // ... but the last host with room for a reservation is avoided, if possible
+  index.remove("Host3");
+  ASSERT_EQ("Host1", index.findPackingFit(1, 1, 40.0, 4, 200.0));
+  ASSERT_EQ("Host2", index.findPackingFit(1, 1, 40.0, 4, 200.0, {{2, 80.0}}));
+  ASSERT_EQ("Host1", index.findPackingFit(1, 1, 60.0, 4, 200.0, {{2, 80.0}}));
+}
+
+TEST_F(HostCapacityIndexTest, Updates) {
+  index.setCapacity("Host4", 1, 10.0);
+  ASSERT_EQ(1, index.getNumCores("Host4"));
+  ASSERT_DOUBLE_EQ(10.0, index.getRam("Host4"));
+  ASSERT_EQ("Host1", index.findFirstFit(1, 0.0));
+  ASSERT_EQ("Host2", index.findWorstFit(1, 0.0));
+
+  index.remove("Host2");
+  index.remove("Host3");
+  ASSERT_EQ(2, index.size());
+  ASSERT_EQ("Host1", index.findBestFit(1, 4, 0.0));
+  ASSERT_THROW(index.getNumCores("Host2"), std::invalid_argument);
+
+  index.clear();
+  ASSERT_EQ(0, index.size());
+  ASSERT_EQ("", index.findWorstFit(1, 0.0));
+}
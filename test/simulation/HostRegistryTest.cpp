@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+
+class HostRegistryTest : public ::testing::Test {
+
+public:
+    void do_HostRegistry_test();
+
+protected:
+    HostRegistryTest() {
+      // Create a platform file, with one host that has an invalid memory capacity specification
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"2\"> "
+              "           <prop id=\"ram\" value=\"1024\"/> "
+              "       </host> "
+              "       <host id=\"Host2\" speed=\"10f\" core=\"8\"/> "
+              "       <host id=\"Host3\" speed=\"1f\" core=\"1\"> "
+              "           <prop id=\"ram\" value=\"1024\"/> "
+              "           <prop id=\"memory\" value=\"2048\"/> "
+              "       </host> "
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+};
+
+TEST_F(HostRegistryTest, IdsAndAttributes) {
+  DO_TEST_WITH_FORK(do_HostRegistry_test);
+}
+
+void HostRegistryTest::do_HostRegistry_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("host_registry_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform builds the registry
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+  ASSERT_EQ(3, wrench::S4U_HostRegistry::getNumHosts());
+
+  // Ids are dense, and map back to hostnames
+  std::set<unsigned long> host_ids;
+  for (auto const &hostname : simulation->getHostnameList()) {
+    unsigned long host_id = wrench::S4U_HostRegistry::getHostId(hostname);
+    ASSERT_LT(host_id, wrench::S4U_HostRegistry::getNumHosts());
+    ASSERT_EQ(hostname, wrench::S4U_HostRegistry::getHostname(host_id));
+    ASSERT_EQ(hostname, wrench::S4U_HostRegistry::getHost(host_id)->getName());
+    host_ids.insert(host_id);
+  }
+  ASSERT_EQ(3, host_ids.size());
+
+  // Cached attributes match those returned by the simulation
+  unsigned long host_id = wrench::S4U_HostRegistry::getHostId("Host2");
+  ASSERT_EQ(8, wrench::S4U_HostRegistry::getNumCores(host_id));
+  ASSERT_EQ(simulation->getHostNumCores("Host2"), wrench::S4U_HostRegistry::getNumCores(host_id));
+  ASSERT_DOUBLE_EQ(10.0, wrench::S4U_HostRegistry::getFlopRate(host_id));
+  ASSERT_DOUBLE_EQ(simulation->getHostFlopRate("Host2"), wrench::S4U_HostRegistry::getFlopRate(host_id));
+  ASSERT_DOUBLE_EQ(wrench::ComputeService::ALL_RAM, wrench::S4U_HostRegistry::getMemoryCapacity(host_id));
+  ASSERT_DOUBLE_EQ(1024.0, simulation->getHostMemoryCapacity("Host1"));
+
+  // Invalid memory capacity specifications are reported upon lookup
+  ASSERT_THROW(simulation->getHostMemoryCapacity("Host3"), std::invalid_argument);
+
+  // Unknown hosts and invalid ids
+  ASSERT_EQ(wrench::S4U_HostRegistry::NO_HOST, wrench::S4U_HostRegistry::findHostId("bogus"));
+  ASSERT_THROW(wrench::S4U_HostRegistry::getHostId("bogus"), std::invalid_argument);
+  ASSERT_THROW(wrench::S4U_HostRegistry::getNumCores(3), std::invalid_argument);
+  ASSERT_THROW(simulation->getHostNumCores("bogus"), std::invalid_argument);
+
+  // Hostnames remain valid when hosts are registered after the registry was built
+  wrench::S4U_HostRegistry::build({simgrid::s4u::Host::by_name("Host1")});
+  const std::string &hostname = wrench::S4U_HostRegistry::getHostname(0);
+  ASSERT_EQ(1, wrench::S4U_HostRegistry::getHostId("Host2"));
+  ASSERT_EQ(2, wrench::S4U_HostRegistry::getHostId("Host3"));
+  ASSERT_EQ("Host1", hostname);
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
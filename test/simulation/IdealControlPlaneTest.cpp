@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+#include "../../src/wrench/services/storage/StorageServiceMessage.h"
+
+class IdealControlPlaneTest : public ::testing::Test {
+
+public:
+    wrench::ComputeService *compute_service = nullptr;
+    wrench::StorageService *storage_service = nullptr;
+    wrench::WorkflowFile *file = nullptr;
+
+    void do_IdealControlPlane_test();
+
+protected:
+    IdealControlPlaneTest() {
+      // Create a platform file, with a high-latency link between the two hosts
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"WMSHost\" speed=\"1f\" core=\"1\"/> "
+              "       <host id=\"RemoteHost\" speed=\"1f\" core=\"4\"/> "
+              "       <link id=\"1\" bandwidth=\"1MBps\" latency=\"100ms\"/>"
+              "       <route src=\"WMSHost\" dst=\"RemoteHost\"> <link_ctn id=\"1\"/> </route>"
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+};
+
+/**
+ * @brief A WMS that checks that control messages take no simulated time, but that file transfers do
+ */
+class IdealControlPlaneTestWMS : public wrench::WMS {
+
+public:
+    IdealControlPlaneTestWMS(IdealControlPlaneTest *test,
+                             const std::set<wrench::ComputeService *> &compute_services,
+                             const std::set<wrench::StorageService *> &storage_services,
+                             std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    IdealControlPlaneTest *test;
+
+    int main() {
+
+      double date = this->simulation->getCurrentSimulatedDate();
+      for (unsigned int i = 0; i < 10; i++) {
+        if (this->test->compute_service->getNumIdleCores() != std::vector<unsigned long>({4})) {
+          throw std::runtime_error("Unexpected number of idle cores");
+        }
+      }
+      if (this->simulation->getCurrentSimulatedDate() != date) {
+        throw std::runtime_error("Control messages should take no simulated time");
+      }
+      if (wrench::S4U_Mailbox::getNumMemoryMessages() == 0) {
+        throw std::runtime_error("Control messages should be delivered in memory");
+      }
+
+      // The answer to the read request is a control message, but the file content isn't
+      this->test->storage_service->readFile(this->test->file);
+      if (this->simulation->getCurrentSimulatedDate() - date < 1.0) {
+        throw std::runtime_error("File transfers should be simulated");
+      }
+
+      // Messages to a mailbox are received in the order in which they were sent, whether they go
+      // through the network or in memory
+      std::string mailbox_name = wrench::S4U_Mailbox::generateUniqueMailboxName("ideal_control_plane_test");
+      wrench::S4U_Mailbox::dputMessage(mailbox_name, new wrench::StorageServiceFileContentMessage(this->test->file));
+      wrench::S4U_Mailbox::dputMessage(mailbox_name, new wrench::SimulationMessage("control", 0));
+      if (not dynamic_cast<wrench::StorageServiceFileContentMessage *>(
+              wrench::S4U_Mailbox::getMessage(mailbox_name).get())) {
+        throw std::runtime_error("A control message should not be received before an earlier data message");
+      }
+      if (wrench::S4U_Mailbox::getMessage(mailbox_name)->getName() != "control") {
+        throw std::runtime_error("Unexpected message");
+      }
+
+      // Control messages that go through the network while a reception is posted are received
+      // by later synchronous receptions
+      auto pending_communication = wrench::S4U_Mailbox::igetMessage(mailbox_name);
+      wrench::S4U_Mailbox::dputMessage(mailbox_name, new wrench::SimulationMessage("first", 0));
+      wrench::S4U_Mailbox::dputMessage(mailbox_name, new wrench::SimulationMessage("second", 0));
+      if (pending_communication->wait()->getName() != "first") {
+        throw std::runtime_error("The posted reception should get the first message");
+      }
+      wrench::S4U_Mailbox::dputMessage(mailbox_name, new wrench::SimulationMessage("third", 0));
+      try {
+        if ((wrench::S4U_Mailbox::getMessage(mailbox_name, 10.0)->getName() != "second") or
+            (wrench::S4U_Mailbox::getMessage(mailbox_name, 10.0)->getName() != "third")) {
+          throw std::runtime_error("Control messages should be received in the order in which they were sent");
+        }
+      } catch (std::shared_ptr<wrench::NetworkTimeout> &e) {
+        throw std::runtime_error("A control message sent through the network was never received");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(IdealControlPlaneTest, ControlMessagesTakeNoTime) {
+  DO_TEST_WITH_FORK(do_IdealControlPlane_test);
+}
+
+void IdealControlPlaneTest::do_IdealControlPlane_test() {
+
+  // Create and initialize a simulation, in ideal control plane mode
+  auto simulation = new wrench::Simulation();
+  int argc = 2;
+  auto argv = (char **) calloc(3, sizeof(char *));
+  argv[0] = strdup("ideal_control_plane_test");
+  char *flag = strdup("--wrench-ideal-control-plane");
+  argv[1] = flag;
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+  ASSERT_TRUE(wrench::S4U_Mailbox::isIdealControlPlane());
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Create a Storage Service
+  ASSERT_NO_THROW(storage_service = simulation->add(
+          new wrench::SimpleStorageService("RemoteHost", 10000000.0)));
+
+  // Create a Compute Service
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService("RemoteHost", true, false,
+                                                       std::set<std::string>({"RemoteHost"}),
+                                                       storage_service, {})));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new IdealControlPlaneTestWMS(this, {compute_service}, {storage_service}, "WMSHost")));
+
+  // Create a workflow with a 1MB file, staged on the storage service
+  auto workflow = new wrench::Workflow();
+  ASSERT_NO_THROW(file = workflow->addFile("file", 1000000.0));
+  ASSERT_NO_THROW(wms->addWorkflow(workflow));
+  ASSERT_NO_THROW(simulation->stageFile(file, storage_service));
+
+  // Running the simulation
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+  free(argv[0]);
+  free(flag);
+  free(argv);
+}
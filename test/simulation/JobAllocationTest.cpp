@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+
+/** @brief The number of heap allocations performed by the process so far */
+static std::atomic<unsigned long> num_allocations(0);
+
+/*
+ * Replacements of the global allocation functions, which count heap allocations
+ * (the array, nothrow and sized forms, by default, call these). Since they apply to the
+ * whole program, this test is built into its own executable (allocation_tests), and
+ * not into unit_tests.
+ */
+void *operator new(std::size_t size) {
+  num_allocations++;
+  void *ptr = std::malloc(size ? size : 1);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+#define NUM_TASKS_PER_JOB 10
+#define NUM_UNRELATED_FILES 1000
+
+class JobAllocationTest : public ::testing::Test {
+
+public:
+    wrench::ComputeService *compute_service = nullptr;
+    wrench::StorageService *storage_service = nullptr;
+    std::vector<wrench::WorkflowTask *> tasks;
+    std::vector<wrench::WorkflowFile *> unrelated_files;
+
+    void do_JobAllocation_test();
+
+protected:
+    JobAllocationTest() {
+      // Create a one-host platform file
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"10\"/> "
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+};
+
+/**
+ * @brief A WMS that checks that the number of heap allocations performed to execute a job
+ *        doesn't grow with the number of tasks times the size of the job's file location map
+ */
+class JobAllocationTestWMS : public wrench::WMS {
+
+public:
+    JobAllocationTestWMS(JobAllocationTest *test,
+                         const std::set<wrench::ComputeService *> &compute_services,
+                         const std::set<wrench::StorageService *> &storage_services,
+                         std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    JobAllocationTest *test;
+
+    /**
+     * @brief Execute a job and count the heap allocations performed until it completes
+     *
+     * @param job_manager: the job manager
+     * @param job: the job
+     * @return a number of allocations
+     */
+    unsigned long countJobAllocations(std::shared_ptr<wrench::JobManager> job_manager, wrench::StandardJob *job) {
+      unsigned long start = num_allocations;
+      job_manager->submitJob(job, this->test->compute_service);
+      std::unique_ptr<wrench::WorkflowExecutionEvent> event = this->workflow->waitForNextExecutionEvent();
+      if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+        throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+      }
+      return num_allocations - start;
+    }
+
+    int main() {
+
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // Two identical jobs, the second one with many unrelated entries in its file location map
+      std::map<wrench::WorkflowFile *, wrench::StorageService *> small_file_locations;
+      std::map<wrench::WorkflowFile *, wrench::StorageService *> large_file_locations;
+      for (unsigned long i = 0; i < NUM_TASKS_PER_JOB; i++) {
+        small_file_locations.insert(
+                std::make_pair(*(this->test->tasks[i]->getInputFiles().begin()), this->test->storage_service));
+        large_file_locations.insert(
+                std::make_pair(*(this->test->tasks[NUM_TASKS_PER_JOB + i]->getInputFiles().begin()),
+                               this->test->storage_service));
+      }
+      for (auto const &f : this->test->unrelated_files) {
+        large_file_locations.insert(std::make_pair(f, this->test->storage_service));
+      }
+
+      wrench::StandardJob *small_job = job_manager->createStandardJob(
+              {this->test->tasks.begin(), this->test->tasks.begin() + NUM_TASKS_PER_JOB},
+              std::move(small_file_locations), {}, {}, {});
+      wrench::StandardJob *large_job = job_manager->createStandardJob(
+              {this->test->tasks.begin() + NUM_TASKS_PER_JOB, this->test->tasks.end()},
+              std::move(large_file_locations), {}, {}, {});
+
+      unsigned long small_job_allocations = this->countJobAllocations(job_manager, small_job);
+      unsigned long large_job_allocations = this->countJobAllocations(job_manager, large_job);
+
+      // Copying the file location map for each task would take NUM_TASKS_PER_JOB * NUM_UNRELATED_FILES allocations
+      if (large_job_allocations > small_job_allocations + NUM_UNRELATED_FILES) {
+        throw std::runtime_error("Executing a job shouldn't copy its file location map (" +
+                                 std::to_string(large_job_allocations) + " allocations vs. " +
+                                 std::to_string(small_job_allocations) + ")");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(JobAllocationTest, FileLocationsAreNotCopied) {
+  DO_TEST_WITH_FORK(do_JobAllocation_test);
+}
+
+void JobAllocationTest::do_JobAllocation_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("job_allocation_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Create a Storage Service
+  ASSERT_NO_THROW(storage_service = simulation->add(
+          new wrench::SimpleStorageService("Host1", 10000000.0)));
+
+  // Create a Compute Service
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService("Host1", true, false,
+                                                       std::set<std::string>({"Host1"}),
+                                                       nullptr, {})));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new JobAllocationTestWMS(this, {compute_service}, {storage_service}, "Host1")));
+
+  // Create a workflow with independent tasks that each read a staged file, and unrelated files
+  auto workflow = new wrench::Workflow();
+  for (unsigned long i = 0; i < 2 * NUM_TASKS_PER_JOB; i++) {
+    wrench::WorkflowTask *task = workflow->addTask("task_" + std::to_string(i), 10.0, 1, 1, 1.0);
+    wrench::WorkflowFile *file = workflow->addFile("file_" + std::to_string(i), 1.0);
+    task->addInputFile(file);
+    tasks.push_back(task);
+  }
+  for (unsigned long i = 0; i < NUM_UNRELATED_FILES; i++) {
+    unrelated_files.push_back(workflow->addFile("unrelated_file_" + std::to_string(i), 1.0));
+  }
+  ASSERT_NO_THROW(wms->addWorkflow(workflow));
+  for (auto const &task : tasks) {
+    ASSERT_NO_THROW(simulation->stageFile(*(task->getInputFiles().begin()), storage_service));
+  }
+
+  // Running the simulation
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+class MoldableCoreAllocatorTest : public ::testing::Test {
+
+protected:
+    MoldableCoreAllocatorTest() {
+      workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+      task1 = workflow->addTask("task1", 100.0, 1, 8, 1.0, 0);
+      task2 = workflow->addTask("task2", 400.0, 1, 8, 1.0, 0);
+      task3 = workflow->addTask("task3", 100.0, 4, 4, 1.0, 0);
+      task4 = workflow->addTask("task4", 100.0, 1, 8, 0.5, 0);
+    }
+
+    std::unique_ptr<wrench::Workflow> workflow;
+    wrench::WorkflowTask *task1, *task2, *task3, *task4;
+};
+
+TEST_F(MoldableCoreAllocatorTest, ExecutionTime) {
+  ASSERT_DOUBLE_EQ(25.0, wrench::MoldableCoreAllocator::estimateExecutionTime(task1, 4));
+  ASSERT_DOUBLE_EQ(100.0, wrench::MoldableCoreAllocator::estimateExecutionTime(task4, 2));
+  task4->setSpeedupModel(std::make_shared<wrench::AmdahlSpeedupModel>(0.5));
+  ASSERT_DOUBLE_EQ(75.0, wrench::MoldableCoreAllocator::estimateExecutionTime(task4, 2));
+  ASSERT_THROW(wrench::MoldableCoreAllocator::estimateExecutionTime(task1, 0), std::invalid_argument);
+  ASSERT_THROW(wrench::MoldableCoreAllocator::estimateExecutionTime(nullptr, 1), std::invalid_argument);
+}
+
+TEST_F(MoldableCoreAllocatorTest, Allocation) {
+  std::map<wrench::WorkflowTask *, unsigned long> allocation;
+
+  // Cores go to the task that would complete last
+  allocation = wrench::MoldableCoreAllocator::allocate({task1, task2}, {8});
+  ASSERT_EQ(2, allocation.size());
+  ASSERT_EQ(2, allocation[task1]);
+  ASSERT_EQ(6, allocation[task2]);
+
+  // ... until its host has no more idle cores, in which case other cores are left idle
+  allocation = wrench::MoldableCoreAllocator::allocate({task1, task2}, {4, 4});
+  ASSERT_EQ(2, allocation[task1]);
+  ASSERT_EQ(4, allocation[task2]);
+
+  // Tasks are admitted, in order, with their minimum numbers of cores
+  allocation = wrench::MoldableCoreAllocator::allocate({task3, task1, task2}, {5});
+  ASSERT_EQ(2, allocation.size());
+  ASSERT_EQ(4, allocation[task3]);
+  ASSERT_EQ(1, allocation[task1]);
+
+  // Tasks that cannot fit on a host are never admitted
+  allocation = wrench::MoldableCoreAllocator::allocate({task3, task1}, {2, 2, 2, 2});
+  ASSERT_EQ(1, allocation.size());
+  ASSERT_EQ(2, allocation[task1]);
+
+  // ... even if the hosts have enough idle cores overall
+  wrench::WorkflowTask *task5 = workflow->addTask("task5", 100.0, 4, 4, 1.0, 0);
+  allocation = wrench::MoldableCoreAllocator::allocate({task3, task5}, {6, 2});
+  ASSERT_EQ(1, allocation.size());
+  ASSERT_EQ(4, allocation[task3]);
+  allocation = wrench::MoldableCoreAllocator::allocate({task3, task5}, {4, 4});
+  ASSERT_EQ(2, allocation.size());
+
+  // Cores that would not make a task complete earlier are not given to it
+  task4->setSpeedupModel(std::make_shared<wrench::AmdahlSpeedupModel>(1.0));
+  allocation = wrench::MoldableCoreAllocator::allocate({task4}, {8});
+  ASSERT_EQ(1, allocation[task4]);
+
+  ASSERT_TRUE(wrench::MoldableCoreAllocator::allocate({task1}, {0}).empty());
+  ASSERT_TRUE(wrench::MoldableCoreAllocator::allocate({task1}, {}).empty());
+  ASSERT_THROW(wrench::MoldableCoreAllocator::allocate({nullptr}, {8}), std::invalid_argument);
+}
@@ -21,6 +21,7 @@ public:
     wrench::WorkflowFile *output_file;
     wrench::WorkflowTask *task;
     wrench::WorkflowTask *task_big;
+    wrench::WorkflowTask *task_amdahl;
     wrench::StorageService *storage_service1 = nullptr;
     wrench::StorageService *storage_service2 = nullptr;
     wrench::ComputeService *compute_service = nullptr;
@@ -47,6 +48,8 @@ public:
 
     void do_ExecutionWithDownService_test();
 
+    void do_ExecutionWithSpeedupModel_test();
+
 
 protected:
     MultihostMulticoreComputeServiceOneTaskTest() {
@@ -63,6 +66,8 @@ protected:
       task_big = workflow->addTask("task2", 3600, 2, 2, 2048);
       task->addInputFile(input_file);
       task->addOutputFile(output_file);
+      task_amdahl = workflow->addTask("task_amdahl", 3600, 2, 2, 1.0, 0);
+      task_amdahl->setSpeedupModel(std::make_shared<wrench::AmdahlSpeedupModel>(0.25));
 
       // Create a one-host platform file
       std::string xml = "<?xml version='1.0'?>"
@@ -864,7 +869,7 @@ void MultihostMulticoreComputeServiceOneTaskTest::do_ExecutionWithLocationMap_te
   ASSERT_GT(task->getEndDate(), 0.0);
   ASSERT_GT(task->getEndDate(), task->getStartDate());
 
-  std::vector<wrench::SimulationTimestamp<wrench::SimulationTimestampTaskCompletion> *> task_completion_trace =
+  wrench::SimulationTraceView<wrench::SimulationTimestampTaskCompletion> task_completion_trace =
           simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>();
   ASSERT_EQ(simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>().size(), 1);
   ASSERT_EQ(simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>()[0]->getDate(),
@@ -985,7 +990,7 @@ void MultihostMulticoreComputeServiceOneTaskTest::do_ExecutionWithDefaultStorage
   ASSERT_GT(task->getEndDate(), 0.0);
   ASSERT_GT(task->getEndDate(), task->getStartDate());
 
-  std::vector<wrench::SimulationTimestamp<wrench::SimulationTimestampTaskCompletion> *> task_completion_trace =
+  wrench::SimulationTraceView<wrench::SimulationTimestampTaskCompletion> task_completion_trace =
           simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>();
   ASSERT_EQ(simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>().size(), 1);
   ASSERT_EQ(simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>()[0]->getDate(),
@@ -1132,7 +1137,7 @@ void MultihostMulticoreComputeServiceOneTaskTest::do_ExecutionWithPrePostCopies_
   ASSERT_GT(task->getEndDate(), 0.0);
   ASSERT_GT(task->getEndDate(), task->getStartDate());
 
-  std::vector<wrench::SimulationTimestamp<wrench::SimulationTimestampTaskCompletion> *> task_completion_trace =
+  wrench::SimulationTraceView<wrench::SimulationTimestampTaskCompletion> task_completion_trace =
           simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>();
   ASSERT_EQ(simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>().size(), 1);
   ASSERT_EQ(simulation->output.getTrace<wrench::SimulationTimestampTaskCompletion>()[0]->getDate(),
@@ -1647,4 +1652,95 @@ void MultihostMulticoreComputeServiceOneTaskTest::do_ExecutionWithDownService_te
 
   free(argv[0]);
   free(argv);
-}
\ No newline at end of file
+}
+
+/**********************************************************************/
+/**  EXECUTION WITH SPEEDUP MODEL SIMULATION TEST                    **/
+/**********************************************************************/
+
+class ExecutionWithSpeedupModelTestWMS : public wrench::WMS {
+
+public:
+    ExecutionWithSpeedupModelTestWMS(MultihostMulticoreComputeServiceOneTaskTest *test,
+                                     const std::set<wrench::ComputeService *> &compute_services,
+                                     const std::set<wrench::StorageService *> &storage_services,
+                                     std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+
+private:
+
+    MultihostMulticoreComputeServiceOneTaskTest *test;
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // Create a job
+      wrench::StandardJob *job = job_manager->createStandardJob(test->task_amdahl, {});
+
+      // Submit the job
+      job_manager->submitJob(job, test->compute_service);
+
+      // Wait for the workflow execution event
+      std::unique_ptr<wrench::WorkflowExecutionEvent> event = workflow->waitForNextExecutionEvent();
+      if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+        throw std::runtime_error("Unexpected workflow execution event!");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(MultihostMulticoreComputeServiceOneTaskTest, ExecutionWithSpeedupModel) {
+  DO_TEST_WITH_FORK(do_ExecutionWithSpeedupModel_test);
+}
+
+void MultihostMulticoreComputeServiceOneTaskTest::do_ExecutionWithSpeedupModel_test() {
+
+  // Create and initialize a simulation
+  auto *simulation = new wrench::Simulation();
+  int argc = 1;
+  auto **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("one_task_test");
+
+  simulation->init(&argc, argv);
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname (2 cores)
+  std::string hostname = "SingleHost";
+
+  // Create a Compute Service
+  EXPECT_NO_THROW(compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService(hostname, true, true,
+                                                       {std::make_tuple(hostname, wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM)},
+                                                       nullptr,
+                                                       {})));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new ExecutionWithSpeedupModelTestWMS(this, {compute_service}, {}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow));
+
+  // Running a "run a single task" simulation
+  EXPECT_NO_THROW(simulation->launch());
+
+  // The task ran on both cores, at the speedup given by its Amdahl model (1.6) rather
+  // than at the default linear speedup (2.0)
+  ASSERT_EQ(task_amdahl->getState(), wrench::WorkflowTask::COMPLETED);
+  double expected_duration = task_amdahl->getFlops() / task_amdahl->getSpeedup(2);
+  ASSERT_LT(fabs(task_amdahl->getEndDate() - expected_duration), 0.001);
+  ASSERT_LT(fabs(task_amdahl->getEndDate() - task_amdahl->getStartDate() - expected_duration), 0.001);
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "wrench/services/compute/standard_job_executor/Workunit.h"
+#include "wrench/services/compute/standard_job_executor/ReadyWorkunitQueue.h"
+
+class ReadyWorkunitQueueTest : public ::testing::Test {
+
+protected:
+    ReadyWorkunitQueueTest() {
+      workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+      task1 = workflow->addTask("task1", 100.0, 1, 1, 1.0, 0);
+      task2 = workflow->addTask("task2", 300.0, 1, 1, 1.0, 0);
+      task3 = workflow->addTask("task3", 200.0, 4, 4, 1.0, 0);
+      task4 = workflow->addTask("task4", 300.0, 2, 2, 1.0, 0);
+    }
+
+    wrench::Workunit *createWorkunit(wrench::WorkflowTask *task) {
+      std::vector<wrench::WorkflowTask *> tasks;
+      if (task) {
+        tasks.push_back(task);
+      }
+      return new wrench::Workunit({}, tasks, {}, {}, {});
+    }
+
+    std::unique_ptr<wrench::Workflow> workflow;
+    wrench::WorkflowTask *task1, *task2, *task3, *task4;
+};
+
+TEST_F(ReadyWorkunitQueueTest, MaximumFlops) {
+  wrench::ReadyWorkunitQueue queue(wrench::ReadyWorkunitQueue::MAXIMUM_FLOPS);
+
+  wrench::Workunit *wu1 = createWorkunit(task1);
+  wrench::Workunit *wu2 = createWorkunit(task2);
+  wrench::Workunit *wu3 = createWorkunit(task3);
+  wrench::Workunit *wu4 = createWorkunit(task4);
+  wrench::Workunit *wu5 = createWorkunit(nullptr);
+
+  queue.push(std::unique_ptr<wrench::Workunit>(wu1));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu2));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu3));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu4));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu5));
+  ASSERT_EQ(5, queue.size());
+  ASSERT_EQ((std::vector<wrench::Workunit *>{wu5, wu2, wu4, wu3, wu1}), queue.getWorkunits());
+
+  // Non-computational workunits first, then by decreasing flops, ties broken in queuing order
+  ASSERT_EQ(wu5, queue.pop().get());
+  ASSERT_EQ(wu2, queue.top());
+  std::unique_ptr<wrench::Workunit> wu = queue.pop();
+  ASSERT_EQ(wu2, wu.get());
+
+  // A workunit queued again keeps its rank among equal-priority workunits
+  queue.push(std::move(wu));
+  ASSERT_EQ(wu2, queue.pop().get());
+  ASSERT_EQ(wu4, queue.pop().get());
+  ASSERT_EQ(wu3, queue.pop().get());
+  ASSERT_EQ(wu1, queue.pop().get());
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(ReadyWorkunitQueueTest, MaximumMinimumCores) {
+  wrench::ReadyWorkunitQueue queue(
+          wrench::ReadyWorkunitQueue::getSelectionPolicy("maximum_minimum_cores"));
+
+  wrench::Workunit *wu1 = createWorkunit(task1);
+  wrench::Workunit *wu2 = createWorkunit(task2);
+  wrench::Workunit *wu3 = createWorkunit(task3);
+  wrench::Workunit *wu4 = createWorkunit(task4);
+
+  queue.push(std::unique_ptr<wrench::Workunit>(wu1));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu2));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu3));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu4));
+
+  // Removing an arbitrary workunit keeps the heap ordered
+  ASSERT_EQ(wu4, queue.remove(wu4).get());
+  ASSERT_EQ(wu3, queue.pop().get());
+  ASSERT_EQ(wu1, queue.pop().get());
+  ASSERT_EQ(wu2, queue.pop().get());
+  ASSERT_TRUE(queue.empty());
+
+  ASSERT_THROW(wrench::ReadyWorkunitQueue::getSelectionPolicy("bogus"), std::invalid_argument);
+}
+
+TEST_F(ReadyWorkunitQueueTest, BlockAndUnblock) {
+  wrench::ReadyWorkunitQueue queue(wrench::ReadyWorkunitQueue::MAXIMUM_FLOPS);
+
+  wrench::Workunit *wu1 = createWorkunit(task1);
+  wrench::Workunit *wu2 = createWorkunit(task2);
+  wrench::Workunit *wu3 = createWorkunit(task3);
+  wrench::Workunit *wu4 = createWorkunit(task4);
+
+  queue.push(std::unique_ptr<wrench::Workunit>(wu1));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu2));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu3));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu4));
+
+  // Blocked workunits are still in the queue, but are not returned by top()
+  queue.block(wu2, 1, 100.0);
+  queue.block(wu3, 4, 0.0);
+  queue.block(wu4, 2, 0.0);
+  ASSERT_THROW(queue.block(wu4, 2, 0.0), std::invalid_argument);
+  ASSERT_EQ(4, queue.size());
+  ASSERT_EQ(3, queue.getNumBlocked());
+  ASSERT_EQ((std::vector<wrench::Workunit *>{wu2, wu4, wu3, wu1}), queue.getWorkunits());
+  ASSERT_EQ(wu1, queue.top());
+
+  // Only the blocked workunits that fit are unblocked, and once a workunit doesn't fit
+  // the ones that need as many cores and more RAM are not looked at
+  std::vector<std::pair<unsigned long, double>> looked_at;
+  queue.unblock([&looked_at](unsigned long min_num_cores, double ram) {
+      looked_at.push_back(std::make_pair(min_num_cores, ram));
+      return (min_num_cores <= 2) and (ram <= 10.0);
+  });
+  ASSERT_EQ((std::vector<std::pair<unsigned long, double>>{{1, 100.0}, {2, 0.0}, {4, 0.0}}), looked_at);
+  ASSERT_EQ(2, queue.getNumBlocked());
+  ASSERT_EQ(wu4, queue.pop().get());
+  ASSERT_EQ(wu1, queue.pop().get());
+  ASSERT_EQ(nullptr, queue.top());
+  ASSERT_FALSE(queue.empty());
+
+  // Blocked workunits keep their original rank, and can be removed
+  ASSERT_EQ(wu3, queue.remove(wu3).get());
+  queue.unblock([](unsigned long min_num_cores, double ram) { return true; });
+  ASSERT_EQ(wu2, queue.pop().get());
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(ReadyWorkunitQueueTest, VisitInOrder) {
+  wrench::ReadyWorkunitQueue queue(wrench::ReadyWorkunitQueue::MAXIMUM_FLOPS);
+
+  wrench::Workunit *wu1 = createWorkunit(task1);
+  wrench::Workunit *wu2 = createWorkunit(task2);
+  wrench::Workunit *wu3 = createWorkunit(task3);
+  wrench::Workunit *wu4 = createWorkunit(task4);
+
+  queue.push(std::unique_ptr<wrench::Workunit>(wu1));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu2));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu3));
+  queue.push(std::unique_ptr<wrench::Workunit>(wu4));
+  queue.block(wu4, 2, 0.0);
+
+  // Non-blocked workunits are visited in order of priority, until the visitor says to stop
+  std::vector<wrench::Workunit *> visited;
+  queue.visitInOrder([&visited](wrench::Workunit *wu) {
+      visited.push_back(wu);
+      return true;
+  });
+  ASSERT_EQ((std::vector<wrench::Workunit *>{wu2, wu3, wu1}), visited);
+
+  visited.clear();
+  queue.visitInOrder([&visited](wrench::Workunit *wu) {
+      visited.push_back(wu);
+      return visited.size() < 2;
+  });
+  ASSERT_EQ((std::vector<wrench::Workunit *>{wu2, wu3}), visited);
+  ASSERT_EQ(4, queue.size());
+}
@@ -40,8 +40,14 @@ public:
 
     void do_TwoMultiCoreTasksTest_test();
 
+    void do_PooledWorkunitExecutorsTest_test();
+
+    void do_OverlappedFileOperationsTest_test();
+
     void do_MultiHostTest_test();
 
+    void do_HostSelectionLookAheadTest_test();
+
     void do_JobTerminationTestDuringAComputation_test();
 
     void do_JobTerminationTestDuringATransfer_test();
@@ -71,6 +77,7 @@ protected:
               "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
               "       <link id=\"2\" bandwidth=\"0.0001MBps\" latency=\"1000000us\"/>"
               "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+              "       <route src=\"Host1\" dst=\"Host3\"> <link_ctn id=\"1\"/> </route>"
               "       <route src=\"Host3\" dst=\"Host4\"> <link_ctn id=\"2\"/> </route>"
               "       <route src=\"Host1\" dst=\"Host4\"> <link_ctn id=\"2\"/> </route>"
               "   </zone> "
@@ -1275,6 +1282,75 @@ private:
         this->test->storage_service1->deleteFile(workflow->getFileById("output_file"));
       }
 
+      /** Case 4: Same as case 3, but without creating compute threads **/
+      {
+        wrench::WorkflowTask *task = this->workflow->addTask("task1", 3600, 1, 10, 0.5);
+        task->addInputFile(workflow->getFileById("input_file"));
+        task->addOutputFile(workflow->getFileById("output_file"));
+
+        // Create a StandardJob
+        wrench::StandardJob *job = job_manager->createStandardJob(
+                task,
+                {
+                        {*(task->getInputFiles().begin()),  this->test->storage_service1},
+                        {*(task->getOutputFiles().begin()), this->test->storage_service1}
+                });
+
+        std::string my_mailbox = "test_callback_mailbox";
+
+        double before = wrench::S4U_Simulation::getClock();
+
+        // Create a StandardJobExecutor that will run stuff on one host and 10 cores, in a single actor
+        double thread_startup_overhead = 14;
+        std::shared_ptr<wrench::StandardJobExecutor> executor = std::unique_ptr<wrench::StandardJobExecutor>(
+                new wrench::StandardJobExecutor(
+                        test->simulation,
+                        my_mailbox,
+                        test->simulation->getHostnameList()[1],
+                        job,
+                        {std::make_tuple(test->simulation->getHostnameList()[1], 10, wrench::ComputeService::ALL_RAM)},
+                        nullptr,
+                        {{wrench::StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD, std::to_string(
+                                thread_startup_overhead)},
+                         {wrench::StandardJobExecutorProperty::MULTICORE_EXECUTION_MODE, "single_actor"}}
+                ));
+        executor->start(executor, true);
+
+        // Wait for a message on my mailbox_name
+        std::unique_ptr<wrench::SimulationMessage> message;
+        try {
+          message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+          throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+        }
+
+        // Did we get the expected message?
+        auto *msg = dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get());
+        if (!msg) {
+          throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+        }
+
+        double after = wrench::S4U_Simulation::getClock();
+
+        double observed_duration = after - before;
+
+        // The duration should be the same as with compute threads
+        double expected_duration =
+                10 * thread_startup_overhead + task->getFlops() / (10 * task->getParallelEfficiency());
+
+        // Does the task completion time make sense?
+        if (!StandardJobExecutorTest::isJustABitGreater(expected_duration, observed_duration)) {
+          throw std::runtime_error(
+                  "Case 4: Unexpected job duration (should be around " + std::to_string(expected_duration) +
+                  " but is " +
+                  std::to_string(observed_duration) + ")");
+        }
+
+        workflow->removeTask(task);
+
+        this->test->storage_service1->deleteFile(workflow->getFileById("output_file"));
+      }
+
       return 0;
     }
 };
@@ -1342,6 +1418,369 @@ void StandardJobExecutorTest::do_OneMultiCoreTaskTest_test() {
 
 
 
+/**********************************************************************/
+/**  POOLED WORKUNIT EXECUTORS SIMULATION TEST ON ONE HOST          **/
+/**********************************************************************/
+
+class PooledWorkunitExecutorsTestWMS : public wrench::WMS {
+
+public:
+    PooledWorkunitExecutorsTestWMS(StandardJobExecutorTest *test,
+                                   const std::set<wrench::ComputeService *> &compute_services,
+                                   const std::set<wrench::StorageService *> &storage_services,
+                                   std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+
+private:
+
+    StandardJobExecutorTest *test;
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // Create a pool shared by two successive executors
+      std::shared_ptr<wrench::WorkunitExecutorPool> pool = std::make_shared<wrench::WorkunitExecutorPool>(
+              test->simulation, 0.0, false);
+
+      for (int i = 0; i < 2; i++) {
+        // Create a sequential task that lasts one hour
+        wrench::WorkflowTask *task = this->workflow->addTask("task" + std::to_string(i), 3600, 1, 1, 1.0);
+        task->addInputFile(workflow->getFileById("input_file"));
+        task->addOutputFile(workflow->getFileById("output_file"));
+
+        // Create a StandardJob
+        wrench::StandardJob *job = job_manager->createStandardJob(
+                task,
+                {
+                        {*(task->getInputFiles().begin()),  this->test->storage_service1},
+                        {*(task->getOutputFiles().begin()), this->test->storage_service1}
+                });
+
+        std::string my_mailbox = "test_callback_mailbox";
+
+        double before = wrench::S4U_Simulation::getClock();
+
+        // Create a StandardJobExecutor that will run stuff on one host and one core, with pooled workunit executors
+        std::shared_ptr<wrench::StandardJobExecutor> executor = std::shared_ptr<wrench::StandardJobExecutor>(
+                new wrench::StandardJobExecutor(
+                        test->simulation,
+                        my_mailbox,
+                        test->simulation->getHostnameList()[1],
+                        job,
+                        {std::make_tuple(test->simulation->getHostnameList()[1], 1, wrench::ComputeService::ALL_RAM)},
+                        nullptr,
+                        {{wrench::StandardJobExecutorProperty::WORKUNIT_EXECUTOR_MODE, "pooled"}}
+                ));
+        executor->setWorkunitExecutorPool(pool);
+        executor->start(executor, true);
+
+        // Wait for a message on my mailbox_name
+        std::unique_ptr<wrench::SimulationMessage> message;
+        try {
+          message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+          throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+        }
+
+        // Did we get the expected message?
+        auto msg = dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get());
+        if (!msg) {
+          throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+        }
+
+        double after = wrench::S4U_Simulation::getClock();
+
+        // Does the job completion time make sense?
+        if (!StandardJobExecutorTest::isJustABitGreater(before + task->getFlops(), after)) {
+          throw std::runtime_error("Unexpected job completion time (should be around " +
+                                   std::to_string(before + task->getFlops()) + " but is " +
+                                   std::to_string(after) + ")");
+        }
+
+        this->test->storage_service1->deleteFile(workflow->getFileById("output_file"));
+
+        workflow->removeTask(task);
+      }
+
+      // Was a single workunit executor used for both jobs?
+      if (pool->getNumCreatedExecutors() != 1) {
+        throw std::runtime_error("Pool should have created 1 workunit executor but created " +
+                                 std::to_string(pool->getNumCreatedExecutors()));
+      }
+      if (pool->getNumIdleExecutors() != 1) {
+        throw std::runtime_error("Pool should have 1 idle workunit executor but has " +
+                                 std::to_string(pool->getNumIdleExecutors()));
+      }
+      pool->killIdleExecutors();
+
+      return 0;
+    }
+};
+
+TEST_F(StandardJobExecutorTest, PooledWorkunitExecutorsTest) {
+  DO_TEST_WITH_FORK(do_PooledWorkunitExecutorsTest_test);
+}
+
+void StandardJobExecutorTest::do_PooledWorkunitExecutorsTest_test() {
+
+  // Create and initialize a simulation
+  simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("pooled_test");
+
+  simulation->init(&argc, argv);
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = simulation->getHostnameList()[0];
+
+  // Create a Compute Service (we don't use it)
+  wrench::ComputeService *compute_service;
+  EXPECT_NO_THROW(compute_service = simulation->add(
+                  new wrench::MultihostMulticoreComputeService(hostname, true, true,
+                                                               {std::make_tuple(hostname, wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM)},
+                                                               nullptr,
+                                                               {})));
+  // Create a Storage Service
+  EXPECT_NO_THROW(storage_service1 = simulation->add(
+                  new wrench::SimpleStorageService(hostname, 10000000000000.0)));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new PooledWorkunitExecutorsTestWMS(
+                  this,  {compute_service}, {storage_service1}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  simulation->setFileRegistryService(new wrench::FileRegistryService(hostname));
+
+  // Create two workflow files
+  wrench::WorkflowFile *input_file = this->workflow->addFile("input_file", 10000.0);
+  wrench::WorkflowFile *output_file = this->workflow->addFile("output_file", 20000.0);
+
+  // Staging the input_file on the storage service
+  EXPECT_NO_THROW(simulation->stageFile(input_file, storage_service1));
+
+  EXPECT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+
+/**********************************************************************/
+/**  OVERLAPPED FILE OPERATIONS SIMULATION TEST                     **/
+/**********************************************************************/
+
+#define NUM_OVERLAPPED_INPUT_FILES 4
+
+class OverlappedFileOperationsTestWMS : public wrench::WMS {
+
+public:
+    OverlappedFileOperationsTestWMS(StandardJobExecutorTest *test,
+                                    const std::set<wrench::ComputeService *> &compute_services,
+                                    const std::set<wrench::StorageService *> &storage_services,
+                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+
+private:
+
+    StandardJobExecutorTest *test;
+
+    /**
+     * @brief Run a one-task job on the far end of the slow link (from the storage service), and check
+     *        the task's dates if it completes
+     *
+     * @param job_manager: the job manager
+     * @param task: the task
+     * @param file_operation_mode: the StandardJobExecutorProperty::FILE_OPERATION_MODE property value
+     * @param message: the message with which the executor reported (output)
+     * @return the job's execution time
+     */
+    double runJob(std::shared_ptr<wrench::JobManager> job_manager, wrench::WorkflowTask *task,
+                  std::string file_operation_mode, std::unique_ptr<wrench::SimulationMessage> &message) {
+
+      std::map<wrench::WorkflowFile *, wrench::StorageService *> file_locations;
+      for (auto const &f : task->getInputFiles()) {
+        file_locations.insert(std::make_pair(f, this->test->storage_service1));
+      }
+      for (auto const &f : task->getOutputFiles()) {
+        file_locations.insert(std::make_pair(f, this->test->storage_service1));
+      }
+      wrench::StandardJob *job = job_manager->createStandardJob(task, file_locations);
+
+      std::string my_mailbox = "test_callback_mailbox";
+
+      double before = wrench::S4U_Simulation::getClock();
+
+      std::shared_ptr<wrench::StandardJobExecutor> executor = std::shared_ptr<wrench::StandardJobExecutor>(
+              new wrench::StandardJobExecutor(
+                      test->simulation,
+                      my_mailbox,
+                      "Host4",
+                      job,
+                      {std::make_tuple("Host4", 1, wrench::ComputeService::ALL_RAM)},
+                      nullptr,
+                      {{wrench::StandardJobExecutorProperty::FILE_OPERATION_MODE, file_operation_mode},
+                       {wrench::StandardJobExecutorProperty::MAX_NUM_CONCURRENT_FILE_OPERATIONS,
+                        std::to_string(NUM_OVERLAPPED_INPUT_FILES)}}
+              ));
+      executor->start(executor, true);
+
+      try {
+        message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+      } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+        throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+      }
+
+      double after = wrench::S4U_Simulation::getClock();
+
+      if (dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get())) {
+        if ((task->getState() != wrench::WorkflowTask::State::COMPLETED) or
+            (task->getEndDate() < task->getStartDate() + task->getFlops()) or
+            (task->getStartDate() < before) or (task->getEndDate() > after)) {
+          throw std::runtime_error("Unexpected task state or dates in " + file_operation_mode + " mode (start: " +
+                                   std::to_string(task->getStartDate()) + ", end: " +
+                                   std::to_string(task->getEndDate()) + ")");
+        }
+      }
+
+      return after - before;
+    }
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // Run the same 10-second task, which reads small files over a high-latency link, in both modes
+      std::map<std::string, double> durations;
+      for (auto const &mode : {"sequential", "overlapped"}) {
+        wrench::WorkflowTask *task = this->workflow->addTask(std::string("task_") + mode, 10, 1, 1, 1.0);
+        for (unsigned long i = 0; i < NUM_OVERLAPPED_INPUT_FILES; i++) {
+          task->addInputFile(workflow->getFileById("input_file_" + std::to_string(i)));
+        }
+        task->addOutputFile(workflow->getFileById(std::string("output_file_") + mode));
+
+        std::unique_ptr<wrench::SimulationMessage> message;
+        durations[mode] = runJob(job_manager, task, mode, message);
+        if (not dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get())) {
+          throw std::runtime_error("Unexpected '" + message->getName() + "' message in " + mode + " mode");
+        }
+        workflow->removeTask(task);
+      }
+
+      // Reading the input files concurrently should take less time
+      if (durations["overlapped"] >= durations["sequential"]) {
+        throw std::runtime_error("Overlapped file operations should be faster (" +
+                                 std::to_string(durations["overlapped"]) + " >= " +
+                                 std::to_string(durations["sequential"]) + ")");
+      }
+
+      // A missing input file fails the job, even though the other input files are read concurrently
+      wrench::WorkflowTask *task = this->workflow->addTask("task_missing", 10, 1, 1, 1.0);
+      for (unsigned long i = 0; i < NUM_OVERLAPPED_INPUT_FILES; i++) {
+        task->addInputFile(workflow->getFileById("input_file_" + std::to_string(i)));
+      }
+      task->addInputFile(workflow->getFileById("missing_file"));
+
+      std::unique_ptr<wrench::SimulationMessage> message;
+      runJob(job_manager, task, "overlapped", message);
+      auto msg = dynamic_cast<wrench::StandardJobExecutorFailedMessage *>(message.get());
+      if (!msg) {
+        throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+      }
+      if (msg->cause->getCauseType() != wrench::FailureCause::FILE_NOT_FOUND) {
+        throw std::runtime_error("Unexpected failure cause type " +
+                                 std::to_string(msg->cause->getCauseType()) + " (" + msg->cause->toString() + ")");
+      }
+      if (((wrench::FileNotFound *) msg->cause.get())->getFile() != workflow->getFileById("missing_file")) {
+        throw std::runtime_error(
+                "Got the expected 'file not found' exception, but the failure cause does not point to the correct file");
+      }
+      if (task->getState() == wrench::WorkflowTask::State::COMPLETED) {
+        throw std::runtime_error("A task whose input file is missing should not be completed");
+      }
+      workflow->removeTask(task);
+
+      return 0;
+    }
+};
+
+TEST_F(StandardJobExecutorTest, OverlappedFileOperationsTest) {
+  DO_TEST_WITH_FORK(do_OverlappedFileOperationsTest_test);
+}
+
+void StandardJobExecutorTest::do_OverlappedFileOperationsTest_test() {
+
+  // Create and initialize a simulation
+  simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("overlapped_test");
+
+  simulation->init(&argc, argv);
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Everything but the StandardJobExecutors is on Host3, at the other end of the slow link from Host4
+  std::string hostname = "Host3";
+
+  // Create a Compute Service (we don't use it)
+  wrench::ComputeService *compute_service = nullptr;
+  EXPECT_NO_THROW(compute_service = simulation->add(
+                  new wrench::MultihostMulticoreComputeService(hostname, true, true,
+                                                               {std::make_tuple(hostname, wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM)},
+                                                               nullptr,
+                                                               {})));
+  // Create a Storage Service
+  EXPECT_NO_THROW(storage_service1 = simulation->add(
+                  new wrench::SimpleStorageService(hostname, 10000000000000.0)));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new OverlappedFileOperationsTestWMS(
+                  this,  {compute_service}, {storage_service1}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  simulation->setFileRegistryService(new wrench::FileRegistryService(hostname));
+
+  // Create small input files (so that transfers are latency-bound), staged on the storage service,
+  // output files, and a file that is not staged anywhere
+  for (unsigned long i = 0; i < NUM_OVERLAPPED_INPUT_FILES; i++) {
+    wrench::WorkflowFile *input_file = this->workflow->addFile("input_file_" + std::to_string(i), 1.0);
+    EXPECT_NO_THROW(simulation->stageFile(input_file, storage_service1));
+  }
+  this->workflow->addFile("output_file_sequential", 1.0);
+  this->workflow->addFile("output_file_overlapped", 1.0);
+  this->workflow->addFile("missing_file", 1.0);
+
+  EXPECT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+
 /**********************************************************************/
 /**  TWO MULTI-CORE TASKS SIMULATION TEST ON ONE HOST               **/
 /**********************************************************************/
@@ -1973,6 +2412,143 @@ void StandardJobExecutorTest::do_MultiHostTest_test() {
 
 
 
+/**********************************************************************/
+/**  HOST SELECTION LOOK-AHEAD SIMULATION TEST                       **/
+/**********************************************************************/
+
+class HostSelectionLookAheadTestWMS : public wrench::WMS {
+
+public:
+    HostSelectionLookAheadTestWMS(StandardJobExecutorTest *test,
+                                  const std::set<wrench::ComputeService *> &compute_services,
+                                  const std::set<wrench::StorageService *> &storage_services,
+                                  std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+
+private:
+
+    StandardJobExecutorTest *test;
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // A small-memory task that goes first (most flops), and would like two cores
+      wrench::WorkflowTask *small_task = this->workflow->addTask("small_task", 2000, 1, 2, 1.0, 0.0);
+      // Two identical large-memory tasks, each of which needs a whole large-memory host
+      wrench::WorkflowTask *large_task1 = this->workflow->addTask("large_task1", 1000, 1, 1, 1.0, 800.0);
+      wrench::WorkflowTask *large_task2 = this->workflow->addTask("large_task2", 1000, 1, 1, 1.0, 800.0);
+
+      wrench::StandardJob *job = job_manager->createStandardJob({small_task, large_task1, large_task2}, {});
+
+      std::string my_mailbox = "test_callback_mailbox";
+
+      double before = wrench::S4U_Simulation::getClock();
+
+      // Create a StandardJobExecutor with two 2-core large-memory hosts and one 1-core small-memory host
+      std::shared_ptr<wrench::StandardJobExecutor> executor = std::shared_ptr<wrench::StandardJobExecutor>(
+              new wrench::StandardJobExecutor(
+                      test->simulation,
+                      my_mailbox,
+                      "Host1",
+                      job,
+                      {std::make_tuple("Host1", 2, 1000.0),
+                       std::make_tuple("Host2", 1, 100.0),
+                       std::make_tuple("Host3", 2, 1000.0)},
+                      nullptr,
+                      {{wrench::StandardJobExecutorProperty::THREAD_STARTUP_OVERHEAD, "0"},
+                       {wrench::StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM, "cores_and_ram_best_fit"},
+                       {wrench::StandardJobExecutorProperty::HOST_SELECTION_LOOK_AHEAD, "2"}}
+              ));
+      executor->start(executor, true);
+
+      // Wait for a message on my mailbox_name
+      std::unique_ptr<wrench::SimulationMessage> message;
+      try {
+        message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+      } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+        throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+      }
+
+      // Did we get the expected message?
+      auto msg = dynamic_cast<wrench::StandardJobExecutorDoneMessage *>(message.get());
+      if (!msg) {
+        throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+      }
+
+      // The small task should have been kept off both large-memory hosts, since the two
+      // large-memory tasks need both of them...
+      if (small_task->getExecutionHost() != "Host2") {
+        throw std::runtime_error("Small task should have run on Host2 but ran on " + small_task->getExecutionHost());
+      }
+      if (!StandardJobExecutorTest::isJustABitGreater(before + small_task->getFlops(), small_task->getEndDate())) {
+        throw std::runtime_error("Unexpected small task end date: " + std::to_string(small_task->getEndDate()));
+      }
+
+      // ... so that neither large-memory task had to wait for it
+      if (!StandardJobExecutorTest::isJustABitGreater(before + large_task1->getFlops(), large_task1->getEndDate())) {
+        throw std::runtime_error("Unexpected large_task1 end date: " + std::to_string(large_task1->getEndDate()));
+      }
+      if (!StandardJobExecutorTest::isJustABitGreater(before + large_task2->getFlops(), large_task2->getEndDate())) {
+        throw std::runtime_error("Unexpected large_task2 end date: " + std::to_string(large_task2->getEndDate()));
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(StandardJobExecutorTest, HostSelectionLookAheadTest) {
+  DO_TEST_WITH_FORK(do_HostSelectionLookAheadTest_test);
+}
+
+void StandardJobExecutorTest::do_HostSelectionLookAheadTest_test() {
+
+  // Create and initialize a simulation
+  simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("look_ahead_test");
+
+  simulation->init(&argc, argv);
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = "Host1";
+
+  // Create a Compute Service (we don't use it)
+  wrench::ComputeService *compute_service;
+  EXPECT_NO_THROW(compute_service = simulation->add(
+                  new wrench::MultihostMulticoreComputeService(hostname, true, true,
+                                                               {std::make_tuple(hostname, wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM)},
+                                                               nullptr,
+                                                               {})));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new HostSelectionLookAheadTestWMS(
+                  this,  {compute_service}, {}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  // Running a "run three tasks" simulation
+  // Note that in these tests the WMS creates workflow tasks, which a user would
+  // of course not be likely to do
+  EXPECT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+
 /**********************************************************************/
 /**  TERMINATION TEST    #1  (DURING COMPUTATION)                    **/
 /**********************************************************************/
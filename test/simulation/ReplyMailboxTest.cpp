@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+
+class ReplyMailboxTest : public ::testing::Test {
+
+public:
+    wrench::ComputeService *compute_service = nullptr;
+    wrench::StorageService *storage_service = nullptr;
+
+    void do_ReplyMailbox_test();
+
+protected:
+    ReplyMailboxTest() {
+      // Create a platform file
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"QuadCoreHost\" speed=\"1f\" core=\"4\"/> "
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+};
+
+/**
+ * @brief A WMS that checks reply mailbox reuse and correlation id filtering
+ */
+class ReplyMailboxTestWMS : public wrench::WMS {
+
+public:
+    ReplyMailboxTestWMS(ReplyMailboxTest *test,
+                        const std::set<wrench::ComputeService *> &compute_services,
+                        const std::set<wrench::StorageService *> &storage_services,
+                        std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    ReplyMailboxTest *test;
+
+    int main() {
+
+      // A reply mailbox is reused across exchanges, which are told apart by correlation ids
+      std::string reply_mailbox = wrench::S4U_Mailbox::generateReplyMailboxName();
+      if (wrench::S4U_Mailbox::generateReplyMailboxName() != reply_mailbox) {
+        throw std::runtime_error("The reply mailbox should be reused");
+      }
+      unsigned long stale_correlation_id = wrench::S4U_Mailbox::generateCorrelationId();
+      unsigned long correlation_id = wrench::S4U_Mailbox::generateCorrelationId();
+      if ((stale_correlation_id == 0) or (stale_correlation_id == correlation_id)) {
+        throw std::runtime_error("Correlation ids should be unique and non-zero");
+      }
+
+      // A stale reply is discarded
+      wrench::S4U_Mailbox::dputMessage(reply_mailbox, new wrench::SimulationMessage("stale", 0), stale_correlation_id);
+      wrench::S4U_Mailbox::dputMessage(reply_mailbox, new wrench::SimulationMessage("expected", 0), correlation_id);
+      std::unique_ptr<wrench::SimulationMessage> message = wrench::S4U_Mailbox::getReply(reply_mailbox,
+                                                                                           correlation_id, 10.0);
+      if (message->getName() != "expected") {
+        throw std::runtime_error("Received an unexpected message: " + message->getName());
+      }
+      if (message->correlation_id != correlation_id) {
+        throw std::runtime_error("The reply should carry its correlation id");
+      }
+
+      // A reply to an exchange that is still expected is kept for later
+      unsigned long later_correlation_id = wrench::S4U_Mailbox::generateCorrelationId();
+      correlation_id = wrench::S4U_Mailbox::generateCorrelationId();
+      wrench::S4U_Mailbox::expectReplies(later_correlation_id);
+      wrench::S4U_Mailbox::dputMessage(reply_mailbox, new wrench::SimulationMessage("later", 0), later_correlation_id);
+      wrench::S4U_Mailbox::dputMessage(reply_mailbox, new wrench::SimulationMessage("now", 0), correlation_id);
+      message = wrench::S4U_Mailbox::getReply(reply_mailbox, correlation_id, 10.0);
+      if (message->getName() != "now") {
+        throw std::runtime_error("Received an unexpected message: " + message->getName());
+      }
+      message = wrench::S4U_Mailbox::getReply(reply_mailbox, later_correlation_id, 10.0);
+      if (message->getName() != "later") {
+        throw std::runtime_error("Received an unexpected message: " + message->getName());
+      }
+      wrench::S4U_Mailbox::ignoreReplies(later_correlation_id);
+
+      // Mailbox names are opaque
+      wrench::S4U_Mailbox::dputMessage("user_mailbox#123", new wrench::SimulationMessage("opaque", 0));
+      message = wrench::S4U_Mailbox::getMessage("user_mailbox#123", 10.0);
+      if (message->getName() != "opaque") {
+        throw std::runtime_error("Received an unexpected message: " + message->getName());
+      }
+
+      // Synchronous RPCs do not generate mailbox names
+      unsigned long num_generated_mailbox_names = wrench::S4U_Mailbox::getNumGeneratedMailboxNames();
+      for (unsigned int i = 0; i < 100; i++) {
+        this->test->compute_service->getNumIdleCores();
+        this->test->storage_service->howMuchFreeSpace();
+      }
+      if (wrench::S4U_Mailbox::getNumGeneratedMailboxNames() != num_generated_mailbox_names) {
+        throw std::runtime_error("Synchronous RPCs should not generate mailbox names");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(ReplyMailboxTest, ReuseAndCorrelation) {
+  DO_TEST_WITH_FORK(do_ReplyMailbox_test);
+}
+
+void ReplyMailboxTest::do_ReplyMailbox_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("reply_mailbox_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = simulation->getHostnameList()[0];
+
+  // Create a Storage Service
+  ASSERT_NO_THROW(storage_service = simulation->add(
+          new wrench::SimpleStorageService(hostname, 100.0)));
+
+  // Create a Compute Service
+  ASSERT_NO_THROW(compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService(hostname, true, false, {hostname}, storage_service, {})));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new ReplyMailboxTestWMS(this, {compute_service}, {storage_service}, hostname)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(new wrench::Workflow()));
+
+  // Running the simulation
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
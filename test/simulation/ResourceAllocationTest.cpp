@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+
+class ResourceAllocationTest : public ::testing::Test {
+
+public:
+    void do_ResourceAllocation_test();
+
+protected:
+    ResourceAllocationTest() {
+      // Create a platform file
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"2\"/> "
+              "       <host id=\"Host2\" speed=\"1f\" core=\"4\"/> "
+              "       <host id=\"Host3\" speed=\"1f\" core=\"8\"/> "
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+};
+
+TEST_F(ResourceAllocationTest, SortedByHostId) {
+  DO_TEST_WITH_FORK(do_ResourceAllocation_test);
+}
+
+void ResourceAllocationTest::do_ResourceAllocation_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("resource_allocation_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Build an allocation out of order
+  wrench::ResourceAllocation allocation = {std::make_tuple("Host3", 8, 100.0),
+                                           std::make_tuple("Host1", 1, 10.0)};
+  allocation.add("Host2", 3, 0.0);
+
+  ASSERT_EQ(3, allocation.size());
+  ASSERT_EQ(12, allocation.getTotalNumCores());
+  ASSERT_DOUBLE_EQ(110.0, allocation.getTotalRam());
+
+  // Entries are sorted by host id
+  for (unsigned long i = 1; i < allocation.size(); i++) {
+    ASSERT_LT(allocation[i - 1].host_id, allocation[i].host_id);
+  }
+
+  // Per-host lookup
+  ASSERT_NE(nullptr, allocation.find("Host2"));
+  ASSERT_EQ(3, allocation.find("Host2")->num_cores);
+  ASSERT_EQ("Host2", allocation.find("Host2")->getHostname());
+  ASSERT_EQ(allocation.find("Host1"), allocation.find(wrench::S4U_HostRegistry::getHostId("Host1")));
+  ASSERT_EQ(nullptr, allocation.find("bogus"));
+
+  // Copies hold the same entries
+  wrench::ResourceAllocation copy = allocation;
+  ASSERT_EQ(3, copy.size());
+  ASSERT_EQ(8, copy.find("Host3")->num_cores);
+
+  // Duplicate and unknown hosts
+  ASSERT_THROW(allocation.add("Host1", 1, 0.0), std::invalid_argument);
+  ASSERT_THROW(allocation.add("bogus", 1, 0.0), std::invalid_argument);
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
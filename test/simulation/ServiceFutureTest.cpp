@@ -0,0 +1,302 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+#include "wrench/services/helpers/Alarm.h"
+
+#include "../include/TestWithFork.h"
+
+class ServiceFutureTest : public ::testing::Test {
+
+public:
+    std::vector<wrench::ComputeService *> compute_services;
+    wrench::StorageService *storage_service = nullptr;
+
+    void do_ServiceFuture_test();
+
+    void do_WaitAnyFailure_test();
+
+protected:
+    ServiceFutureTest() {
+      // Create a platform file, in which the WMS host is 10ms away from each service host, and
+      // the slow link to Host4 goes down after 1 second
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"WMSHost\" speed=\"1f\" core=\"1\"/> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"1\"/> "
+              "       <host id=\"Host2\" speed=\"1f\" core=\"2\"/> "
+              "       <host id=\"Host3\" speed=\"1f\" core=\"3\"/> "
+              "       <host id=\"Host4\" speed=\"1f\" core=\"1\"/> "
+              "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"10ms\"/>"
+              "       <link id=\"2\" bandwidth=\"5000GBps\" latency=\"10ms\"/>"
+              "       <link id=\"3\" bandwidth=\"5000GBps\" latency=\"10ms\"/>"
+              "       <link id=\"4\" bandwidth=\"1MBps\" latency=\"10ms\" state_file=\"" + link_state_file_path + "\"/>"
+              "       <route src=\"WMSHost\" dst=\"Host1\"> <link_ctn id=\"1\"/> </route>"
+              "       <route src=\"WMSHost\" dst=\"Host2\"> <link_ctn id=\"2\"/> </route>"
+              "       <route src=\"WMSHost\" dst=\"Host3\"> <link_ctn id=\"3\"/> </route>"
+              "       <route src=\"WMSHost\" dst=\"Host4\"> <link_ctn id=\"4\"/> </route>"
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+
+      FILE *link_state_file = fopen(link_state_file_path.c_str(), "w");
+      fprintf(link_state_file, "0 1\n1 0\n");
+      fclose(link_state_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+    std::string link_state_file_path = "/tmp/link_state.txt";
+};
+
+/**
+ * @brief A WMS that compares synchronous and asynchronous service requests
+ */
+class ServiceFutureTestWMS : public wrench::WMS {
+
+public:
+    ServiceFutureTestWMS(ServiceFutureTest *test,
+                         const std::set<wrench::ComputeService *> &compute_services,
+                         const std::set<wrench::StorageService *> &storage_services,
+                         std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    ServiceFutureTest *test;
+
+    int main() {
+
+      // Synchronous requests, one after the other
+      double start_date = this->simulation->getCurrentSimulatedDate();
+      std::vector<std::vector<unsigned long>> sync_idle_cores;
+      for (auto const &cs : this->test->compute_services) {
+        sync_idle_cores.push_back(cs->getNumIdleCores());
+      }
+      double sync_duration = this->simulation->getCurrentSimulatedDate() - start_date;
+
+      // Asynchronous requests, all in flight at once
+      start_date = this->simulation->getCurrentSimulatedDate();
+      std::vector<std::unique_ptr<wrench::ServiceFuture<std::vector<unsigned long>>>> futures;
+      std::vector<wrench::ServiceFutureBase *> raw_futures;
+      for (auto const &cs : this->test->compute_services) {
+        futures.push_back(cs->getNumIdleCoresAsync());
+        raw_futures.push_back(futures.back().get());
+      }
+      wrench::ServiceFutureBase::waitAll(raw_futures);
+      double async_duration = this->simulation->getCurrentSimulatedDate() - start_date;
+
+      for (unsigned long i = 0; i < futures.size(); i++) {
+        if (not futures[i]->isReady()) {
+          throw std::runtime_error("All futures should be ready after waitAll()");
+        }
+        if (futures[i]->get() != sync_idle_cores[i]) {
+          throw std::runtime_error("Synchronous and asynchronous requests should return the same results");
+        }
+      }
+      if (async_duration >= sync_duration) {
+        throw std::runtime_error("Asynchronous requests should overlap (" + std::to_string(async_duration) +
+                                 " >= " + std::to_string(sync_duration) + ")");
+      }
+
+      // waitAny() returns a ready future
+      futures.clear();
+      raw_futures.clear();
+      for (auto const &cs : this->test->compute_services) {
+        futures.push_back(cs->getNumCoresAsync());
+        raw_futures.push_back(futures.back().get());
+      }
+      unsigned long index = wrench::ServiceFutureBase::waitAny(raw_futures);
+      if ((index >= futures.size()) or (not futures[index]->isReady())) {
+        throw std::runtime_error("waitAny() should return the index of a ready future");
+      }
+
+      // Futures can be destroyed while their answers are in flight (the answers are then discarded)
+      futures.clear();
+      raw_futures.clear();
+      this->test->compute_services[0]->getNumIdleCoresAsync();
+      auto num_cores = this->test->compute_services[1]->getNumCoresAsync();
+      this->test->compute_services[2]->getNumCoresAsync();
+      if (num_cores->get() != std::vector<unsigned long>({2})) {
+        throw std::runtime_error("Unexpected asynchronous request result after a future was destroyed");
+      }
+      if ((this->test->compute_services[0]->getNumIdleCores() != sync_idle_cores[0]) or
+          (this->test->compute_services[2]->getNumCores() != std::vector<unsigned long>({3}))) {
+        throw std::runtime_error("Unexpected synchronous request results after futures were destroyed");
+      }
+
+      // Futures of different types
+      auto free_space = this->test->storage_service->howMuchFreeSpaceAsync();
+      auto flop_rates = this->test->compute_services[0]->getCoreFlopRateAsync();
+      wrench::ServiceFutureBase::waitAll({free_space.get(), flop_rates.get()});
+      if ((free_space->get() != 100.0) or (flop_rates->get().size() != 1)) {
+        throw std::runtime_error("Unexpected asynchronous request results");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(ServiceFutureTest, WaitAllAndWaitAny) {
+  DO_TEST_WITH_FORK(do_ServiceFuture_test);
+}
+
+void ServiceFutureTest::do_ServiceFuture_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("service_future_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Create a Storage Service
+  ASSERT_NO_THROW(storage_service = simulation->add(
+          new wrench::SimpleStorageService("Host1", 100.0)));
+
+  // Create Compute Services
+  for (auto hostname : {"Host1", "Host2", "Host3"}) {
+    wrench::ComputeService *compute_service = nullptr;
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::MultihostMulticoreComputeService(hostname, true, false,
+                                                         std::set<std::string>({hostname}),
+                                                         storage_service, {})));
+    compute_services.push_back(compute_service);
+  }
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new ServiceFutureTestWMS(this, {compute_services.begin(), compute_services.end()},
+                                   {storage_service}, "WMSHost")));
+
+  ASSERT_NO_THROW(wms->addWorkflow(new wrench::Workflow()));
+
+  // Running the simulation
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
+
+
+/**
+ * @brief A WMS that checks that a failure to receive a message in waitAny() doesn't fail the futures
+ */
+class ServiceFutureFailureTestWMS : public wrench::WMS {
+
+public:
+    ServiceFutureFailureTestWMS(ServiceFutureTest *test,
+                                const std::set<wrench::ComputeService *> &compute_services,
+                                const std::set<wrench::StorageService *> &storage_services,
+                                std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    ServiceFutureTest *test;
+
+    int main() {
+
+      if (this->simulation->getCurrentSimulatedDate() >= 0.5) {
+        throw std::runtime_error("The WMS should start before the link to Host4 goes down");
+      }
+
+      auto num_cores = this->test->compute_services[1]->getNumCoresAsync();
+
+      // A large message, sent to the reply mailbox from Host4 while waitAny() waits, whose
+      // transfer fails when the link to Host4 goes down
+      std::string reply_mailbox = num_cores->getReplyMailbox();
+      wrench::Alarm::createAndStartAlarm(this->simulation, this->simulation->getCurrentSimulatedDate() + 0.001,
+                                         "Host4", reply_mailbox,
+                                         new wrench::SimulationMessage("large_message", 1000000000.0), "test");
+
+      bool failed = false;
+      try {
+        wrench::ServiceFutureBase::waitAny({num_cores.get()});
+      } catch (wrench::WorkflowExecutionException &e) {
+        if (e.getCause()->getCauseType() != wrench::FailureCause::NETWORK_ERROR) {
+          throw std::runtime_error("waitAny() should report a network error");
+        }
+        failed = true;
+      }
+      if (not failed) {
+        throw std::runtime_error("waitAny() should throw when a message fails to be received");
+      }
+
+      // The future has not been failed, and its answer can still be received
+      if (num_cores->isReady()) {
+        throw std::runtime_error("A failure in waitAny() shouldn't make the futures ready");
+      }
+      if (wrench::ServiceFutureBase::waitAny({num_cores.get()}) != 0) {
+        throw std::runtime_error("waitAny() should return the index of a ready future");
+      }
+      if (num_cores->get() != std::vector<unsigned long>({2})) {
+        throw std::runtime_error("Unexpected asynchronous request result after a failure in waitAny()");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(ServiceFutureTest, WaitAnyFailure) {
+  DO_TEST_WITH_FORK(do_WaitAnyFailure_test);
+}
+
+void ServiceFutureTest::do_WaitAnyFailure_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("service_future_test");
+
+  ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Create Compute Services
+  for (auto hostname : {"Host1", "Host2"}) {
+    wrench::ComputeService *compute_service = nullptr;
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::MultihostMulticoreComputeService(hostname, true, false,
+                                                         std::set<std::string>({hostname}),
+                                                         nullptr, {})));
+    compute_services.push_back(compute_service);
+  }
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new ServiceFutureFailureTestWMS(this, {compute_services.begin(), compute_services.end()},
+                                          {}, "WMSHost")));
+
+  ASSERT_NO_THROW(wms->addWorkflow(new wrench::Workflow()));
+
+  // Running the simulation
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
@@ -37,6 +37,7 @@ public:
 
     void do_AsynchronousFileCopyFailures_test();
 
+    void do_ConcurrentFileReadsAndWrites_test();
 
 protected:
     SimpleStorageServiceFunctionalTest() {
@@ -1203,3 +1204,166 @@ void SimpleStorageServiceFunctionalTest::do_AsynchronousFileCopyFailures_test()
   free(argv[0]);
   free(argv);
 }
+
+
+/**********************************************************************/
+/**  CONCURRENT FILE READS AND WRITES TEST                           **/
+/**********************************************************************/
+
+class SimpleStorageServiceConcurrentFileReadsAndWritesTestWMS : public wrench::WMS {
+
+public:
+    SimpleStorageServiceConcurrentFileReadsAndWritesTestWMS(SimpleStorageServiceFunctionalTest *test,
+                                                            const std::set<wrench::ComputeService *> &compute_services,
+                                                            const std::set<wrench::StorageService *> &storage_services,
+                                                            std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    SimpleStorageServiceFunctionalTest *test;
+
+    int main() {
+
+      std::map<wrench::WorkflowFile *, wrench::StorageService *> file_locations =
+              {{this->test->file_100, this->test->storage_service_500}};
+
+      // Do a bogus write (no concurrency)
+      bool success = true;
+      try {
+        wrench::StorageService::writeFiles({this->test->file_1}, {}, this->test->storage_service_1000, 0);
+      } catch (std::invalid_argument &e) {
+        success = false;
+      }
+      if (success) {
+        throw std::runtime_error("Shouldn't be able to write files with at most 0 concurrent transfers");
+      }
+
+      // Write files to two storage services, two at a time
+      try {
+        wrench::StorageService::writeFiles({this->test->file_1, this->test->file_10, this->test->file_100},
+                                           file_locations, this->test->storage_service_1000, 2);
+      } catch (wrench::WorkflowExecutionException &e) {
+        throw std::runtime_error("Got an exception while writing files concurrently: " + std::string(e.what()));
+      }
+      if ((not this->test->storage_service_1000->lookupFile(this->test->file_1)) or
+          (not this->test->storage_service_1000->lookupFile(this->test->file_10)) or
+          (not this->test->storage_service_500->lookupFile(this->test->file_100)) or
+          (this->test->storage_service_1000->lookupFile(this->test->file_100))) {
+        throw std::runtime_error("Files were not written to the right storage services");
+      }
+
+      // Read them one after the other, and then all at once (which should take less time)
+      double start_date = this->simulation->getCurrentSimulatedDate();
+      try {
+        wrench::StorageService::readFiles({this->test->file_1, this->test->file_10, this->test->file_100},
+                                          file_locations, this->test->storage_service_1000, 1);
+      } catch (wrench::WorkflowExecutionException &e) {
+        throw std::runtime_error("Got an exception while reading files sequentially: " + std::string(e.what()));
+      }
+      double sequential_duration = this->simulation->getCurrentSimulatedDate() - start_date;
+
+      start_date = this->simulation->getCurrentSimulatedDate();
+      try {
+        wrench::StorageService::readFiles({this->test->file_1, this->test->file_10, this->test->file_100},
+                                          file_locations, this->test->storage_service_1000, 8);
+      } catch (wrench::WorkflowExecutionException &e) {
+        throw std::runtime_error("Got an exception while reading files concurrently: " + std::string(e.what()));
+      }
+      double concurrent_duration = this->simulation->getCurrentSimulatedDate() - start_date;
+
+      if (concurrent_duration >= sequential_duration) {
+        throw std::runtime_error("Reading files concurrently should be faster than reading them sequentially (" +
+                                 std::to_string(concurrent_duration) + " >= " +
+                                 std::to_string(sequential_duration) + ")");
+      }
+
+      // Read files, one of which is not there
+      success = true;
+      try {
+        wrench::StorageService::readFiles({this->test->file_1, this->test->file_10, this->test->file_500},
+                                          {}, this->test->storage_service_1000, 8);
+      } catch (wrench::WorkflowExecutionException &e) {
+        success = false;
+        if (e.getCause()->getCauseType() != wrench::FailureCause::FILE_NOT_FOUND) {
+          throw std::runtime_error("Got an unexpected failure cause: " + e.getCause()->toString());
+        }
+      }
+      if (success) {
+        throw std::runtime_error("Shouldn't be able to read a file that's not there");
+      }
+
+      // Read files, one of which has no storage service
+      success = true;
+      try {
+        wrench::StorageService::readFiles({this->test->file_1, this->test->file_10},
+                                          {{this->test->file_1, this->test->storage_service_1000}}, nullptr, 2);
+      } catch (wrench::WorkflowExecutionException &e) {
+        success = false;
+        if (e.getCause()->getCauseType() != wrench::FailureCause::NO_STORAGE_SERVICE_FOR_FILE) {
+          throw std::runtime_error("Got an unexpected failure cause: " + e.getCause()->toString());
+        }
+      }
+      if (success) {
+        throw std::runtime_error("Shouldn't be able to read a file without a storage service");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(SimpleStorageServiceFunctionalTest, ConcurrentFileReadsAndWrites) {
+  DO_TEST_WITH_FORK(do_ConcurrentFileReadsAndWrites_test);
+}
+
+void SimpleStorageServiceFunctionalTest::do_ConcurrentFileReadsAndWrites_test() {
+
+  // Create and initialize a simulation
+  wrench::Simulation *simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("capacity_test");
+
+  EXPECT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = simulation->getHostnameList()[0];
+
+  // Create a  Compute Service
+  EXPECT_NO_THROW(compute_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService(hostname, true, true,
+                                                       {std::make_tuple(hostname, 1, 0)},
+                                                       nullptr, {})));
+
+  // Create 2 Storage Services
+  EXPECT_NO_THROW(storage_service_1000 = simulation->add(
+          new wrench::SimpleStorageService(hostname, 1000.0)));
+
+  EXPECT_NO_THROW(storage_service_500 = simulation->add(
+          new wrench::SimpleStorageService(hostname, 500.0)));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new SimpleStorageServiceConcurrentFileReadsAndWritesTestWMS(
+                  this,
+                  {compute_service},
+                  {storage_service_1000, storage_service_500}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow));
+
+  // Create a file registry
+  simulation->setFileRegistryService(new wrench::FileRegistryService(hostname));
+
+  // Running a "run a single task" simulation
+  EXPECT_NO_THROW(simulation->launch());
+
+  delete simulation;
+  free(argv[0]);
+  free(argv);
+}
@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+#include <wrench/services/compute/batch/BatchService.h>
+#include "wrench/workflow/job/PilotJob.h"
+
+#include "../include/TestWithFork.h"
+
+
+class SimulationTimestampTest : public ::testing::Test {
+
+public:
+    wrench::WorkflowFile *input_file;
+    wrench::WorkflowFile *output_file1;
+    wrench::WorkflowFile *output_file2;
+    wrench::WorkflowFile *missing_file;
+    wrench::WorkflowTask *task1;
+    wrench::WorkflowTask *task2;
+    wrench::WorkflowTask *task3;
+    wrench::StorageService *storage_service1 = nullptr;
+    wrench::StorageService *storage_service2 = nullptr;
+    wrench::ComputeService *multicore_service = nullptr;
+    wrench::ComputeService *batch_service = nullptr;
+
+    void do_TimestampEmission_test();
+
+protected:
+    SimulationTimestampTest() {
+
+      // Create the workflow
+      workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+
+      input_file = workflow->addFile("input_file", 10000.0);
+      output_file1 = workflow->addFile("output_file1", 20000.0);
+      output_file2 = workflow->addFile("output_file2", 30000.0);
+      missing_file = workflow->addFile("missing_file", 40000.0);
+
+      // One task for the multicore service, one for the batch service, and one that fails
+      task1 = workflow->addTask("task1", 100, 1, 1, 1.0);
+      task1->addInputFile(input_file);
+      task1->addOutputFile(output_file1);
+      task2 = workflow->addTask("task2", 100, 1, 1, 1.0);
+      task2->addInputFile(input_file);
+      task2->addOutputFile(output_file2);
+      task3 = workflow->addTask("task3", 100, 1, 1, 1.0);
+      task3->addInputFile(missing_file);
+
+      // Create a two-host platform file
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"10\"/> "
+              "       <host id=\"Host2\" speed=\"1f\" core=\"10\"/> "
+              "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
+              "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+    std::unique_ptr<wrench::Workflow> workflow;
+};
+
+
+/**********************************************************************/
+/**  TIMESTAMP EMISSION SIMULATION TEST                              **/
+/**********************************************************************/
+
+class TimestampEmissionTestWMS : public wrench::WMS {
+
+public:
+    TimestampEmissionTestWMS(SimulationTimestampTest *test,
+                             const std::set<wrench::ComputeService *> &compute_services,
+                             const std::set<wrench::StorageService *> &storage_services,
+                             std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    SimulationTimestampTest *test;
+
+    void waitForEvent(wrench::WorkflowExecutionEvent::EventType type) {
+      std::unique_ptr<wrench::WorkflowExecutionEvent> event = this->workflow->waitForNextExecutionEvent();
+      if (event->type != type) {
+        throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+      }
+    }
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // A standard job on the multicore service, with a file copy before the task
+      wrench::StandardJob *job1 = job_manager->createStandardJob(
+              {test->task1},
+              {{test->input_file,   test->storage_service2},
+               {test->output_file1, test->storage_service2}},
+              {std::make_tuple(test->input_file, test->storage_service1, test->storage_service2)},
+              {}, {});
+      job_manager->submitJob(job1, test->multicore_service);
+      waitForEvent(wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION);
+
+      // A standard job on the batch service
+      wrench::StandardJob *job2 = job_manager->createStandardJob(
+              {test->task2},
+              {{test->input_file,   test->storage_service2},
+               {test->output_file2, test->storage_service2}});
+      std::map<std::string, std::string> batch_job_args;
+      batch_job_args["-N"] = "1";
+      batch_job_args["-t"] = "5"; //time in minutes
+      batch_job_args["-c"] = "1"; //number of cores per node
+      job_manager->submitJob(job2, test->batch_service, batch_job_args);
+      waitForEvent(wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION);
+
+      // A standard job that fails, on the multicore service
+      wrench::StandardJob *job3 = job_manager->createStandardJob(
+              {test->task3},
+              {{test->missing_file, test->storage_service2}});
+      job_manager->submitJob(job3, test->multicore_service);
+      waitForEvent(wrench::WorkflowExecutionEvent::STANDARD_JOB_FAILURE);
+
+      // A pilot job on the batch service, which expires after a minute
+      wrench::PilotJob *pilot_job = job_manager->createPilotJob(this->workflow, 1, 1, 0, 60);
+      batch_job_args["-t"] = "1"; //time in minutes
+      job_manager->submitJob((wrench::WorkflowJob *) pilot_job, test->batch_service, batch_job_args);
+      waitForEvent(wrench::WorkflowExecutionEvent::PILOT_JOB_START);
+      waitForEvent(wrench::WorkflowExecutionEvent::PILOT_JOB_EXPIRATION);
+
+      return 0;
+    }
+};
+
+/**
+ * @brief Get the date of the only timestamp, in a trace, that is about some subject
+ */
+template <class T>
+static double getDate(wrench::Simulation *simulation, const std::string &subject) {
+  double date = -1.0;
+  for (auto ts : simulation->output.getTrace<T>()) {
+    if (ts->getContent()->getSubject() == subject) {
+      if (date >= 0) {
+        throw std::runtime_error("Two " + T::getTypeName() + " timestamps about " + subject);
+      }
+      date = ts->getDate();
+    }
+  }
+  if (date < 0) {
+    throw std::runtime_error("No " + T::getTypeName() + " timestamp about " + subject);
+  }
+  return date;
+}
+
+TEST_F(SimulationTimestampTest, TimestampEmission) {
+  DO_TEST_WITH_FORK(do_TimestampEmission_test);
+}
+
+void SimulationTimestampTest::do_TimestampEmission_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("timestamp_test");
+
+  EXPECT_NO_THROW(simulation->init(&argc, argv));
+
+  // Record all types of timestamps
+  simulation->output.setAllTimestampTypesEnabled(true);
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = "Host1";
+
+  // Create two Storage Services
+  EXPECT_NO_THROW(storage_service1 = simulation->add(
+          new wrench::SimpleStorageService(hostname, 10000000000000.0)));
+  EXPECT_NO_THROW(storage_service2 = simulation->add(
+          new wrench::SimpleStorageService(hostname, 10000000000000.0)));
+
+  // Create a multicore Compute Service on Host1, and a Batch Service that uses Host2
+  EXPECT_NO_THROW(multicore_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService(hostname, true, true,
+                                                       {std::make_tuple(hostname, wrench::ComputeService::ALL_CORES,
+                                                                        wrench::ComputeService::ALL_RAM)},
+                                                       nullptr, {})));
+  EXPECT_NO_THROW(batch_service = simulation->add(
+          new wrench::BatchService(hostname, true, true, {"Host2"}, nullptr, {})));
+
+  simulation->setFileRegistryService(new wrench::FileRegistryService(hostname));
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new TimestampEmissionTestWMS(this, {multicore_service, batch_service},
+                                       {storage_service1, storage_service2}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  // Staging the input_file on the first storage service
+  EXPECT_NO_THROW(simulation->stageFile(input_file, storage_service1));
+
+  EXPECT_NO_THROW(simulation->launch());
+
+  auto &output = simulation->output;
+
+  // Counts
+  ASSERT_EQ(3, output.getTrace<wrench::SimulationTimestampTaskStart>().size());
+  ASSERT_EQ(2, output.getTrace<wrench::SimulationTimestampTaskCompletion>().size());
+  ASSERT_EQ(1, output.getTrace<wrench::SimulationTimestampTaskFailure>().size());
+  ASSERT_EQ(1, output.getTrace<wrench::SimulationTimestampFileCopyStart>().size());
+  ASSERT_EQ(1, output.getTrace<wrench::SimulationTimestampFileCopyCompletion>().size());
+  ASSERT_EQ(3, output.getTrace<wrench::SimulationTimestampFileReadStart>().size()); // (including the missing file)
+  ASSERT_EQ(2, output.getTrace<wrench::SimulationTimestampFileReadCompletion>().size());
+  ASSERT_EQ(2, output.getTrace<wrench::SimulationTimestampFileWriteStart>().size());
+  ASSERT_EQ(2, output.getTrace<wrench::SimulationTimestampFileWriteCompletion>().size());
+  ASSERT_EQ(4, output.getTrace<wrench::SimulationTimestampJobSubmission>().size());
+  ASSERT_EQ(3, output.getTrace<wrench::SimulationTimestampJobStart>().size());
+  ASSERT_EQ(2, output.getTrace<wrench::SimulationTimestampJobCompletion>().size());
+  ASSERT_EQ(1, output.getTrace<wrench::SimulationTimestampPilotJobStart>().size());
+  ASSERT_EQ(1, output.getTrace<wrench::SimulationTimestampPilotJobExpiration>().size());
+
+  // The file copy: bytes, and source and destination storage services
+  auto copy = output.getTrace<wrench::SimulationTimestampFileCopyCompletion>()[0].getContent();
+  ASSERT_EQ(input_file, copy->getFile());
+  ASSERT_EQ(storage_service1, copy->getSource());
+  ASSERT_EQ(storage_service2, copy->getDestination());
+  ASSERT_DOUBLE_EQ(10000.0, copy->getNumBytes());
+
+  // File reads and writes: bytes, and storage service
+  for (auto ts : output.getTrace<wrench::SimulationTimestampFileReadCompletion>()) {
+    ASSERT_EQ(input_file, ts->getContent()->getFile());
+    ASSERT_EQ(storage_service2, ts->getContent()->getStorageService());
+    ASSERT_DOUBLE_EQ(10000.0, ts->getContent()->getNumBytes());
+  }
+  auto writes = output.getTrace<wrench::SimulationTimestampFileWriteCompletion>();
+  ASSERT_EQ(output_file1, writes[0].getContent()->getFile());
+  ASSERT_DOUBLE_EQ(20000.0, writes[0].getContent()->getNumBytes());
+  ASSERT_EQ(output_file2, writes[1].getContent()->getFile());
+  ASSERT_DOUBLE_EQ(30000.0, writes[1].getContent()->getNumBytes());
+  ASSERT_EQ(storage_service2, writes[0].getContent()->getStorageService());
+  ASSERT_EQ(storage_service2, writes[1].getContent()->getStorageService());
+
+  // Order of each successful job's events, which is, for the first job, after the file copy
+  ASSERT_LE(getDate<wrench::SimulationTimestampFileCopyStart>(simulation, "input_file"),
+            getDate<wrench::SimulationTimestampFileCopyCompletion>(simulation, "input_file"));
+  ASSERT_LE(getDate<wrench::SimulationTimestampFileCopyCompletion>(simulation, "input_file"),
+            getDate<wrench::SimulationTimestampTaskStart>(simulation, "task1"));
+  auto completions = output.getTrace<wrench::SimulationTimestampJobCompletion>();
+  for (unsigned long i = 0; i < 2; i++) {
+    auto completion = completions[i].getContent();
+    std::string task_id = (i == 0 ? "task1" : "task2");
+    std::string output_file_id = (i == 0 ? "output_file1" : "output_file2");
+    double submit_date = getDate<wrench::SimulationTimestampJobSubmission>(simulation, completion->getJobName());
+    double start_date = getDate<wrench::SimulationTimestampJobStart>(simulation, completion->getJobName());
+
+    ASSERT_EQ((i == 0 ? multicore_service : batch_service), completion->getComputeService());
+    ASSERT_DOUBLE_EQ(submit_date, completion->getSubmitDate());
+    ASSERT_DOUBLE_EQ(start_date, completion->getStartDate());
+    ASSERT_DOUBLE_EQ(start_date - submit_date, completion->getQueueWaitTime());
+    ASSERT_GE(completion->getQueueWaitTime(), 0.0);
+
+    std::vector<double> dates = {
+            submit_date,
+            start_date,
+            getDate<wrench::SimulationTimestampTaskStart>(simulation, task_id),
+            getDate<wrench::SimulationTimestampFileWriteStart>(simulation, output_file_id),
+            getDate<wrench::SimulationTimestampFileWriteCompletion>(simulation, output_file_id),
+            getDate<wrench::SimulationTimestampTaskCompletion>(simulation, task_id),
+            completions[i].getDate()};
+    for (unsigned long j = 1; j < dates.size(); j++) {
+      ASSERT_LE(dates[j - 1], dates[j]);
+    }
+  }
+
+  // The failed job: a task start, and then a task failure, but no task or job completion
+  ASSERT_LE(getDate<wrench::SimulationTimestampTaskStart>(simulation, "task3"),
+            getDate<wrench::SimulationTimestampTaskFailure>(simulation, "task3"));
+  ASSERT_NE(wrench::WorkflowTask::COMPLETED, task3->getState());
+
+  // The pilot job ran for its requested minute
+  auto pilot_job_start = output.getTrace<wrench::SimulationTimestampPilotJobStart>()[0];
+  auto pilot_job_expiration = output.getTrace<wrench::SimulationTimestampPilotJobExpiration>()[0];
+  ASSERT_EQ(pilot_job_start.getContent()->getJobName(), pilot_job_expiration.getContent()->getJobName());
+  ASSERT_EQ(batch_service, pilot_job_expiration.getContent()->getComputeService());
+  ASSERT_LE(getDate<wrench::SimulationTimestampJobSubmission>(simulation,
+                                                              pilot_job_start.getContent()->getJobName()),
+            pilot_job_start.getDate());
+  ASSERT_NEAR(60.0, pilot_job_expiration.getDate() - pilot_job_start.getDate(), 1.0);
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
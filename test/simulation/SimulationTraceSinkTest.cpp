@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+class SimulationTraceSinkTest : public ::testing::Test {
+
+protected:
+    std::string trace_file_path = "/tmp/trace.out";
+};
+
+TEST_F(SimulationTraceSinkTest, BinaryRoundTrip) {
+  {
+    // A tiny buffer, so that the trace is flushed many times
+    wrench::SimulationTraceSink sink(trace_file_path, wrench::SimulationTraceSink::BINARY, 16);
+    for (unsigned long i = 0; i < 1000; i++) {
+      sink.write((i % 3 == 0) ? "task_completion" : "task_start", 0.5 * i, "task_" + std::to_string(i));
+    }
+    sink.write("task_start", 1.0, "");
+    ASSERT_EQ(1001, sink.getNumRecords());
+  }
+
+  std::vector<wrench::SimulationTraceRecord> records = wrench::SimulationTraceReader::readAll(trace_file_path);
+  ASSERT_EQ(1001, records.size());
+  for (unsigned long i = 0; i < 1000; i++) {
+    ASSERT_EQ((i % 3 == 0) ? "task_completion" : "task_start", records[i].type);
+    ASSERT_EQ(0.5 * i, records[i].date);
+    ASSERT_EQ("task_" + std::to_string(i), records[i].subject);
+  }
+  ASSERT_EQ("", records[1000].subject);
+
+  // Truncated file
+  std::ifstream in(trace_file_path, std::ios::binary);
+  std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  std::ofstream out(trace_file_path, std::ios::binary | std::ios::trunc);
+  out.write(bytes.data(), bytes.size() - 3);
+  out.close();
+  ASSERT_THROW(wrench::SimulationTraceReader::readAll(trace_file_path), std::invalid_argument);
+
+  ASSERT_THROW(wrench::SimulationTraceReader::readAll("/tmp/does_not_exist.out"), std::invalid_argument);
+}
+
+TEST_F(SimulationTraceSinkTest, CSV) {
+  {
+    wrench::SimulationTraceSink sink(trace_file_path, wrench::SimulationTraceSink::CSV);
+    sink.write("task_completion", 12.5, "task1");
+    sink.write("task_completion", 13, "task,\"2\"");
+  }
+
+  std::ifstream in(trace_file_path);
+  std::stringstream content;
+  content << in.rdbuf();
+  ASSERT_EQ("type,date,subject,service,destination_service,num_bytes,submit_date,start_date,queue_wait\n"
+                    "task_completion,12.5,task1,,,,,,\n"
+                    "task_completion,13,\"task,\"\"2\"\"\",,,,,,\n", content.str());
+
+  // A CSV trace is not a binary trace
+  ASSERT_THROW(wrench::SimulationTraceReader::readAll(trace_file_path), std::invalid_argument);
+  ASSERT_THROW(wrench::SimulationTraceSink("/does_not_exist/trace.csv", wrench::SimulationTraceSink::CSV),
+               std::invalid_argument);
+}
+
+TEST_F(SimulationTraceSinkTest, Fields) {
+  wrench::SimulationTraceRecord copy;
+  copy.reset("file_copy_completion", 2.0);
+  copy.subject = "file1";
+  copy.service = "storage1";
+  copy.destination_service = "storage,2";
+  copy.num_bytes = 1000.0;
+
+  wrench::SimulationTraceRecord job;
+  job.reset("job_completion", 30.0);
+  job.subject = "job1";
+  job.service = "compute1";
+  job.submit_date = 10.0;
+  job.start_date = 25.0;
+
+  // CSV
+  {
+    wrench::SimulationTraceSink sink(trace_file_path, wrench::SimulationTraceSink::CSV);
+    sink.write(copy);
+    sink.write(job);
+  }
+  std::ifstream in(trace_file_path);
+  std::stringstream content;
+  content << in.rdbuf();
+  ASSERT_EQ("type,date,subject,service,destination_service,num_bytes,submit_date,start_date,queue_wait\n"
+                    "file_copy_completion,2,file1,storage1,\"storage,2\",1000,,,\n"
+                    "job_completion,30,job1,compute1,,,10,25,15\n", content.str());
+
+  // Binary (with service names written once)
+  {
+    wrench::SimulationTraceSink sink(trace_file_path, wrench::SimulationTraceSink::BINARY);
+    sink.write(copy);
+    sink.write(job);
+    sink.write(copy);
+    sink.write("task_start", 3.0, "task1");
+  }
+  std::vector<wrench::SimulationTraceRecord> records = wrench::SimulationTraceReader::readAll(trace_file_path);
+  ASSERT_EQ(4, records.size());
+  for (auto i : {0, 2}) {
+    ASSERT_EQ("file_copy_completion", records[i].type);
+    ASSERT_EQ(2.0, records[i].date);
+    ASSERT_EQ("file1", records[i].subject);
+    ASSERT_EQ("storage1", records[i].service);
+    ASSERT_EQ("storage,2", records[i].destination_service);
+    ASSERT_EQ(1000.0, records[i].num_bytes);
+    ASSERT_EQ(-1.0, records[i].getQueueWaitTime());
+  }
+  ASSERT_EQ("job1", records[1].subject);
+  ASSERT_EQ("compute1", records[1].service);
+  ASSERT_EQ("", records[1].destination_service);
+  ASSERT_EQ(-1.0, records[1].num_bytes);
+  ASSERT_EQ(10.0, records[1].submit_date);
+  ASSERT_EQ(25.0, records[1].start_date);
+  ASSERT_EQ(15.0, records[1].getQueueWaitTime());
+  ASSERT_EQ("task1", records[3].subject);
+  ASSERT_EQ("", records[3].service);
+  ASSERT_EQ(-1.0, records[3].num_bytes);
+  ASSERT_EQ(-1.0, records[3].submit_date);
+}
+
+TEST_F(SimulationTraceSinkTest, BinaryVersion1) {
+  // A version 1 trace, whose timestamps have no fields beyond their subjects
+  {
+    std::ofstream out(trace_file_path, std::ios::binary | std::ios::trunc);
+    uint32_t version = 1;
+    uint8_t tag;
+    uint16_t type_id = 0;
+    uint32_t length;
+    double date = 4.5;
+    out.write(wrench::SimulationTraceSink::BINARY_MAGIC, sizeof(wrench::SimulationTraceSink::BINARY_MAGIC));
+    out.write((const char *) &version, sizeof(version));
+    tag = wrench::SimulationTraceSink::BINARY_TYPE_DEFINITION;
+    length = 10;
+    out.write((const char *) &tag, sizeof(tag));
+    out.write((const char *) &type_id, sizeof(type_id));
+    out.write((const char *) &length, sizeof(length));
+    out.write("task_start", length);
+    tag = wrench::SimulationTraceSink::BINARY_TIMESTAMP;
+    length = 5;
+    out.write((const char *) &tag, sizeof(tag));
+    out.write((const char *) &type_id, sizeof(type_id));
+    out.write((const char *) &date, sizeof(date));
+    out.write((const char *) &length, sizeof(length));
+    out.write("task1", length);
+  }
+
+  std::vector<wrench::SimulationTraceRecord> records = wrench::SimulationTraceReader::readAll(trace_file_path);
+  ASSERT_EQ(1, records.size());
+  ASSERT_EQ("task_start", records[0].type);
+  ASSERT_EQ(4.5, records[0].date);
+  ASSERT_EQ("task1", records[0].subject);
+  ASSERT_EQ("", records[0].service);
+}
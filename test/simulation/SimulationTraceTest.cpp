@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+class SimulationTraceTest : public ::testing::Test {
+
+protected:
+    SimulationTraceTest() {
+      workflow = new wrench::Workflow();
+      task1 = workflow->addTask("task1", 1.0, 1, 1, 1.0);
+      task2 = workflow->addTask("task2", 1.0, 1, 1, 1.0);
+    }
+
+    ~SimulationTraceTest() {
+      delete workflow;
+    }
+
+    wrench::Workflow *workflow;
+    wrench::WorkflowTask *task1;
+    wrench::WorkflowTask *task2;
+};
+
+TEST_F(SimulationTraceTest, ColumnsAndView) {
+  wrench::SimulationTrace<wrench::SimulationTimestampTaskCompletion> trace;
+  trace.reserve(10);
+  ASSERT_EQ(0, trace.size());
+  ASSERT_TRUE(wrench::SimulationTraceView<wrench::SimulationTimestampTaskCompletion>(&trace).empty());
+
+  trace.addTimestamp(1.0, wrench::SimulationTimestampTaskCompletion(task1));
+  trace.addTimestamp(2.5, wrench::SimulationTimestampTaskCompletion(task2));
+  ASSERT_EQ(2, trace.size());
+  ASSERT_EQ(2, trace.getDates().size());
+  ASSERT_EQ(2, trace.getContents().size());
+
+  wrench::SimulationTraceView<wrench::SimulationTimestampTaskCompletion> view(&trace);
+  ASSERT_EQ(2, view.size());
+  ASSERT_EQ(1.0, view[0]->getDate());
+  ASSERT_EQ(task1, view[0]->getContent()->getTask());
+  ASSERT_EQ(2.5, view[1].getDate());
+  ASSERT_EQ(task2, view[1].getContent()->getTask());
+
+  // The view does not copy the columns
+  ASSERT_EQ(trace.getDates().data(), view.getDates());
+  ASSERT_EQ(trace.getContents().data(), view.getContents());
+  ASSERT_EQ(&(trace.getContents()[1]), view[1]->getContent());
+
+  std::vector<double> dates;
+  for (auto ts : view) {
+    dates.push_back(ts->getDate());
+  }
+  ASSERT_EQ(std::vector<double>({1.0, 2.5}), dates);
+}
+
+TEST_F(SimulationTraceTest, EmptyTrace) {
+  wrench::SimulationOutput output;
+  auto view = output.getTrace<wrench::SimulationTimestampTaskCompletion>();
+  ASSERT_EQ(0, view.size());
+  ASSERT_TRUE(view.begin() == view.end());
+  ASSERT_EQ(nullptr, view.getDates());
+}
+
+TEST_F(SimulationTraceTest, TimestampTypes) {
+  wrench::SimulationOutput output;
+
+  // Only task completions are recorded by default
+  ASSERT_TRUE(output.isTimestampTypeEnabled<wrench::SimulationTimestampTaskCompletion>());
+  ASSERT_FALSE(output.isTimestampTypeEnabled<wrench::SimulationTimestampTaskStart>());
+  ASSERT_FALSE(output.isTimestampTypeEnabled<wrench::SimulationTimestampFileCopyCompletion>());
+  ASSERT_FALSE(output.isTimestampTypeEnabled<wrench::SimulationTimestampJobSubmission>());
+
+  output.setTimestampTypeEnabled<wrench::SimulationTimestampTaskStart>(true);
+  output.setTimestampTypeEnabled<wrench::SimulationTimestampTaskCompletion>(false);
+  ASSERT_TRUE(output.isTimestampTypeEnabled<wrench::SimulationTimestampTaskStart>());
+  ASSERT_FALSE(output.isTimestampTypeEnabled<wrench::SimulationTimestampTaskCompletion>());
+
+  output.setAllTimestampTypesEnabled(true);
+  ASSERT_TRUE(output.isTimestampTypeEnabled<wrench::SimulationTimestampPilotJobExpiration>());
+  output.setAllTimestampTypesEnabled(false);
+  ASSERT_FALSE(output.isTimestampTypeEnabled<wrench::SimulationTimestampTaskStart>());
+
+  // Type names and ids are distinct
+  std::set<std::string> names = {wrench::SimulationTimestampTaskStart::getTypeName(),
+                                 wrench::SimulationTimestampTaskCompletion::getTypeName(),
+                                 wrench::SimulationTimestampTaskFailure::getTypeName(),
+                                 wrench::SimulationTimestampFileReadStart::getTypeName(),
+                                 wrench::SimulationTimestampFileWriteCompletion::getTypeName(),
+                                 wrench::SimulationTimestampJobCompletion::getTypeName()};
+  ASSERT_EQ(6, names.size());
+  ASSERT_NE(wrench::SimulationTimestampJobStart::TYPE_ID, wrench::SimulationTimestampPilotJobStart::TYPE_ID);
+
+  // Job completion timestamps carry the queue wait time, when known
+  wrench::SimulationTimestampJobCompletion completion("job", nullptr, 10.0, 25.0);
+  ASSERT_EQ("job", completion.getSubject());
+  ASSERT_DOUBLE_EQ(15.0, completion.getQueueWaitTime());
+  ASSERT_DOUBLE_EQ(-1.0, wrench::SimulationTimestampJobCompletion("job", nullptr, 10.0, -1.0).getQueueWaitTime());
+}
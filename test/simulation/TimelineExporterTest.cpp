@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <json.hpp>
+#include <wrench-dev.h>
+
+class TimelineExporterTest : public ::testing::Test {
+
+protected:
+    TimelineExporterTest() {
+      workflow = new wrench::Workflow();
+      task1 = workflow->addTask("task1", 1.0, 1, 1, 1.0);
+      task2 = workflow->addTask("task2", 1.0, 1, 1, 1.0);
+      task3 = workflow->addTask("task\"3", 1.0, 1, 1, 1.0);
+      task4 = workflow->addTask("task4", 1.0, 1, 1, 1.0);
+
+      setExecution(task1, "Host1", 0.0, 10.0);
+      setExecution(task2, "Host1", 5.0, 12.0);
+      setExecution(task3, "Host1", 10.0, 20.0);
+      setExecution(task4, "Host2", 0.0, 4.0);
+    }
+
+    ~TimelineExporterTest() {
+      delete workflow;
+    }
+
+    void setExecution(wrench::WorkflowTask *task, std::string hostname, double start_date, double end_date) {
+      task->setStartDate(start_date);
+      task->setEndDate(end_date);
+      task->setExecutionHost(hostname);
+      task->setState(wrench::WorkflowTask::COMPLETED);
+    }
+
+    std::string readFile(const std::string &path) {
+      std::ifstream file(path);
+      std::stringstream content;
+      content << file.rdbuf();
+      return content.str();
+    }
+
+    std::string trace_file_path = "/tmp/timeline.trace";
+    wrench::Workflow *workflow;
+    wrench::WorkflowTask *task1;
+    wrench::WorkflowTask *task2;
+    wrench::WorkflowTask *task3;
+    wrench::WorkflowTask *task4;
+};
+
+TEST_F(TimelineExporterTest, ChromeTrace) {
+  wrench::SimulationOutput output;
+  // A tiny buffer, so that the output is written in many chunks
+  ASSERT_NO_THROW(wrench::TimelineExporter::exportTimeline(workflow, output, trace_file_path,
+                                                           wrench::TimelineExporter::CHROME_TRACE, 16));
+
+  nlohmann::json json;
+  ASSERT_NO_THROW(json = nlohmann::json::parse(readFile(trace_file_path)));
+
+  std::map<std::string, nlohmann::json> tasks;
+  unsigned long num_processes = 0;
+  for (auto const &event : json["traceEvents"]) {
+    if (event["ph"] == "X") {
+      tasks[event["name"].get<std::string>()] = event;
+    } else if (event["name"] == "process_name") {
+      num_processes++;
+    }
+  }
+  ASSERT_EQ(2, num_processes);
+  ASSERT_EQ(4, tasks.size());
+
+  // task1 and task2 overlap, so they are on different lanes, and task3 reuses task1's lane
+  ASSERT_EQ(tasks["task1"]["pid"], tasks["task2"]["pid"]);
+  ASSERT_NE(tasks["task1"]["tid"], tasks["task2"]["tid"]);
+  ASSERT_EQ(tasks["task1"]["tid"], tasks["task\"3"]["tid"]);
+  ASSERT_NE(tasks["task1"]["pid"], tasks["task4"]["pid"]);
+  ASSERT_DOUBLE_EQ(5000000.0, tasks["task2"]["ts"].get<double>());
+  ASSERT_DOUBLE_EQ(7000000.0, tasks["task2"]["dur"].get<double>());
+}
+
+TEST_F(TimelineExporterTest, PajeTrace) {
+  wrench::SimulationOutput output;
+  ASSERT_NO_THROW(wrench::TimelineExporter::exportTimeline(workflow, output, trace_file_path,
+                                                           wrench::TimelineExporter::PAJE));
+
+  std::istringstream content(readFile(trace_file_path));
+  std::string line;
+  double last_date = 0.0;
+  unsigned long num_pushes = 0, num_pops = 0;
+  while (std::getline(content, line)) {
+    std::istringstream tokens(line);
+    std::string event;
+    double date;
+    tokens >> event;
+    if ((event == "5") or (event == "6")) {
+      tokens >> date;
+      // Events are in chronological order
+      ASSERT_GE(date, last_date);
+      last_date = date;
+      (event == "5" ? num_pushes : num_pops)++;
+    }
+  }
+  ASSERT_EQ(4, num_pushes);
+  ASSERT_EQ(4, num_pops);
+  ASSERT_DOUBLE_EQ(20.0, last_date);
+}
+
+TEST_F(TimelineExporterTest, InvalidArguments) {
+  wrench::SimulationOutput output;
+  ASSERT_THROW(wrench::TimelineExporter::exportTimeline(nullptr, output, trace_file_path), std::invalid_argument);
+  ASSERT_THROW(wrench::TimelineExporter::exportTimeline(workflow, output, "/does/not/exist/timeline.json"),
+               std::invalid_argument);
+}
@@ -0,0 +1,242 @@
+/**
+ * Copyright (c) 2017-2018. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+#include <wrench/services/compute/batch/BatchService.h>
+
+#include "../include/TestWithFork.h"
+
+TEST(UtilizationRecorderTest, EveryChange) {
+  wrench::UtilizationRecorder recorder;
+  ASSERT_FALSE(recorder.isDownsampling());
+
+  recorder.allocate(0.0, "Host1", 2, 100.0);
+  recorder.allocate(5.0, "Host1", 1, 50.0);
+  recorder.allocate(5.0, "Host2", 4, 0.0);
+  recorder.release(10.0, "Host1", 2, 100.0);
+  recorder.release(10.0, "Host1", 1, 50.0);
+
+  ASSERT_EQ(std::vector<std::string>({"Host1", "Host2"}), recorder.getHostnames());
+
+  std::vector<wrench::UtilizationSample> samples = recorder.getSamples("Host1");
+  // Changes at the same date are coalesced
+  ASSERT_EQ(3, samples.size());
+  ASSERT_DOUBLE_EQ(0.0, samples[0].date);
+  ASSERT_DOUBLE_EQ(2.0, samples[0].busy_cores);
+  ASSERT_DOUBLE_EQ(100.0, samples[0].used_ram);
+  ASSERT_DOUBLE_EQ(5.0, samples[1].date);
+  ASSERT_DOUBLE_EQ(3.0, samples[1].busy_cores);
+  ASSERT_DOUBLE_EQ(150.0, samples[1].used_ram);
+  ASSERT_DOUBLE_EQ(10.0, samples[2].date);
+  ASSERT_DOUBLE_EQ(0.0, samples[2].busy_cores);
+  ASSERT_DOUBLE_EQ(0.0, samples[2].used_ram);
+
+  ASSERT_EQ(1, recorder.getSamples("Host2").size());
+  ASSERT_THROW(recorder.getSamples("Host3"), std::invalid_argument);
+}
+
+TEST(UtilizationRecorderTest, Downsampling) {
+  ASSERT_THROW(wrench::UtilizationRecorder(1, 1.0), std::invalid_argument);
+  ASSERT_THROW(wrench::UtilizationRecorder(10, 0.0), std::invalid_argument);
+
+  wrench::UtilizationRecorder recorder(4, 1.0);
+  ASSERT_TRUE(recorder.isDownsampling());
+
+  // 2 cores busy during the first half of each second
+  for (unsigned long i = 0; i < 1000; i++) {
+    recorder.allocate(i, "Host1", 2, 10.0);
+    recorder.release(i + 0.5, "Host1", 2, 10.0);
+  }
+
+  // The series stays bounded, and the period has grown accordingly
+  std::vector<wrench::UtilizationSample> samples = recorder.getSamples("Host1");
+  ASSERT_LE(samples.size(), 4 + 2);
+  ASSERT_GE(recorder.getPeriod("Host1"), 1000.0 / 4);
+
+  // Averages are preserved
+  for (unsigned long i = 0; i + 2 < samples.size(); i++) {
+    ASSERT_NEAR(1.0, samples[i].busy_cores, 0.001);
+    ASSERT_NEAR(5.0, samples[i].used_ram, 0.001);
+  }
+  ASSERT_DOUBLE_EQ(999.5, samples.back().date);
+  ASSERT_DOUBLE_EQ(0.0, samples.back().busy_cores);
+
+  // Total core-seconds are preserved
+  double core_seconds = 0.0;
+  for (unsigned long i = 0; i + 1 < samples.size(); i++) {
+    core_seconds += samples[i].busy_cores * (samples[i + 1].date - samples[i].date);
+  }
+  ASSERT_NEAR(1000.0, core_seconds, 0.001);
+}
+
+
+/**********************************************************************/
+/**  RECORDING BY COMPUTE SERVICES SIMULATION TEST                   **/
+/**********************************************************************/
+
+class UtilizationRecordingTest : public ::testing::Test {
+
+public:
+    wrench::WorkflowTask *task1;
+    wrench::WorkflowTask *task2;
+    wrench::ComputeService *multicore_service = nullptr;
+    wrench::ComputeService *batch_service = nullptr;
+
+    void do_ComputeServiceRecording_test();
+
+protected:
+    UtilizationRecordingTest() {
+
+      // Create the workflow
+      workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+
+      // A 2-core task that needs some RAM, and a 2-core task that needs none
+      task1 = workflow->addTask("task1", 100, 2, 2, 1.0, 300);
+      task2 = workflow->addTask("task2", 100, 2, 2, 1.0, 0);
+
+      // Create a platform file with a multicore host and a batch node, both with RAM capacities
+      std::string xml = "<?xml version='1.0'?>"
+              "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+              "<platform version=\"4.1\"> "
+              "   <zone id=\"AS0\" routing=\"Full\"> "
+              "       <host id=\"Host1\" speed=\"1f\" core=\"10\"/> "
+              "       <host id=\"Host2\" speed=\"1f\" core=\"4\"> "
+              "         <prop id=\"ram\" value=\"1000\"/> "
+              "       </host> "
+              "       <host id=\"Host3\" speed=\"1f\" core=\"4\"> "
+              "         <prop id=\"ram\" value=\"2000\"/> "
+              "       </host> "
+              "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
+              "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+              "       <route src=\"Host1\" dst=\"Host3\"> <link_ctn id=\"1\"/> </route>"
+              "   </zone> "
+              "</platform>";
+      FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+      fprintf(platform_file, "%s", xml.c_str());
+      fclose(platform_file);
+    }
+
+    std::string platform_file_path = "/tmp/platform.xml";
+    std::unique_ptr<wrench::Workflow> workflow;
+};
+
+class ComputeServiceRecordingTestWMS : public wrench::WMS {
+
+public:
+    ComputeServiceRecordingTestWMS(UtilizationRecordingTest *test,
+                                   const std::set<wrench::ComputeService *> &compute_services,
+                                   std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    UtilizationRecordingTest *test;
+
+    int main() {
+
+      // Create a job manager
+      std::shared_ptr<wrench::JobManager> job_manager = this->createJobManager();
+
+      // A standard job on the multicore service
+      wrench::StandardJob *job1 = job_manager->createStandardJob({test->task1}, {});
+      job_manager->submitJob(job1, test->multicore_service);
+      std::unique_ptr<wrench::WorkflowExecutionEvent> event = this->workflow->waitForNextExecutionEvent();
+      if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+        throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+      }
+
+      // A standard job on the batch service
+      wrench::StandardJob *job2 = job_manager->createStandardJob({test->task2}, {});
+      std::map<std::string, std::string> batch_job_args;
+      batch_job_args["-N"] = "1";
+      batch_job_args["-t"] = "5"; //time in minutes
+      batch_job_args["-c"] = "2"; //number of cores per node
+      job_manager->submitJob(job2, test->batch_service, batch_job_args);
+      event = this->workflow->waitForNextExecutionEvent();
+      if (event->type != wrench::WorkflowExecutionEvent::STANDARD_JOB_COMPLETION) {
+        throw std::runtime_error("Unexpected workflow execution event: " + std::to_string((int) (event->type)));
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(UtilizationRecordingTest, ComputeServiceRecording) {
+  DO_TEST_WITH_FORK(do_ComputeServiceRecording_test);
+}
+
+void UtilizationRecordingTest::do_ComputeServiceRecording_test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  auto argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("utilization_test");
+
+  EXPECT_NO_THROW(simulation->init(&argc, argv));
+
+  // Setting up the platform
+  EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  // Get a hostname
+  std::string hostname = "Host1";
+
+  // Create a multicore Compute Service that uses Host2, and a Batch Service that uses Host3,
+  // which share a utilization recorder
+  EXPECT_NO_THROW(multicore_service = simulation->add(
+          new wrench::MultihostMulticoreComputeService(hostname, true, false,
+                                                       {std::make_tuple("Host2", wrench::ComputeService::ALL_CORES,
+                                                                        wrench::ComputeService::ALL_RAM)},
+                                                       nullptr, {})));
+  EXPECT_NO_THROW(batch_service = simulation->add(
+          new wrench::BatchService(hostname, true, false, {"Host3"}, nullptr, {})));
+
+  std::shared_ptr<wrench::UtilizationRecorder> recorder = std::make_shared<wrench::UtilizationRecorder>();
+  multicore_service->setUtilizationRecorder(recorder);
+  batch_service->setUtilizationRecorder(recorder);
+
+  // Create a WMS
+  wrench::WMS *wms = nullptr;
+  EXPECT_NO_THROW(wms = simulation->add(
+          new ComputeServiceRecordingTestWMS(this, {multicore_service, batch_service}, hostname)));
+
+  EXPECT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+  EXPECT_NO_THROW(simulation->launch());
+
+  ASSERT_EQ(std::vector<std::string>({"Host2", "Host3"}), recorder->getHostnames());
+
+  // The multicore service reserves the cores and the RAM that the task needs, for as long as it runs
+  std::vector<wrench::UtilizationSample> samples = recorder->getSamples("Host2");
+  ASSERT_EQ(2, samples.size());
+  ASSERT_DOUBLE_EQ(2.0, samples[0].busy_cores);
+  ASSERT_DOUBLE_EQ(300.0, samples[0].used_ram);
+  ASSERT_DOUBLE_EQ(0.0, samples[1].busy_cores);
+  ASSERT_DOUBLE_EQ(0.0, samples[1].used_ram);
+  ASSERT_LE(samples[0].date, task1->getStartDate());
+  ASSERT_GE(samples[1].date, task1->getEndDate());
+
+  // The batch service reserves the cores asked for, and the whole node's RAM
+  samples = recorder->getSamples("Host3");
+  ASSERT_EQ(2, samples.size());
+  ASSERT_DOUBLE_EQ(2.0, samples[0].busy_cores);
+  ASSERT_DOUBLE_EQ(2000.0, samples[0].used_ram);
+  ASSERT_DOUBLE_EQ(0.0, samples[1].busy_cores);
+  ASSERT_DOUBLE_EQ(0.0, samples[1].used_ram);
+  ASSERT_LE(samples[0].date, task2->getStartDate());
+  ASSERT_GE(samples[1].date, task2->getEndDate());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
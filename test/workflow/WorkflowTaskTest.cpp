@@ -109,6 +109,37 @@ TEST_F(WorkflowTaskTest, InputOutputFile) {
   EXPECT_EQ(t3->getNumberOfParents(), 1);
 }
 
+TEST_F(WorkflowTaskTest, SpeedupModel) {
+  // Without a speedup model, the parallel efficiency is used
+  EXPECT_EQ(t2->getSpeedupModel(), nullptr);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(4), 2.0);
+
+  t2->setSpeedupModel(std::make_shared<wrench::AmdahlSpeedupModel>(0.25));
+  EXPECT_NE(t2->getSpeedupModel(), nullptr);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(1), 1.0);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(4), 1.0 / (0.25 + 0.75 / 4));
+
+  t2->setSpeedupModel(std::make_shared<wrench::ConstantEfficiencySpeedupModel>(0.75));
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(4), 3.0);
+
+  t2->setSpeedupModel(std::make_shared<wrench::TabulatedSpeedupModel>(
+          std::map<unsigned long, double>{{2, 1.5}, {4, 3.0}, {8, 4.0}}));
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(1), 0.75);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(2), 1.5);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(3), 2.25);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(6), 3.5);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(8), 4.0);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(16), 4.0);
+
+  t2->setSpeedupModel(nullptr);
+  EXPECT_DOUBLE_EQ(t2->getSpeedup(4), 2.0);
+
+  ASSERT_THROW(wrench::ConstantEfficiencySpeedupModel(0.0), std::invalid_argument);
+  ASSERT_THROW(wrench::AmdahlSpeedupModel(1.5), std::invalid_argument);
+  ASSERT_THROW(wrench::TabulatedSpeedupModel({}), std::invalid_argument);
+  ASSERT_THROW(wrench::TabulatedSpeedupModel({{0, 1.0}}), std::invalid_argument);
+}
+
 TEST_F(WorkflowTaskTest, StateToString) {
   EXPECT_EQ(wrench::WorkflowTask::stateToString(wrench::WorkflowTask::State::NOT_READY), "NOT READY");
   EXPECT_EQ(wrench::WorkflowTask::stateToString(wrench::WorkflowTask::State::READY), "READY");
@@ -2,4 +2,6 @@
 
 set(CMAKEFILES_TXT
         examples/simple-wms/CMakeLists.txt
+        examples/scale-test/CMakeLists.txt
+        examples/ensemble/CMakeLists.txt
         )
\ No newline at end of file